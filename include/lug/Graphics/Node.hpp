@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 #include <lug/Graphics/Export.hpp>
+#include <lug/Math/Affine3.hpp>
 #include <lug/Math/Matrix.hpp>
 #include <lug/Math/Quaternion.hpp>
 #include <lug/Math/Vector.hpp>
@@ -41,6 +42,7 @@ public:
     const Math::Quatf& getAbsoluteRotation();
     const Math::Vec3f& getAbsoluteScale();
 
+    const Math::Affine3f& getAffineTransform();
     const Math::Mat4x4f& getTransform();
 
     void attachChild(std::unique_ptr<Node> child);
@@ -82,6 +84,8 @@ private:
     Math::Quatf _absoluteRotation{Math::Quatf::identity()};
     Math::Vec3f _absoluteScale{Math::Vec3f(1.0f)};
 
+    // The same transformation, the matrix is the one sent to the shaders
+    Math::Affine3f _affineTransform{Math::Affine3f::identity()};
     Math::Mat4x4f _transform{Math::Mat4x4f::identity()};
 
     bool _needUpdate{true};
@@ -35,6 +35,14 @@ inline const Math::Vec3f& Node::getAbsoluteScale() {
     return _absoluteScale;
 }
 
+inline const Math::Affine3f& Node::getAffineTransform() {
+    if (_needUpdate) {
+        update();
+    }
+
+    return _affineTransform;
+}
+
 inline const Math::Mat4x4f& Node::getTransform() {
     if (_needUpdate) {
         update();
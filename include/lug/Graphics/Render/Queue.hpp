@@ -1,6 +1,7 @@
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <lug/System/Memory/FrameArena.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -32,18 +33,18 @@ public:
     void clear();
     void removeDirtyProperty();
 
-    const std::vector<Scene::MeshInstance*>& getMeshs() const;
+    const System::Memory::FrameArena::Vector<Scene::MeshInstance*>& getMeshs() const;
     std::size_t getMeshsNb() const;
 
-    const std::vector<Light::Light*>& getLights() const;
+    const System::Memory::FrameArena::Vector<Light::Light*>& getLights() const;
     std::size_t getLightsNb() const;
 
 private:
-    std::size_t _meshsNb{0};
-    std::vector<Scene::MeshInstance*> _meshs{4000}; // TODO: Change that
+    // The queue is rebuilt every frame, its content is released at once by `clear`
+    System::Memory::FrameArena _frameArena{1};
 
-    std::vector<Light::Light*> _lights{50}; // TODO: Change that
-    std::size_t _lightsNb{0};
+    System::Memory::FrameArena::Vector<Scene::MeshInstance*> _meshs{_frameArena.getAllocator<Scene::MeshInstance*>()};
+    System::Memory::FrameArena::Vector<Light::Light*> _lights{_frameArena.getAllocator<Light::Light*>()};
 };
 
 #include <lug/Graphics/Render/Queue.inl>
@@ -1,17 +1,15 @@
-inline const std::vector<Scene::MeshInstance*>& Queue::getMeshs() const {
+inline const System::Memory::FrameArena::Vector<Scene::MeshInstance*>& Queue::getMeshs() const {
     return _meshs;
-
 }
 
 inline std::size_t Queue::getMeshsNb() const {
-    return _meshsNb;
+    return _meshs.size();
 }
 
-inline const std::vector<Light::Light*>& Queue::getLights() const {
+inline const System::Memory::FrameArena::Vector<Light::Light*>& Queue::getLights() const {
     return _lights;
-
 }
 
 inline std::size_t Queue::getLightsNb() const {
-    return _lightsNb;
+    return _lights.size();
 }
@@ -7,6 +7,7 @@
 #include <lug/Core/Version.hpp>
 #include <lug/Graphics/Module.hpp>
 #include <lug/Graphics/Render/Window.hpp>
+#include <lug/System/Memory/FrameArena.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -45,9 +46,14 @@ public:
 
     const InitInfo& getInfo() const;
 
+    // Scratch memory for the current frame, reset by `Core::Application::run` after `endFrame`
+    System::Memory::FrameArena& getFrameArena();
+
 protected:
     Graphics& _graphics;
     InitInfo _initInfo;
+
+    System::Memory::FrameArena _frameArena;
 };
 
 #include <lug/Graphics/Renderer.inl>
@@ -1,3 +1,7 @@
 inline const Renderer::InitInfo& Renderer::getInfo() const {
     return _initInfo;
 }
+
+inline System::Memory::FrameArena& Renderer::getFrameArena() {
+    return _frameArena;
+}
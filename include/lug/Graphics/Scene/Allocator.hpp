@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <lug/System/Memory/Allocator/SizeClass.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+#include <lug/System/Memory/Arena.hpp>
+#include <lug/System/Memory/Policies/BoundsChecker.hpp>
+#include <lug/System/Memory/Policies/MemoryMarker.hpp>
+#include <lug/System/Memory/Policies/Thread.hpp>
+#include <lug/System/Memory/StlAllocator.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Scene {
+
+// Memory of the containers of a scene
+// The containers live as long as their nodes, so the freed blocks are reused by the next ones (see Allocator::SizeClass)
+// The pages are committed one by one from a reserved range, a single container can't be bigger than a page (about 500k pointers)
+using Area = System::Memory::Area::VirtualHeap<4 * 1024 * 1024>;
+
+// Address space of the area of a scene (64 pages), nothing is committed before the first container grows
+constexpr size_t AreaReservedSize = 256 * 1024 * 1024;
+
+using Arena = System::Memory::Arena<
+    System::Memory::Allocator::SizeClass<>,
+    System::Memory::Policies::SingleThreadPolicy,
+    System::Memory::Policies::NoBoundsChecking,
+    System::Memory::Policies::NoMemoryMarking
+>;
+
+template <typename T>
+using Allocator = System::Memory::StlAllocator<T, Arena>;
+
+template <typename T>
+using Vector = std::vector<T, Allocator<T>>;
+
+} // Scene
+} // Graphics
+} // lug
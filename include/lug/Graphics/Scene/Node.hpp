@@ -4,6 +4,7 @@
 #include <vector>
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Node.hpp>
+#include <lug/Graphics/Scene/Allocator.hpp>
 #include <lug/Graphics/Scene/MovableObject.hpp>
 
 namespace lug {
@@ -44,7 +45,7 @@ public:
 
 private:
     Scene &_scene;
-    std::vector<std::unique_ptr<MovableObject>> _movableObjects;
+    Vector<std::unique_ptr<MovableObject>> _movableObjects;
 };
 
 #include <lug/Graphics/Scene/Node.inl>
@@ -2,6 +2,7 @@
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Light/Light.hpp>
+#include <lug/Graphics/Scene/Allocator.hpp>
 #include <lug/Graphics/Scene/MeshInstance.hpp>
 #include <lug/Graphics/Scene/ModelInstance.hpp>
 #include <lug/Graphics/Scene/MovableCamera.hpp>
@@ -44,7 +45,14 @@ public:
 
     void fetchVisibleObjects(const Render::View* renderView, const Render::Camera* camera, Render::Queue& renderQueue) const;
 
+    template <typename T>
+    Allocator<T> getAllocator();
+
 private:
+    // Declared before the nodes, their containers use it
+    Area _area{AreaReservedSize};
+    Arena _arena{&_area};
+
     std::unique_ptr<Node> _root{nullptr};
 };
 
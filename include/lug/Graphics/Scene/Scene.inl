@@ -5,3 +5,8 @@ inline Node* Scene::getRoot() {
 inline const Node* Scene::getRoot() const {
     return _root.get();
 }
+
+template <typename T>
+inline Allocator<T> Scene::getAllocator() {
+    return Allocator<T>(_arena);
+}
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Vulkan/Vulkan.hpp>
+#include <lug/System/Debug.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -33,12 +36,33 @@ public:
                 VkFence fence = VK_NULL_HANDLE
     ) const;
 
+    // Same as above for any contiguous container (e.g. `System::Memory::FrameArena::Vector`)
+    template <typename SignalSemaphores, typename WaitSemaphores, typename WaitDstStageMasks>
+    bool submit(const CommandBuffer& commandBuffer,
+                const SignalSemaphores& signalSemaphores,
+                const WaitSemaphores& waitSemaphores,
+                const WaitDstStageMasks& waitDstStageMasks,
+                VkFence fence = VK_NULL_HANDLE
+    ) const;
+
     bool waitIdle() const;
 
+private:
+    bool submit(const CommandBuffer& commandBuffer,
+                uint32_t signalSemaphoreCount,
+                const VkSemaphore* signalSemaphores,
+                uint32_t waitSemaphoreCount,
+                const VkSemaphore* waitSemaphores,
+                const VkPipelineStageFlags* waitDstStageMasks,
+                VkFence fence
+    ) const;
+
 private:
     VkQueue _queue{VK_NULL_HANDLE};
 };
 
+#include <lug/Graphics/Vulkan/API/Queue.inl>
+
 } // API
 } // Vulkan
 } // Graphics
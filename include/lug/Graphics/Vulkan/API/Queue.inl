@@ -0,0 +1,20 @@
+template <typename SignalSemaphores, typename WaitSemaphores, typename WaitDstStageMasks>
+inline bool Queue::submit(
+    const CommandBuffer& commandBuffer,
+    const SignalSemaphores& signalSemaphores,
+    const WaitSemaphores& waitSemaphores,
+    const WaitDstStageMasks& waitDstStageMasks,
+    VkFence fence) const {
+
+    LUG_ASSERT(waitSemaphores.size() == waitDstStageMasks.size(), "waitDstStageMasks should be the same size as waitSemaphores");
+
+    return submit(
+        commandBuffer,
+        static_cast<uint32_t>(signalSemaphores.size()),
+        signalSemaphores.size() > 0 ? signalSemaphores.data() : nullptr,
+        static_cast<uint32_t>(waitSemaphores.size()),
+        waitSemaphores.size() > 0 ? waitSemaphores.data() : nullptr,
+        waitDstStageMasks.size() > 0 ? waitDstStageMasks.data() : nullptr,
+        fence
+    );
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <ostream>
+#include <lug/Math/Export.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+
+// Affine transformation of the 3D space: a linear part (rotation, scale, shear) followed by a translation
+// The last row of the equivalent 4x4 matrix is always (0, 0, 0, 1), so only 3x4 values are stored
+// and the inverse and the products are much cheaper than the ones of a Mat4x4
+template <typename T = float>
+class Affine3 {
+public:
+    Affine3() = default;
+    constexpr Affine3(const Matrix<3, 3, T>& linear, const Vector<3, T>& translation);
+
+    // The last row of the matrix is ignored
+    explicit constexpr Affine3(const Matrix<4, 4, T>& matrix);
+
+    Affine3(const Affine3<T>&) = default;
+    Affine3(Affine3<T>&&) = default;
+
+    Affine3<T>& operator=(const Affine3<T>&) = default;
+    Affine3<T>& operator=(Affine3<T>&&) = default;
+
+    ~Affine3() = default;
+
+    constexpr const Matrix<3, 3, T>& getLinear() const;
+    constexpr const Vector<3, T>& getTranslation() const;
+
+    // The linear part has to be invertible
+    constexpr Affine3<T> inverse() const;
+
+    constexpr Vector<3, T> transformPoint(const Vector<3, T>& point) const;
+
+    // Without the translation
+    constexpr Vector<3, T> transformDirection(const Vector<3, T>& direction) const;
+
+    constexpr Matrix<4, 4, T> toMatrix() const;
+
+    static constexpr Affine3<T> identity();
+
+    // Same as translate(translation) * rotation.transform() * scale(scale), without the products
+    static constexpr Affine3<T> fromTRS(const Vector<3, T>& translation, const Quaternion<T>& rotation, const Vector<3, T>& scale);
+
+private:
+    Matrix<3, 3, T> _linear;
+    Vector<3, T> _translation;
+};
+
+template class LUG_MATH_API Affine3<float>;
+using Affine3f = Affine3<float>;
+
+template class LUG_MATH_API Affine3<double>;
+using Affine3d = Affine3<double>;
+
+// The transformation `rhs` then `lhs`, as the product of the 4x4 matrices
+template <typename T>
+constexpr Affine3<T> operator*(const Affine3<T>& lhs, const Affine3<T>& rhs);
+
+template <typename T>
+constexpr bool operator==(const Affine3<T>& lhs, const Affine3<T>& rhs);
+
+template <typename T>
+constexpr bool operator!=(const Affine3<T>& lhs, const Affine3<T>& rhs);
+
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const Affine3<T>& affine);
+
+#include <lug/Math/Affine3.inl>
+
+} // Math
+} // lug
@@ -0,0 +1,93 @@
+template <typename T>
+inline constexpr Affine3<T>::Affine3(const Matrix<3, 3, T>& linear, const Vector<3, T>& translation) : _linear(linear), _translation(translation) {}
+
+template <typename T>
+inline constexpr Affine3<T>::Affine3(const Matrix<4, 4, T>& matrix) :
+    _linear{
+        matrix(0, 0), matrix(0, 1), matrix(0, 2),
+        matrix(1, 0), matrix(1, 1), matrix(1, 2),
+        matrix(2, 0), matrix(2, 1), matrix(2, 2)
+    },
+    _translation{matrix(0, 3), matrix(1, 3), matrix(2, 3)} {}
+
+template <typename T>
+inline constexpr const Matrix<3, 3, T>& Affine3<T>::getLinear() const {
+    return _linear;
+}
+
+template <typename T>
+inline constexpr const Vector<3, T>& Affine3<T>::getTranslation() const {
+    return _translation;
+}
+
+template <typename T>
+inline constexpr Affine3<T> Affine3<T>::inverse() const {
+    // The inverse of x -> L * x + t is x -> L^-1 * x - L^-1 * t, with the closed form of the 3x3 inverse
+    const Matrix<3, 3, T> linear = _linear.inverse();
+
+    return {linear, -(linear * _translation)};
+}
+
+template <typename T>
+inline constexpr Vector<3, T> Affine3<T>::transformPoint(const Vector<3, T>& point) const {
+    return _linear * point + _translation;
+}
+
+template <typename T>
+inline constexpr Vector<3, T> Affine3<T>::transformDirection(const Vector<3, T>& direction) const {
+    return _linear * direction;
+}
+
+template <typename T>
+inline constexpr Matrix<4, 4, T> Affine3<T>::toMatrix() const {
+    return Matrix<4, 4, T> {
+        _linear(0, 0), _linear(0, 1), _linear(0, 2), _translation(0),
+        _linear(1, 0), _linear(1, 1), _linear(1, 2), _translation(1),
+        _linear(2, 0), _linear(2, 1), _linear(2, 2), _translation(2),
+        0, 0, 0, 1
+    };
+}
+
+template <typename T>
+inline constexpr Affine3<T> Affine3<T>::identity() {
+    return {Matrix<3, 3, T>::identity(), Vector<3, T>(0)};
+}
+
+template <typename T>
+inline constexpr Affine3<T> Affine3<T>::fromTRS(const Vector<3, T>& translation, const Quaternion<T>& rotation, const Vector<3, T>& scale) {
+    // The columns of the rotation scaled by the factors
+    const Matrix<4, 4, T> rotationMatrix = rotation.transform();
+
+    return {
+        Matrix<3, 3, T> {
+            rotationMatrix(0, 0) * scale(0), rotationMatrix(0, 1) * scale(1), rotationMatrix(0, 2) * scale(2),
+            rotationMatrix(1, 0) * scale(0), rotationMatrix(1, 1) * scale(1), rotationMatrix(1, 2) * scale(2),
+            rotationMatrix(2, 0) * scale(0), rotationMatrix(2, 1) * scale(1), rotationMatrix(2, 2) * scale(2)
+        },
+        translation
+    };
+}
+
+template <typename T>
+inline constexpr Affine3<T> operator*(const Affine3<T>& lhs, const Affine3<T>& rhs) {
+    return {
+        lhs.getLinear() * rhs.getLinear(),
+        lhs.getLinear() * rhs.getTranslation() + lhs.getTranslation()
+    };
+}
+
+template <typename T>
+inline constexpr bool operator==(const Affine3<T>& lhs, const Affine3<T>& rhs) {
+    return lhs.getLinear() == rhs.getLinear() && lhs.getTranslation() == rhs.getTranslation();
+}
+
+template <typename T>
+inline constexpr bool operator!=(const Affine3<T>& lhs, const Affine3<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T>
+inline std::ostream& operator<<(std::ostream& os, const Affine3<T>& affine) {
+    os << "{linear: " << affine.getLinear() << ", translation: " << affine.getTranslation() << "}";
+    return os;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <lug/Math/Export.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+
+// Structure of arrays view, the component `c` of the element `i` is at `data[c * stride + i]`
+// The kernels handle `Simd::Width` elements at once, with a stride multiple of it the components stay aligned
+template <typename T, size_t Components>
+class SoA {
+public:
+    SoA(T* data, size_t stride);
+
+    // A read-only view from a mutable one
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    SoA(const SoA<U, Components>& view);
+
+    SoA(const SoA<T, Components>&) = default;
+    SoA(SoA<T, Components>&&) = default;
+
+    SoA<T, Components>& operator=(const SoA<T, Components>&) = default;
+    SoA<T, Components>& operator=(SoA<T, Components>&&) = default;
+
+    ~SoA() = default;
+
+    T* operator[](size_t component) const;
+
+    T* getData() const;
+    size_t getStride() const;
+
+private:
+    T* _data;
+    size_t _stride;
+};
+
+// (x, y, z)
+template <typename T = float>
+using Vec3SoA = SoA<T, 3>;
+
+// (w, x, y, z), as Quaternion
+template <typename T = float>
+using QuatSoA = SoA<T, 4>;
+
+// Column-major, as Matrix: the component `col * 4 + row` is the value at (row, col)
+template <typename T = float>
+using Mat4x4SoA = SoA<T, 16>;
+
+// Access to one element
+LUG_MATH_API Vec3f getVector(const Vec3SoA<const float>& vectors, size_t index);
+LUG_MATH_API void setVector(const Vec3SoA<float>& vectors, size_t index, const Vec3f& vector);
+
+LUG_MATH_API Quatf getQuaternion(const QuatSoA<const float>& quaternions, size_t index);
+LUG_MATH_API void setQuaternion(const QuatSoA<float>& quaternions, size_t index, const Quatf& quaternion);
+
+LUG_MATH_API Mat4x4f getMatrix(const Mat4x4SoA<const float>& matrices, size_t index);
+LUG_MATH_API void setMatrix(const Mat4x4SoA<float>& matrices, size_t index, const Mat4x4f& matrix);
+
+// The kernels work on `count` elements, the results can be written over the inputs (element by element)
+
+// `matrix * points[i]`, as `Mat4x4f * Vec3f` (w is 1 and is dropped)
+LUG_MATH_API void transformPoints(const Mat4x4f& matrix, const Vec3SoA<const float>& points, const Vec3SoA<float>& result, size_t count);
+
+// `lhs[i] * rhs[i]`
+LUG_MATH_API void multiply(const Mat4x4SoA<const float>& lhs, const Mat4x4SoA<const float>& rhs, const Mat4x4SoA<float>& result, size_t count);
+
+// As Geometry::lookAt and Geometry::perspective
+LUG_MATH_API void lookAt(
+    const Vec3SoA<const float>& eyes,
+    const Vec3SoA<const float>& centers,
+    const Vec3SoA<const float>& ups,
+    const Mat4x4SoA<float>& result,
+    size_t count
+);
+
+LUG_MATH_API void perspective(
+    const float* fovys,
+    const float* aspects,
+    const float* zNears,
+    const float* zFars,
+    const Mat4x4SoA<float>& result,
+    size_t count
+);
+
+// As normalize(const Quaternion&)
+LUG_MATH_API void normalize(const QuatSoA<const float>& quaternions, const QuatSoA<float>& result, size_t count);
+
+#include <lug/Math/Batch.inl>
+
+} // Batch
+} // Math
+} // lug
@@ -0,0 +1,21 @@
+template <typename T, size_t Components>
+inline SoA<T, Components>::SoA(T* data, size_t stride) : _data{data}, _stride{stride} {}
+
+template <typename T, size_t Components>
+template <typename U, typename>
+inline SoA<T, Components>::SoA(const SoA<U, Components>& view) : _data{view.getData()}, _stride{view.getStride()} {}
+
+template <typename T, size_t Components>
+inline T* SoA<T, Components>::operator[](size_t component) const {
+    return _data + component * _stride;
+}
+
+template <typename T, size_t Components>
+inline T* SoA<T, Components>::getData() const {
+    return _data;
+}
+
+template <typename T, size_t Components>
+inline size_t SoA<T, Components>::getStride() const {
+    return _stride;
+}
@@ -8,79 +8,79 @@ namespace Math {
 // TODO: Add pi, etc
 
 template <typename T>
-T epsilon();
+constexpr T epsilon();
 
 template <typename T>
-T pi();
+constexpr T pi();
 
 template <typename T>
-T twoPi();
+constexpr T twoPi();
 
 template <typename T>
-T rootPi();
+constexpr T rootPi();
 
 template <typename T>
-T halfPi();
+constexpr T halfPi();
 
 template <typename T>
-T threeOverTwoPi();
+constexpr T threeOverTwoPi();
 
 template <typename T>
-T quarterPi();
+constexpr T quarterPi();
 
 template <typename T>
-T oneOverPi();
+constexpr T oneOverPi();
 
 template <typename T>
-T oneOverTwoPi();
+constexpr T oneOverTwoPi();
 
 template <typename T>
-T twoOverPi();
+constexpr T twoOverPi();
 
 template <typename T>
-T fourOverPi();
+constexpr T fourOverPi();
 
 template <typename T>
-T twoOverRootPi();
+constexpr T twoOverRootPi();
 
 template <typename T>
-T oneOverRootPi();
+constexpr T oneOverRootPi();
 
 template <typename T>
-T rootHalfPi();
+constexpr T rootHalfPi();
 
 template <typename T>
-T rootTwoPi();
+constexpr T rootTwoPi();
 
 template <typename T>
-T rootLnFour();
+constexpr T rootLnFour();
 
 template <typename T>
-T e();
+constexpr T e();
 
 template <typename T>
-T euler();
+constexpr T euler();
 
 template <typename T>
-T rootTwo();
+constexpr T rootTwo();
 
 template <typename T>
-T rootThree();
+constexpr T rootThree();
 
 template <typename T>
-T rootFive();
+constexpr T rootFive();
 
 template <typename T>
-T lnTwo();
+constexpr T lnTwo();
 
 template <typename T>
-T lnTen();
+constexpr T lnTen();
 
 template <typename T>
-T lnLnTwo();
+constexpr T lnLnTwo();
 
 template <typename T>
-T goldenRatio();
+constexpr T goldenRatio();
 
 #include <lug/Math/Constant.inl>
 
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Defined if the compiler tells whether a function is evaluated in a constant expression
+// Without it, the functions of lug::Math::Constexpr always call the std ones and can't be used in constant expressions
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define LUG_MATH_CONSTANT_EVALUATION
+    #endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+    #define LUG_MATH_CONSTANT_EVALUATION
+#endif
+
+#if !defined(LUG_MATH_CONSTANT_EVALUATION) && defined(_MSC_VER) && _MSC_VER >= 1925
+    #define LUG_MATH_CONSTANT_EVALUATION
+#endif
+
+namespace lug {
+namespace Math {
+namespace Constexpr {
+
+// Type of the result of `sqrt`, `sin`, ... : double for the integers, as the std functions
+template <typename T>
+using FloatingPoint = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+// True when evaluated in a constant expression, always false without LUG_MATH_CONSTANT_EVALUATION
+constexpr bool isConstantEvaluated();
+
+// The std functions aren't constexpr, these ones compute a series in a constant expression
+// and call the std functions at runtime
+template <typename T>
+constexpr FloatingPoint<T> sqrt(T value);
+
+template <typename T>
+constexpr FloatingPoint<T> sin(T radians);
+
+template <typename T>
+constexpr FloatingPoint<T> cos(T radians);
+
+template <typename T>
+constexpr FloatingPoint<T> tan(T radians);
+
+#include <lug/Math/Constexpr.inl>
+
+} // Constexpr
+} // Math
+} // lug
@@ -0,0 +1,99 @@
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+constexpr double Pi = 3.14159265358979323846264338327950288;
+
+inline constexpr double sqrt(double value) {
+    if (!(value > 0.0) || value == std::numeric_limits<double>::infinity()) {
+        return value == 0.0 || value == std::numeric_limits<double>::infinity() ? value : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    // Newton's method, stops when the estimation oscillates between two values
+    double current = value > 1.0 ? value : 1.0;
+    double previous = 0.0;
+
+    for (;;) {
+        const double next = 0.5 * (current + value / current);
+
+        if (next == current || next == previous) {
+            return next < current ? next : current;
+        }
+
+        previous = current;
+        current = next;
+    }
+}
+
+// Reduction in [-pi, pi]
+inline constexpr double reduceAngle(double radians) {
+    const double turns = radians / (2.0 * Pi);
+    const double wholeTurns = static_cast<double>(static_cast<long long>(turns < 0.0 ? turns - 0.5 : turns + 0.5));
+
+    return radians - wholeTurns * (2.0 * Pi);
+}
+
+// Taylor series, the terms become negligible before 30 terms in [-pi, pi]
+inline constexpr double sin(double radians) {
+    const double x = reduceAngle(radians);
+    const double squared = x * x;
+
+    double term = x;
+    double sum = x;
+
+    for (int n = 1; n < 30; ++n) {
+        term *= -squared / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+
+    return sum;
+}
+
+inline constexpr double cos(double radians) {
+    const double x = reduceAngle(radians);
+    const double squared = x * x;
+
+    double term = 1.0;
+    double sum = 1.0;
+
+    for (int n = 1; n < 30; ++n) {
+        term *= -squared / ((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+
+    return sum;
+}
+
+} // priv
+/**
+ * \endcond
+ */
+
+inline constexpr bool isConstantEvaluated() {
+#if defined(LUG_MATH_CONSTANT_EVALUATION)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+inline constexpr FloatingPoint<T> sqrt(T value) {
+    return isConstantEvaluated() ? FloatingPoint<T>(priv::sqrt(static_cast<double>(value))) : FloatingPoint<T>(std::sqrt(value));
+}
+
+template <typename T>
+inline constexpr FloatingPoint<T> sin(T radians) {
+    return isConstantEvaluated() ? FloatingPoint<T>(priv::sin(static_cast<double>(radians))) : FloatingPoint<T>(std::sin(radians));
+}
+
+template <typename T>
+inline constexpr FloatingPoint<T> cos(T radians) {
+    return isConstantEvaluated() ? FloatingPoint<T>(priv::cos(static_cast<double>(radians))) : FloatingPoint<T>(std::cos(radians));
+}
+
+template <typename T>
+inline constexpr FloatingPoint<T> tan(T radians) {
+    return isConstantEvaluated() ? FloatingPoint<T>(priv::sin(static_cast<double>(radians)) / priv::cos(static_cast<double>(radians))) : FloatingPoint<T>(std::tan(radians));
+}
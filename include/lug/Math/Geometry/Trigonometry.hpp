@@ -2,26 +2,28 @@
 
 #include <cmath>
 #include <limits>
+#include <lug/Math/Constexpr.hpp>
 
 namespace lug {
 namespace Math {
 namespace Geometry {
 
 template <typename T = double>
-T radians(T degrees);
+constexpr T radians(T degrees);
 
 template <typename T = double>
-T degrees(T radians);
+constexpr T degrees(T radians);
 
 template <typename T = double>
-T sin(T radians);
+constexpr T sin(T radians);
 
 template <typename T = double>
-T cos(T radians);
+constexpr T cos(T radians);
 
 template <typename T = double>
-T tan(T radians);
+constexpr T tan(T radians);
 
+// The inverse functions can't be used in constant expressions
 template <typename T = double>
 T asin(T radians);
 
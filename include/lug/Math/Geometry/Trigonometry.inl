@@ -1,28 +1,28 @@
 template <typename T>
-inline T radians(T degrees) {
+inline constexpr T radians(T degrees) {
     static_assert(std::numeric_limits<T>::is_iec559, "'radians' only accept floating-point input");
     return degrees * T(0.01745329251994329576923690768489);
 }
 
 template <typename T>
-inline T degrees(T radians) {
+inline constexpr T degrees(T radians) {
     static_assert(std::numeric_limits<T>::is_iec559, "'degrees' only accept floating-point input");
     return radians * T(57.295779513082320876798154814105);
 }
 
 template <typename T>
-inline T sin(T radians) {
-    return ::std::sin(radians);
+inline constexpr T sin(T radians) {
+    return T(::lug::Math::Constexpr::sin(radians));
 }
 
 template <typename T>
-inline T cos(T radians) {
-    return ::std::cos(radians);
+inline constexpr T cos(T radians) {
+    return T(::lug::Math::Constexpr::cos(radians));
 }
 
 template <typename T>
-inline T tan(T radians) {
-    return ::std::tan(radians);
+inline constexpr T tan(T radians) {
+    return T(::lug::Math::Constexpr::tan(radians));
 }
 
 template <typename T>
@@ -1,16 +1,58 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 #include <valarray>
+#include <lug/Math/Constexpr.hpp>
 #include <lug/Math/Export.hpp>
+#include <lug/Math/Simd.hpp>
 #include <lug/Math/ValArray.hpp>
 #include <lug/System/Debug.hpp>
 
 namespace lug {
 namespace Math {
 
+template <uint8_t Rows, uint8_t Columns, typename T>
+class Matrix;
+
+// Base of the matrices and of the element-wise expressions on them (see ValArrayExpression in lug/Math/ValArray.hpp)
+// The sums, differences, negations and scalar operations are evaluated in a single loop when assigned to a Matrix
+// The products stay eager, they are not element-wise
+template <typename Expression, uint8_t Rows, uint8_t Columns, typename T>
+class MatrixExpression {
+public:
+    constexpr const Expression& getExpression() const;
+
+    // Evaluate the expression in a Matrix, e.g. `(a + b).inverse()`, Matrix hides them with its own
+    template <typename Evaluated = Matrix<Rows, Columns, T>>
+    constexpr auto inverse() const -> decltype(std::declval<const Evaluated&>().inverse());
+
+    constexpr Matrix<Columns, Rows, T> transpose() const;
+
+    template <typename Evaluated = Matrix<Rows, Columns, T>>
+    constexpr auto det() const -> decltype(std::declval<const Evaluated&>().det());
+};
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+class MatrixOperation;
+
+// Not constexpr, so a bad initializer list is also an error in a constant expression
+inline void assertBadInitializerList() {
+    LUG_ASSERT(false, "Matrix construct with bad size initializer list");
+}
+
+} // priv
+/**
+ * \endcond
+ */
+
 template <uint8_t Rows, uint8_t Columns, typename T = float>
-class Matrix {
+class Matrix : public MatrixExpression<Matrix<Rows, Columns, T>, Rows, Columns, T> {
 public:
     // TODO: Use custom valarray with compile time size
     using Values = ValArray<Rows * Columns, T>;
@@ -18,15 +60,22 @@ public:
 public:
     constexpr Matrix() = default;
 
-    explicit Matrix(T value);
-    Matrix(const Values& values);
-    Matrix(std::initializer_list<T> list);
+    explicit constexpr Matrix(T value);
+    constexpr Matrix(const Values& values);
+    constexpr Matrix(std::initializer_list<T> list);
     Matrix(const Matrix<Rows, Columns, T>& matrix) = default;
     Matrix(Matrix<Rows, Columns, T>&& matrix) = default;
 
+    // Evaluation of an expression (we want non explicit conversion)
+    template <typename OperationValues>
+    constexpr Matrix(const priv::MatrixOperation<OperationValues, Rows, Columns, T>& operation);
+
     Matrix<Rows, Columns, T>& operator=(const Matrix<Rows, Columns, T>& rhs) = default;
     Matrix<Rows, Columns, T>& operator=(Matrix<Rows, Columns, T>&& rhs) = default;
 
+    template <typename OperationValues>
+    Matrix<Rows, Columns, T>& operator=(const priv::MatrixOperation<OperationValues, Rows, Columns, T>& operation);
+
     ~Matrix() = default;
 
     constexpr uint8_t getRows() const;
@@ -69,48 +118,48 @@ public:
 #if defined(LUG_COMPILER_MSVC)
 
     template <typename = typename std::enable_if<(Rows == 1)>::type>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
     template <typename = typename std::enable_if<(Rows == 2)>::type, typename = void>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
     template <typename = typename std::enable_if<(Rows == 3)>::type, typename = void, typename = void>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
     template <typename = typename std::enable_if<(Rows == 4)>::type, typename = void, typename = void, typename = void>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
 #else
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 4) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 4) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
 #endif
 
-    Matrix<Columns, Rows, T> transpose() const;
+    constexpr Matrix<Columns, Rows, T> transpose() const;
 
 #if defined(LUG_COMPILER_MSVC)
 
     template <typename = typename std::enable_if<(Rows == 1)>::type>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows == 2)>::type, typename = void>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows == 3)>::type, typename = void, typename = void>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows == 4)>::type, typename = void, typename = void, typename = void>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows > 4)>::type, typename = void, typename = void, typename = void, typename = void>
     T det() const;
@@ -118,16 +167,16 @@ public:
 #else
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 1) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 1) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 2) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 2) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 3) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 3) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 4) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 4) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
     typename std::enable_if<(Rows > 4) && EnableBool, T>::type det() const;
@@ -137,12 +186,12 @@ public:
 #if defined(LUG_COMPILER_MSVC)
 
     template <typename = typename std::enable_if<(Rows == Columns)>::type>
-    static Matrix<Rows, Columns, T> identity();
+    static constexpr Matrix<Rows, Columns, T> identity();
 
 #else
 
     template <bool EnableBool = true>
-    static typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type identity();
+    static constexpr typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type identity();
 
 #endif
 
@@ -178,57 +227,159 @@ DEFINE_LENGTH_MATRIX(4, 4)
 
 #undef DEFINE_LENGTH_MATRIX
 
-// Unary operations
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs);
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
 
-// Matrix/Scalar operations
+// The generic versions, overloaded for the float 4x4 matrices with the SIMD kernels of lug/Math/Simd.hpp
+// The overloads use the generic versions in constant expressions
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, T rhs);
+constexpr Matrix<Columns, Rows, T> transpose(const Matrix<Rows, Columns, T>& matrix);
+constexpr Matrix<4, 4, float> transpose(const Matrix<4, 4, float>& matrix);
+Matrix<4, 4, float> transposeSimd(const Matrix<4, 4, float>& matrix);
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, T rhs);
+template <typename T>
+constexpr Matrix<4, 4, T> inverse(const Matrix<4, 4, T>& matrix);
+constexpr Matrix<4, 4, float> inverse(const Matrix<4, 4, float>& matrix);
+Matrix<4, 4, float> inverseSimd(const Matrix<4, 4, float>& matrix);
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator*(const Matrix<Rows, Columns, T>& lhs, T rhs);
+Matrix<4, 4, float> multiplySimd(const Matrix<4, 4, float>& lhs, const Matrix<4, 4, float>& rhs);
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator/(const Matrix<Rows, Columns, T>& lhs, T rhs);
+// Element-wise operation, `OperationValues` is the expression on the values
+// The matrices are held by reference, an operation must not outlive its operands
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+class MatrixOperation : public MatrixExpression<MatrixOperation<OperationValues, Rows, Columns, T>, Rows, Columns, T> {
+public:
+    using Values = OperationValues;
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator+(T lhs, const Matrix<Rows, Columns, T>& rhs);
+public:
+    explicit constexpr MatrixOperation(const Values& values);
+
+    constexpr uint8_t getRows() const;
+    constexpr uint8_t getColumns() const;
+
+    constexpr const Values& getValues() const;
+
+    constexpr T operator()(uint8_t row, uint8_t col = 0) const;
+
+private:
+    Values _values;
+};
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename OperationValues>
+constexpr MatrixOperation<OperationValues, Rows, Columns, T> makeMatrixOperation(const OperationValues& values);
 
+// The values of the matrices built without writing in them, usable in constant expressions
+// The initializer lists are given row by row
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(T lhs, const Matrix<Rows, Columns, T>& rhs);
+class MatrixList : public ValArrayExpression<MatrixList<Rows, Columns, T>, Rows * Columns, T> {
+public:
+    explicit constexpr MatrixList(std::initializer_list<T> list);
+
+    constexpr T operator[](size_t pos) const;
+
+private:
+    std::initializer_list<T> _list;
+};
+
+template <uint8_t Rows, typename T>
+class MatrixIdentity : public ValArrayExpression<MatrixIdentity<Rows, T>, Rows * Rows, T> {
+public:
+    constexpr T operator[](size_t pos) const;
+};
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator*(T lhs, const Matrix<Rows, Columns, T>& rhs);
+class MatrixTransposition : public ValArrayExpression<MatrixTransposition<Rows, Columns, T>, Rows * Columns, T> {
+public:
+    explicit constexpr MatrixTransposition(const Matrix<Rows, Columns, T>& matrix);
+
+    constexpr T operator[](size_t pos) const;
 
+private:
+    const Matrix<Rows, Columns, T>& _matrix;
+};
+
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t ColumnsRight, typename T>
+class MatrixProduct : public ValArrayExpression<MatrixProduct<RowsLeft, ColumnsLeft, ColumnsRight, T>, RowsLeft * ColumnsRight, T> {
+public:
+    constexpr MatrixProduct(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<ColumnsLeft, ColumnsRight, T>& rhs);
+
+    constexpr T operator[](size_t pos) const;
+
+private:
+    const Matrix<RowsLeft, ColumnsLeft, T>& _lhs;
+    const Matrix<ColumnsLeft, ColumnsRight, T>& _rhs;
+};
+
+// The scalar operand of an operation
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator/(T lhs, const Matrix<Rows, Columns, T>& rhs);
+struct MatrixScalar {
+    using Values = ValArrayScalar<Rows * Columns, T>;
+};
+
+template <typename Lhs, typename Rhs, typename Operator, uint8_t Rows, uint8_t Columns, typename T>
+using MatrixBinaryOperation = MatrixOperation<ValArrayOperation<typename Lhs::Values, typename Rhs::Values, Operator, Rows * Columns, T>, Rows, Columns, T>;
+
+} // priv
+/**
+ * \endcond
+ */
+
+// Unary operations
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Lhs, priv::Subtract, Rows, Columns, T> operator-(const MatrixExpression<Lhs, Rows, Columns, T>& lhs);
+
+// Matrix/Scalar operations
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Add, Rows, Columns, T> operator+(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Subtract, Rows, Columns, T> operator-(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Multiply, Rows, Columns, T> operator*(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Divide, Rows, Columns, T> operator/(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Add, Rows, Columns, T> operator+(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Subtract, Rows, Columns, T> operator-(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Multiply, Rows, Columns, T> operator*(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Divide, Rows, Columns, T> operator/(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
 
 // Matrix/Matrix operation
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+constexpr priv::MatrixBinaryOperation<Lhs, Rhs, priv::Add, Rows, Columns, T> operator+(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+constexpr priv::MatrixBinaryOperation<Lhs, Rhs, priv::Subtract, Rows, Columns, T> operator-(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
 
-template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T>
-Matrix<RowsLeft, ColumnsRight, T> operator*(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<RowsRight, ColumnsRight, T>& rhs);
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T, typename Lhs, typename Rhs>
+constexpr Matrix<RowsLeft, ColumnsRight, T> operator*(const MatrixExpression<Lhs, RowsLeft, ColumnsLeft, T>& lhs, const MatrixExpression<Rhs, RowsRight, ColumnsRight, T>& rhs);
 
-template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T>
-Matrix<RowsLeft, ColumnsRight, T> operator/(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<RowsRight, ColumnsRight, T>& rhs);
+// SIMD version
+constexpr Matrix<4, 4, float> operator*(const Matrix<4, 4, float>& lhs, const Matrix<4, 4, float>& rhs);
+
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T, typename Lhs, typename Rhs>
+constexpr Matrix<RowsLeft, ColumnsRight, T> operator/(const MatrixExpression<Lhs, RowsLeft, ColumnsLeft, T>& lhs, const MatrixExpression<Rhs, RowsRight, ColumnsRight, T>& rhs);
 
 // Comparaison operators
-template <uint8_t Rows, uint8_t Columns, typename T>
-bool operator==(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+constexpr bool operator==(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-bool operator!=(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+constexpr bool operator!=(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs);
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-std::ostream& operator<<(std::ostream& os, const Matrix<Rows, Columns, T>& matrix);
+template <uint8_t Rows, uint8_t Columns, typename T, typename Expression>
+std::ostream& operator<<(std::ostream& os, const MatrixExpression<Expression, Rows, Columns, T>& expression);
 
 #include <lug/Math/Matrix.inl>
 
@@ -1,29 +1,48 @@
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T>::Matrix(T value) : _values(Rows * Columns) {
-    static_assert(std::is_arithmetic<T>::value, "Can't construct matrix with non integral type");
+template <typename Expression, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr const Expression& MatrixExpression<Expression, Rows, Columns, T>::getExpression() const {
+    return static_cast<const Expression&>(*this);
+}
 
-    for (uint8_t row = 0; row < Rows; ++row) {
-        for (uint8_t col = 0; col < Columns; ++col) {
-            (*this)(row, col) = value;
-        }
-    }
+template <typename Expression, uint8_t Rows, uint8_t Columns, typename T>
+template <typename Evaluated>
+inline constexpr auto MatrixExpression<Expression, Rows, Columns, T>::inverse() const -> decltype(std::declval<const Evaluated&>().inverse()) {
+    return Evaluated(getExpression()).inverse();
+}
+
+template <typename Expression, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr Matrix<Columns, Rows, T> MatrixExpression<Expression, Rows, Columns, T>::transpose() const {
+    return Matrix<Rows, Columns, T>(getExpression()).transpose();
+}
+
+template <typename Expression, uint8_t Rows, uint8_t Columns, typename T>
+template <typename Evaluated>
+inline constexpr auto MatrixExpression<Expression, Rows, Columns, T>::det() const -> decltype(std::declval<const Evaluated&>().det()) {
+    return Evaluated(getExpression()).det();
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T>::Matrix(const Values& values) : _values{values} {
-    LUG_ASSERT(values.size() == Rows * Columns, "Matrix construct with bad size initializer list");
+inline constexpr Matrix<Rows, Columns, T>::Matrix(T value) : _values(value) {
+    static_assert(std::is_arithmetic<T>::value, "Can't construct matrix with non integral type");
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T>::Matrix(std::initializer_list<T> list) {
-    LUG_ASSERT(list.size() == Rows * Columns, "Matrix construct with bad size initializer list");
+inline constexpr Matrix<Rows, Columns, T>::Matrix(const Values& values) : _values{values} {}
 
-    auto it = std::begin(list);
-    for (uint8_t row = 0; row < Rows; ++row) {
-        for (uint8_t col = 0; col < Columns; ++col) {
-            (*this)(row, col) = *it;
-            it++;
-        }
+template <uint8_t Rows, uint8_t Columns, typename T>
+template <typename OperationValues>
+inline constexpr Matrix<Rows, Columns, T>::Matrix(const priv::MatrixOperation<OperationValues, Rows, Columns, T>& operation) : _values(operation.getValues()) {}
+
+template <uint8_t Rows, uint8_t Columns, typename T>
+template <typename OperationValues>
+inline Matrix<Rows, Columns, T>& Matrix<Rows, Columns, T>::operator=(const priv::MatrixOperation<OperationValues, Rows, Columns, T>& operation) {
+    _values = operation.getValues();
+    return *this;
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr Matrix<Rows, Columns, T>::Matrix(std::initializer_list<T> list) : _values(priv::MatrixList<Rows, Columns, T>(list)) {
+    if (list.size() != Rows * Columns) {
+        priv::assertBadInitializerList();
     }
 }
 
@@ -133,10 +152,10 @@ inline typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Col
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
@@ -146,10 +165,10 @@ inline typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
@@ -164,10 +183,10 @@ inline typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
@@ -189,165 +208,29 @@ inline typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename, typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 4) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 4) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
-    return (1 / det()) * Matrix<Rows, Columns, T>{
-        // 11
-          (*this)(1, 1) * (*this)(2, 2) * (*this)(3, 3)
-        + (*this)(1, 2) * (*this)(2, 3) * (*this)(3, 1)
-        + (*this)(1, 3) * (*this)(2, 1) * (*this)(3, 2)
-        - (*this)(1, 1) * (*this)(2, 3) * (*this)(3, 2)
-        - (*this)(1, 2) * (*this)(2, 1) * (*this)(3, 3)
-        - (*this)(1, 3) * (*this)(2, 2) * (*this)(3, 1),
-
-        // 12
-          (*this)(0, 1) * (*this)(2, 3) * (*this)(3, 2)
-        + (*this)(0, 2) * (*this)(2, 1) * (*this)(3, 3)
-        + (*this)(0, 3) * (*this)(2, 2) * (*this)(3, 1)
-        - (*this)(0, 1) * (*this)(2, 2) * (*this)(3, 3)
-        - (*this)(0, 2) * (*this)(2, 3) * (*this)(3, 1)
-        - (*this)(0, 3) * (*this)(2, 1) * (*this)(3, 2),
-
-        // 13
-          (*this)(0, 1) * (*this)(1, 2) * (*this)(3, 3)
-        + (*this)(0, 2) * (*this)(1, 3) * (*this)(3, 1)
-        + (*this)(0, 3) * (*this)(1, 1) * (*this)(3, 2)
-        - (*this)(0, 1) * (*this)(1, 3) * (*this)(3, 2)
-        - (*this)(0, 2) * (*this)(1, 1) * (*this)(3, 3)
-        - (*this)(0, 3) * (*this)(1, 2) * (*this)(3, 1),
-
-        // 14
-          (*this)(0, 1) * (*this)(1, 3) * (*this)(2, 2)
-        + (*this)(0, 2) * (*this)(1, 1) * (*this)(2, 3)
-        + (*this)(0, 3) * (*this)(1, 2) * (*this)(2, 1)
-        - (*this)(0, 1) * (*this)(1, 2) * (*this)(2, 3)
-        - (*this)(0, 2) * (*this)(1, 3) * (*this)(2, 1)
-        - (*this)(0, 3) * (*this)(1, 1) * (*this)(2, 2),
-
-        // 21
-          (*this)(1, 0) * (*this)(2, 3) * (*this)(3, 2)
-        + (*this)(1, 2) * (*this)(2, 0) * (*this)(3, 3)
-        + (*this)(1, 3) * (*this)(2, 2) * (*this)(3, 0)
-        - (*this)(1, 0) * (*this)(2, 2) * (*this)(3, 3)
-        - (*this)(1, 2) * (*this)(2, 3) * (*this)(3, 0)
-        - (*this)(1, 3) * (*this)(2, 0) * (*this)(3, 2),
-
-        // 22
-          (*this)(0, 0) * (*this)(2, 2) * (*this)(3, 3)
-        + (*this)(0, 2) * (*this)(2, 3) * (*this)(3, 0)
-        + (*this)(0, 3) * (*this)(2, 0) * (*this)(3, 2)
-        - (*this)(0, 0) * (*this)(2, 3) * (*this)(3, 2)
-        - (*this)(0, 2) * (*this)(2, 0) * (*this)(3, 3)
-        - (*this)(0, 3) * (*this)(2, 2) * (*this)(3, 0),
-
-        // 23
-          (*this)(0, 0) * (*this)(1, 3) * (*this)(3, 2)
-        + (*this)(0, 2) * (*this)(1, 0) * (*this)(3, 3)
-        + (*this)(0, 3) * (*this)(1, 2) * (*this)(3, 0)
-        - (*this)(0, 0) * (*this)(1, 2) * (*this)(3, 3)
-        - (*this)(0, 2) * (*this)(1, 3) * (*this)(3, 0)
-        - (*this)(0, 3) * (*this)(1, 0) * (*this)(3, 2),
-
-        // 24
-          (*this)(0, 0) * (*this)(1, 2) * (*this)(2, 3)
-        + (*this)(0, 2) * (*this)(1, 3) * (*this)(2, 0)
-        + (*this)(0, 3) * (*this)(1, 0) * (*this)(2, 2)
-        - (*this)(0, 0) * (*this)(1, 3) * (*this)(2, 2)
-        - (*this)(0, 2) * (*this)(1, 0) * (*this)(2, 3)
-        - (*this)(0, 3) * (*this)(1, 2) * (*this)(2, 0),
-
-        // 31
-          (*this)(1, 0) * (*this)(2, 1) * (*this)(3, 3)
-        + (*this)(1, 1) * (*this)(2, 3) * (*this)(3, 0)
-        + (*this)(1, 3) * (*this)(2, 0) * (*this)(3, 1)
-        - (*this)(1, 0) * (*this)(2, 3) * (*this)(3, 1)
-        - (*this)(1, 1) * (*this)(2, 0) * (*this)(3, 3)
-        - (*this)(1, 3) * (*this)(2, 1) * (*this)(3, 0),
-
-        // 32
-          (*this)(0, 0) * (*this)(2, 3) * (*this)(3, 1)
-        + (*this)(0, 1) * (*this)(2, 0) * (*this)(3, 3)
-        + (*this)(0, 3) * (*this)(2, 1) * (*this)(3, 0)
-        - (*this)(0, 0) * (*this)(2, 1) * (*this)(3, 3)
-        - (*this)(0, 1) * (*this)(2, 3) * (*this)(3, 0)
-        - (*this)(0, 3) * (*this)(2, 0) * (*this)(3, 1),
-
-        // 33
-          (*this)(0, 0) * (*this)(1, 1) * (*this)(3, 3)
-        + (*this)(0, 1) * (*this)(1, 3) * (*this)(3, 0)
-        + (*this)(0, 3) * (*this)(1, 0) * (*this)(3, 1)
-        - (*this)(0, 0) * (*this)(1, 3) * (*this)(3, 1)
-        - (*this)(0, 1) * (*this)(1, 0) * (*this)(3, 3)
-        - (*this)(0, 3) * (*this)(1, 1) * (*this)(3, 0),
-
-        // 34
-          (*this)(0, 0) * (*this)(1, 3) * (*this)(2, 1)
-        + (*this)(0, 1) * (*this)(1, 0) * (*this)(2, 3)
-        + (*this)(0, 3) * (*this)(1, 1) * (*this)(2, 0)
-        - (*this)(0, 0) * (*this)(1, 1) * (*this)(2, 3)
-        - (*this)(0, 1) * (*this)(1, 3) * (*this)(2, 0)
-        - (*this)(0, 3) * (*this)(1, 0) * (*this)(2, 1),
-
-        // 41
-          (*this)(1, 0) * (*this)(2, 2) * (*this)(3, 1)
-        + (*this)(1, 1) * (*this)(2, 0) * (*this)(3, 2)
-        + (*this)(1, 2) * (*this)(2, 1) * (*this)(3, 0)
-        - (*this)(1, 0) * (*this)(2, 1) * (*this)(3, 2)
-        - (*this)(1, 1) * (*this)(2, 2) * (*this)(3, 0)
-        - (*this)(1, 2) * (*this)(2, 0) * (*this)(3, 1),
-
-        // 42
-          (*this)(0, 0) * (*this)(2, 1) * (*this)(3, 2)
-        + (*this)(0, 1) * (*this)(2, 2) * (*this)(3, 0)
-        + (*this)(0, 2) * (*this)(2, 0) * (*this)(3, 1)
-        - (*this)(0, 0) * (*this)(2, 2) * (*this)(3, 1)
-        - (*this)(0, 1) * (*this)(2, 0) * (*this)(3, 2)
-        - (*this)(0, 2) * (*this)(2, 1) * (*this)(3, 0),
-
-        // 43
-          (*this)(0, 0) * (*this)(1, 2) * (*this)(3, 1)
-        + (*this)(0, 1) * (*this)(1, 0) * (*this)(3, 2)
-        + (*this)(0, 2) * (*this)(1, 1) * (*this)(3, 0)
-        - (*this)(0, 0) * (*this)(1, 1) * (*this)(3, 2)
-        - (*this)(0, 1) * (*this)(1, 2) * (*this)(3, 0)
-        - (*this)(0, 2) * (*this)(1, 0) * (*this)(3, 1),
-
-        // 44
-          (*this)(0, 0) * (*this)(1, 1) * (*this)(2, 2)
-        + (*this)(0, 1) * (*this)(1, 2) * (*this)(2, 0)
-        + (*this)(0, 2) * (*this)(1, 0) * (*this)(2, 1)
-        - (*this)(0, 0) * (*this)(1, 2) * (*this)(2, 1)
-        - (*this)(0, 1) * (*this)(1, 0) * (*this)(2, 2)
-        - (*this)(0, 2) * (*this)(1, 1) * (*this)(2, 0)
-    };
+    return priv::inverse(*this);
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Columns, Rows, T> Matrix<Rows, Columns, T>::transpose() const {
-    Matrix<Columns, Rows, T> transposeMatrix(0);
-
-    for (uint8_t row = 0; row < Rows; ++row) {
-        for (uint8_t col = 0; col < Columns; ++col) {
-            transposeMatrix(col, row) = (*this)(row, col);
-        }
-    }
-
-    return transposeMatrix;
+inline constexpr Matrix<Columns, Rows, T> Matrix<Rows, Columns, T>::transpose() const {
+    return priv::transpose(*this);
 }
 
 
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 1) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 1) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -357,10 +240,10 @@ inline typename std::enable_if<(Rows == 1) && EnableBool, T>::type Matrix<Rows,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 2) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 2) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -373,10 +256,10 @@ inline typename std::enable_if<(Rows == 2) && EnableBool, T>::type Matrix<Rows,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 3) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 3) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -393,10 +276,10 @@ inline typename std::enable_if<(Rows == 3) && EnableBool, T>::type Matrix<Rows,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename, typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 4) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 4) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -477,130 +360,369 @@ typename std::enable_if<(Rows > 4) && EnableBool, T>::type Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::identity()
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::identity()
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::identity()
+inline constexpr typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::identity()
 #endif
 {
     static_assert(Rows == Columns, "The identity matrix has to be a square matrix");
 
-    Matrix<Rows, Columns, T> matrix(0);
+    return priv::makeMatrixOperation<Rows, Columns, T>(priv::MatrixIdentity<Rows, T>());
+}
 
-    for (uint8_t i = 0; i < Rows; ++i) {
-        matrix(i, i) = 1;
-    }
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
 
-    return matrix;
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr Matrix<Columns, Rows, T> transpose(const Matrix<Rows, Columns, T>& matrix) {
+    return makeMatrixOperation<Columns, Rows, T>(MatrixTransposition<Rows, Columns, T>(matrix));
 }
 
-// Unary operations
-template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs) {
-    return T(0) - lhs;
+inline constexpr Matrix<4, 4, float> transpose(const Matrix<4, 4, float>& matrix) {
+    return Constexpr::isConstantEvaluated() ? transpose<4, 4, float>(matrix) : transposeSimd(matrix);
 }
 
-// Matrix/Scalar operations
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, T rhs) {
-    return Matrix<Rows, Columns, T>(lhs.getValues() + rhs);
+inline Matrix<4, 4, float> transposeSimd(const Matrix<4, 4, float>& matrix) {
+    Matrix<4, 4, float> transposeMatrix;
+
+    Simd::transposeMatrix4(matrix.getValues().data().data(), transposeMatrix.getValues().data().data());
+
+    return transposeMatrix;
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, T rhs) {
-    return Matrix<Rows, Columns, T>(lhs.getValues() - rhs);
+template <typename T>
+inline constexpr Matrix<4, 4, T> inverse(const Matrix<4, 4, T>& matrix) {
+    return (1 / matrix.det()) * Matrix<4, 4, T>{
+        // 11
+          matrix(1, 1) * matrix(2, 2) * matrix(3, 3)
+        + matrix(1, 2) * matrix(2, 3) * matrix(3, 1)
+        + matrix(1, 3) * matrix(2, 1) * matrix(3, 2)
+        - matrix(1, 1) * matrix(2, 3) * matrix(3, 2)
+        - matrix(1, 2) * matrix(2, 1) * matrix(3, 3)
+        - matrix(1, 3) * matrix(2, 2) * matrix(3, 1),
+
+        // 12
+          matrix(0, 1) * matrix(2, 3) * matrix(3, 2)
+        + matrix(0, 2) * matrix(2, 1) * matrix(3, 3)
+        + matrix(0, 3) * matrix(2, 2) * matrix(3, 1)
+        - matrix(0, 1) * matrix(2, 2) * matrix(3, 3)
+        - matrix(0, 2) * matrix(2, 3) * matrix(3, 1)
+        - matrix(0, 3) * matrix(2, 1) * matrix(3, 2),
+
+        // 13
+          matrix(0, 1) * matrix(1, 2) * matrix(3, 3)
+        + matrix(0, 2) * matrix(1, 3) * matrix(3, 1)
+        + matrix(0, 3) * matrix(1, 1) * matrix(3, 2)
+        - matrix(0, 1) * matrix(1, 3) * matrix(3, 2)
+        - matrix(0, 2) * matrix(1, 1) * matrix(3, 3)
+        - matrix(0, 3) * matrix(1, 2) * matrix(3, 1),
+
+        // 14
+          matrix(0, 1) * matrix(1, 3) * matrix(2, 2)
+        + matrix(0, 2) * matrix(1, 1) * matrix(2, 3)
+        + matrix(0, 3) * matrix(1, 2) * matrix(2, 1)
+        - matrix(0, 1) * matrix(1, 2) * matrix(2, 3)
+        - matrix(0, 2) * matrix(1, 3) * matrix(2, 1)
+        - matrix(0, 3) * matrix(1, 1) * matrix(2, 2),
+
+        // 21
+          matrix(1, 0) * matrix(2, 3) * matrix(3, 2)
+        + matrix(1, 2) * matrix(2, 0) * matrix(3, 3)
+        + matrix(1, 3) * matrix(2, 2) * matrix(3, 0)
+        - matrix(1, 0) * matrix(2, 2) * matrix(3, 3)
+        - matrix(1, 2) * matrix(2, 3) * matrix(3, 0)
+        - matrix(1, 3) * matrix(2, 0) * matrix(3, 2),
+
+        // 22
+          matrix(0, 0) * matrix(2, 2) * matrix(3, 3)
+        + matrix(0, 2) * matrix(2, 3) * matrix(3, 0)
+        + matrix(0, 3) * matrix(2, 0) * matrix(3, 2)
+        - matrix(0, 0) * matrix(2, 3) * matrix(3, 2)
+        - matrix(0, 2) * matrix(2, 0) * matrix(3, 3)
+        - matrix(0, 3) * matrix(2, 2) * matrix(3, 0),
+
+        // 23
+          matrix(0, 0) * matrix(1, 3) * matrix(3, 2)
+        + matrix(0, 2) * matrix(1, 0) * matrix(3, 3)
+        + matrix(0, 3) * matrix(1, 2) * matrix(3, 0)
+        - matrix(0, 0) * matrix(1, 2) * matrix(3, 3)
+        - matrix(0, 2) * matrix(1, 3) * matrix(3, 0)
+        - matrix(0, 3) * matrix(1, 0) * matrix(3, 2),
+
+        // 24
+          matrix(0, 0) * matrix(1, 2) * matrix(2, 3)
+        + matrix(0, 2) * matrix(1, 3) * matrix(2, 0)
+        + matrix(0, 3) * matrix(1, 0) * matrix(2, 2)
+        - matrix(0, 0) * matrix(1, 3) * matrix(2, 2)
+        - matrix(0, 2) * matrix(1, 0) * matrix(2, 3)
+        - matrix(0, 3) * matrix(1, 2) * matrix(2, 0),
+
+        // 31
+          matrix(1, 0) * matrix(2, 1) * matrix(3, 3)
+        + matrix(1, 1) * matrix(2, 3) * matrix(3, 0)
+        + matrix(1, 3) * matrix(2, 0) * matrix(3, 1)
+        - matrix(1, 0) * matrix(2, 3) * matrix(3, 1)
+        - matrix(1, 1) * matrix(2, 0) * matrix(3, 3)
+        - matrix(1, 3) * matrix(2, 1) * matrix(3, 0),
+
+        // 32
+          matrix(0, 0) * matrix(2, 3) * matrix(3, 1)
+        + matrix(0, 1) * matrix(2, 0) * matrix(3, 3)
+        + matrix(0, 3) * matrix(2, 1) * matrix(3, 0)
+        - matrix(0, 0) * matrix(2, 1) * matrix(3, 3)
+        - matrix(0, 1) * matrix(2, 3) * matrix(3, 0)
+        - matrix(0, 3) * matrix(2, 0) * matrix(3, 1),
+
+        // 33
+          matrix(0, 0) * matrix(1, 1) * matrix(3, 3)
+        + matrix(0, 1) * matrix(1, 3) * matrix(3, 0)
+        + matrix(0, 3) * matrix(1, 0) * matrix(3, 1)
+        - matrix(0, 0) * matrix(1, 3) * matrix(3, 1)
+        - matrix(0, 1) * matrix(1, 0) * matrix(3, 3)
+        - matrix(0, 3) * matrix(1, 1) * matrix(3, 0),
+
+        // 34
+          matrix(0, 0) * matrix(1, 3) * matrix(2, 1)
+        + matrix(0, 1) * matrix(1, 0) * matrix(2, 3)
+        + matrix(0, 3) * matrix(1, 1) * matrix(2, 0)
+        - matrix(0, 0) * matrix(1, 1) * matrix(2, 3)
+        - matrix(0, 1) * matrix(1, 3) * matrix(2, 0)
+        - matrix(0, 3) * matrix(1, 0) * matrix(2, 1),
+
+        // 41
+          matrix(1, 0) * matrix(2, 2) * matrix(3, 1)
+        + matrix(1, 1) * matrix(2, 0) * matrix(3, 2)
+        + matrix(1, 2) * matrix(2, 1) * matrix(3, 0)
+        - matrix(1, 0) * matrix(2, 1) * matrix(3, 2)
+        - matrix(1, 1) * matrix(2, 2) * matrix(3, 0)
+        - matrix(1, 2) * matrix(2, 0) * matrix(3, 1),
+
+        // 42
+          matrix(0, 0) * matrix(2, 1) * matrix(3, 2)
+        + matrix(0, 1) * matrix(2, 2) * matrix(3, 0)
+        + matrix(0, 2) * matrix(2, 0) * matrix(3, 1)
+        - matrix(0, 0) * matrix(2, 2) * matrix(3, 1)
+        - matrix(0, 1) * matrix(2, 0) * matrix(3, 2)
+        - matrix(0, 2) * matrix(2, 1) * matrix(3, 0),
+
+        // 43
+          matrix(0, 0) * matrix(1, 2) * matrix(3, 1)
+        + matrix(0, 1) * matrix(1, 0) * matrix(3, 2)
+        + matrix(0, 2) * matrix(1, 1) * matrix(3, 0)
+        - matrix(0, 0) * matrix(1, 1) * matrix(3, 2)
+        - matrix(0, 1) * matrix(1, 2) * matrix(3, 0)
+        - matrix(0, 2) * matrix(1, 0) * matrix(3, 1),
+
+        // 44
+          matrix(0, 0) * matrix(1, 1) * matrix(2, 2)
+        + matrix(0, 1) * matrix(1, 2) * matrix(2, 0)
+        + matrix(0, 2) * matrix(1, 0) * matrix(2, 1)
+        - matrix(0, 0) * matrix(1, 2) * matrix(2, 1)
+        - matrix(0, 1) * matrix(1, 0) * matrix(2, 2)
+        - matrix(0, 2) * matrix(1, 1) * matrix(2, 0)
+    };
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator*(const Matrix<Rows, Columns, T>& lhs, T rhs) {
-    return Matrix<Rows, Columns, T>(lhs.getValues() * rhs);
+inline constexpr Matrix<4, 4, float> inverse(const Matrix<4, 4, float>& matrix) {
+    return Constexpr::isConstantEvaluated() ? inverse<float>(matrix) : inverseSimd(matrix);
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline  Matrix<Rows, Columns, T> operator/(const Matrix<Rows, Columns, T>& lhs, T rhs) {
-    return Matrix<Rows, Columns, T>(lhs.getValues() / rhs);
+inline Matrix<4, 4, float> inverseSimd(const Matrix<4, 4, float>& matrix) {
+    Matrix<4, 4, float> inverseMatrix;
+
+    Simd::inverseMatrix4(matrix.getValues().data().data(), inverseMatrix.getValues().data().data());
+
+    return inverseMatrix;
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator+(T lhs, const Matrix<Rows, Columns, T>& rhs) {
-    return Matrix<Rows, Columns, T>(lhs + rhs.getValues());
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr MatrixOperation<OperationValues, Rows, Columns, T>::MatrixOperation(const Values& values) : _values(values) {}
+
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr uint8_t MatrixOperation<OperationValues, Rows, Columns, T>::getRows() const {
+    return Rows;
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator-(T lhs, const Matrix<Rows, Columns, T>& rhs) {
-    return Matrix<Rows, Columns, T>(lhs - rhs.getValues());
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr uint8_t MatrixOperation<OperationValues, Rows, Columns, T>::getColumns() const {
+    return Columns;
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator*(T lhs, const Matrix<Rows, Columns, T>& rhs) {
-    return Matrix<Rows, Columns, T>(lhs * rhs.getValues());
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr const typename MatrixOperation<OperationValues, Rows, Columns, T>::Values& MatrixOperation<OperationValues, Rows, Columns, T>::getValues() const {
+    return _values;
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator/(T lhs, const Matrix<Rows, Columns, T>& rhs) {
-    return Matrix<Rows, Columns, T>(lhs / rhs.getValues());
+template <typename OperationValues, uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr T MatrixOperation<OperationValues, Rows, Columns, T>::operator()(uint8_t row, uint8_t col) const {
+    return _values[col * Rows + row];
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename OperationValues>
+inline constexpr MatrixOperation<OperationValues, Rows, Columns, T> makeMatrixOperation(const OperationValues& values) {
+    return MatrixOperation<OperationValues, Rows, Columns, T>(values);
 }
 
-// Matrix/Matrix operations
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
-    Matrix<Rows, Columns, T> matrix{lhs};
+inline constexpr MatrixList<Rows, Columns, T>::MatrixList(std::initializer_list<T> list) : _list(list) {}
 
-    matrix += rhs;
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr T MatrixList<Rows, Columns, T>::operator[](size_t pos) const {
+    // The values are stored column by column
+    const size_t index = (pos % Rows) * Columns + pos / Rows;
 
-    return matrix;
+    return index < _list.size() ? _list.begin()[index] : T();
 }
 
+template <uint8_t Rows, typename T>
+inline constexpr T MatrixIdentity<Rows, T>::operator[](size_t pos) const {
+    return pos % (Rows + 1) == 0 ? T(1) : T(0);
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr MatrixTransposition<Rows, Columns, T>::MatrixTransposition(const Matrix<Rows, Columns, T>& matrix) : _matrix(matrix) {}
+
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
-    Matrix<Rows, Columns, T> matrix{lhs};
+inline constexpr T MatrixTransposition<Rows, Columns, T>::operator[](size_t pos) const {
+    // `pos` is in the transposed matrix, of `Columns` rows
+    return _matrix(static_cast<uint8_t>(pos / Columns), static_cast<uint8_t>(pos % Columns));
+}
+
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t ColumnsRight, typename T>
+inline constexpr MatrixProduct<RowsLeft, ColumnsLeft, ColumnsRight, T>::MatrixProduct(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<ColumnsLeft, ColumnsRight, T>& rhs) : _lhs(lhs), _rhs(rhs) {}
 
-    matrix -= rhs;
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t ColumnsRight, typename T>
+inline constexpr T MatrixProduct<RowsLeft, ColumnsLeft, ColumnsRight, T>::operator[](size_t pos) const {
+    const uint8_t row = static_cast<uint8_t>(pos % RowsLeft);
+    const uint8_t col = static_cast<uint8_t>(pos / RowsLeft);
+
+    T value(0);
+
+    for (uint8_t k = 0; k < ColumnsLeft; ++k) {
+        value += _lhs(row, k) * _rhs(k, col);
+    }
+
+    return value;
+}
+
+inline Matrix<4, 4, float> multiplySimd(const Matrix<4, 4, float>& lhs, const Matrix<4, 4, float>& rhs) {
+    Matrix<4, 4, float> matrix;
+
+    Simd::multiplyMatrix4(lhs.getValues().data().data(), rhs.getValues().data().data(), matrix.getValues().data().data());
 
     return matrix;
 }
 
-template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T>
-inline Matrix<RowsLeft, ColumnsRight, T> operator*(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<RowsRight, ColumnsRight, T>& rhs) {
+} // priv
+/**
+ * \endcond
+ */
+
+// Unary operations
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+inline constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Lhs, priv::Subtract, Rows, Columns, T> operator-(const MatrixExpression<Lhs, Rows, Columns, T>& lhs) {
+    return T(0) - lhs;
+}
+
+// Matrix/Scalar operations
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+inline constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Add, Rows, Columns, T> operator+(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs.getExpression().getValues() + rhs);
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+inline constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Subtract, Rows, Columns, T> operator-(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs.getExpression().getValues() - rhs);
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+inline constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Multiply, Rows, Columns, T> operator*(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs.getExpression().getValues() * rhs);
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs>
+inline constexpr priv::MatrixBinaryOperation<Lhs, priv::MatrixScalar<Rows, Columns, T>, priv::Divide, Rows, Columns, T> operator/(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, T rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs.getExpression().getValues() / rhs);
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+inline constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Add, Rows, Columns, T> operator+(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs + rhs.getExpression().getValues());
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+inline constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Subtract, Rows, Columns, T> operator-(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs - rhs.getExpression().getValues());
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+inline constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Multiply, Rows, Columns, T> operator*(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs * rhs.getExpression().getValues());
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Rhs>
+inline constexpr priv::MatrixBinaryOperation<priv::MatrixScalar<Rows, Columns, T>, Rhs, priv::Divide, Rows, Columns, T> operator/(T lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs / rhs.getExpression().getValues());
+}
+
+// Matrix/Matrix operations
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+inline constexpr priv::MatrixBinaryOperation<Lhs, Rhs, priv::Add, Rows, Columns, T> operator+(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs.getExpression().getValues() + rhs.getExpression().getValues());
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+inline constexpr priv::MatrixBinaryOperation<Lhs, Rhs, priv::Subtract, Rows, Columns, T> operator-(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, Columns, T>(lhs.getExpression().getValues() - rhs.getExpression().getValues());
+}
+
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T, typename Lhs, typename Rhs>
+inline constexpr Matrix<RowsLeft, ColumnsRight, T> operator*(const MatrixExpression<Lhs, RowsLeft, ColumnsLeft, T>& lhs, const MatrixExpression<Rhs, RowsRight, ColumnsRight, T>& rhs) {
     static_assert(ColumnsLeft == RowsRight, "Columns of the right operand and Rows of the left operand must be of the same size to multiply matrices");
 
-    Matrix<RowsLeft, ColumnsRight, T> matrix(0);
+    // The operations are evaluated once, not for each product of the loop
+    const Matrix<RowsLeft, ColumnsLeft, T>& left = lhs.getExpression();
+    const Matrix<RowsRight, ColumnsRight, T>& right = rhs.getExpression();
 
-    for (uint8_t i = 0; i < RowsLeft; ++i) {
-        for (uint8_t j = 0; j < ColumnsRight; ++j) {
-            for (uint8_t k = 0; k < RowsRight; ++k) {
-                matrix(i, j) += lhs(i, k) * rhs(k, j);
-            }
-        }
-    }
+    return priv::makeMatrixOperation<RowsLeft, ColumnsRight, T>(priv::MatrixProduct<RowsLeft, ColumnsLeft, ColumnsRight, T>(left, right));
+}
 
-    return matrix;
+inline constexpr Matrix<4, 4, float> operator*(const Matrix<4, 4, float>& lhs, const Matrix<4, 4, float>& rhs) {
+    return Constexpr::isConstantEvaluated() ? operator*<4, 4, 4, 4, float>(lhs, rhs) : priv::multiplySimd(lhs, rhs);
 }
 
-template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T>
-inline Matrix<RowsLeft, ColumnsRight, T> operator/(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<RowsRight, ColumnsRight, T>& rhs) {
+template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T, typename Lhs, typename Rhs>
+inline constexpr Matrix<RowsLeft, ColumnsRight, T> operator/(const MatrixExpression<Lhs, RowsLeft, ColumnsLeft, T>& lhs, const MatrixExpression<Rhs, RowsRight, ColumnsRight, T>& rhs) {
     static_assert(RowsLeft == ColumnsLeft, "Matrix division can only happen with square matrix");
     static_assert(RowsRight == ColumnsRight, "Matrix division can only happen with square matrix");
     static_assert(RowsLeft == RowsRight, "Matrix division can only happen with matrices of the same size");
 
-    return lhs * rhs.inverse();
+    const Matrix<RowsLeft, ColumnsLeft, T>& left = lhs.getExpression();
+    const Matrix<RowsRight, ColumnsRight, T>& right = rhs.getExpression();
+
+    return left * right.inverse();
 }
 
 
 // Comparaison operators
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline bool operator==(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
-    return (lhs.getValues() == rhs.getValues());
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+inline constexpr bool operator==(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return (lhs.getExpression().getValues() == rhs.getExpression().getValues());
 }
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline bool operator!=(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
-    return (lhs.getValues() != rhs.getValues());
+template <uint8_t Rows, uint8_t Columns, typename T, typename Lhs, typename Rhs>
+inline constexpr bool operator!=(const MatrixExpression<Lhs, Rows, Columns, T>& lhs, const MatrixExpression<Rhs, Rows, Columns, T>& rhs) {
+    return (lhs.getExpression().getValues() != rhs.getExpression().getValues());
 }
 
 // TODO: Handle alignment of values
-template <uint8_t Rows, uint8_t Columns, typename T>
-std::ostream& operator<<(std::ostream& os, const Matrix<Rows, Columns, T>& matrix) {
+template <uint8_t Rows, uint8_t Columns, typename T, typename Expression>
+std::ostream& operator<<(std::ostream& os, const MatrixExpression<Expression, Rows, Columns, T>& expression) {
+    const Expression& matrix = expression.getExpression();
+
     os << "{\n";
 
     for (uint8_t i = 0; i < Rows; ++i) {
@@ -12,9 +12,9 @@ template <typename T = double>
 class Quaternion {
 public:
     Quaternion() = default;
-    Quaternion(T w, T x, T y, T z);
-    Quaternion(T data[4]);
-    Quaternion(T angle, const Vector<3, T>& axis);
+    constexpr Quaternion(T w, T x, T y, T z);
+    constexpr Quaternion(T data[4]);
+    constexpr Quaternion(T angle, const Vector<3, T>& axis);
 
     Quaternion(const Quaternion<T>&) = default;
     Quaternion(Quaternion<T>&&) = default;
@@ -24,27 +24,27 @@ public:
 
     ~Quaternion() = default;
 
-    T& operator[](std::size_t idx);
-    const T& operator[](std::size_t idx) const;
+    constexpr T& operator[](std::size_t idx);
+    constexpr const T& operator[](std::size_t idx) const;
 
-    void conjugate();
-    void inverse();
+    constexpr void conjugate();
+    constexpr void inverse();
 
-    void normalize();
+    constexpr void normalize();
     constexpr T length() const;
     constexpr T squaredLength() const;
 
     T getAngle() const;
     Vector<3, T> getAxis() const;
 
-    Mat4x4<T> transform() const;
+    constexpr Mat4x4<T> transform() const;
 
 #define DEFINE_QUATERNION_ACCESS(name, rows)    \
-    const T& name() const {                     \
+    constexpr const T& name() const {           \
         return (*this)[rows];                   \
     }                                           \
                                                 \
-    T& name() {                                 \
+    constexpr T& name() {                       \
         return (*this)[rows];                   \
     }
 
@@ -62,10 +62,10 @@ public:
 
 #undef DEFINE_QUATERNION_ACCESS
 
-    static Quaternion<T> identity();
+    static constexpr Quaternion<T> identity();
 
-    static Quaternion<T> fromAxes(const Vector<3, T>& xAxis, const Vector<3, T>& yAxis, const Vector<3, T>& zAxis);
-    static Quaternion<T> fromRotationMatrix(const Matrix<4, 4, T>& rotMatrix);
+    static constexpr Quaternion<T> fromAxes(const Vector<3, T>& xAxis, const Vector<3, T>& yAxis, const Vector<3, T>& zAxis);
+    static constexpr Quaternion<T> fromRotationMatrix(const Matrix<4, 4, T>& rotMatrix);
 
 private:
     T _data[4];
@@ -78,16 +78,16 @@ template class LUG_MATH_API Quaternion<double>;
 using Quatd = Quaternion<double>;
 
 template <typename T>
-Quaternion<T> normalize(const Quaternion<T>& lhs);
+constexpr Quaternion<T> normalize(const Quaternion<T>& lhs);
 
 template <typename T>
-Quaternion<T> conjugate(const Quaternion<T>& lhs);
+constexpr Quaternion<T> conjugate(const Quaternion<T>& lhs);
 
 template <typename T>
-Quaternion<T> inverse(const Quaternion<T>& lhs);
+constexpr Quaternion<T> inverse(const Quaternion<T>& lhs);
 
 template <typename T>
-T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
 Quaternion<T> directionTo(const Vector<3, T>& original, const Vector<3, T>& expected);
@@ -97,26 +97,26 @@ Quaternion<T> directionTo(const Vector<3, T>& original, const Vector<3, T>& expe
 // Quaternion operator
 
 template <typename T>
-Quaternion<T> operator-(const Quaternion<T>& lhs);
+constexpr Quaternion<T> operator-(const Quaternion<T>& lhs);
 
 // Quaternion/Quaternion operator
 template <typename T>
-Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-Quaternion<T> operator/(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr Quaternion<T> operator/(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
 std::ostream& operator<<(std::ostream& os, const Quaternion<T>& quaternion);
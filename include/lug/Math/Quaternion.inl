@@ -1,22 +1,17 @@
 template <typename T>
-Quaternion<T>::Quaternion(T w, T x, T y, T z) : _data{w, x, y, z} {}
+inline constexpr Quaternion<T>::Quaternion(T w, T x, T y, T z) : _data{w, x, y, z} {}
 
 template <typename T>
-Quaternion<T>::Quaternion(T data[4]) {
-    _data[0] = data[0];
-    _data[1] = data[1];
-    _data[2] = data[2];
-    _data[3] = data[3];
-
+inline constexpr Quaternion<T>::Quaternion(T data[4]) : _data{data[0], data[1], data[2], data[3]} {
     normalize();
 }
 
 template <typename T>
-Quaternion<T>::Quaternion(T angle, const Vector<3, T>& axis) {
+inline constexpr Quaternion<T>::Quaternion(T angle, const Vector<3, T>& axis) : _data{} {
     const T halfAngle = angle / 2;
-    const T sinHalf = std::sin(halfAngle);
+    const T sinHalf = T(Constexpr::sin(halfAngle));
 
-    _data[0] = std::cos(halfAngle);
+    _data[0] = T(Constexpr::cos(halfAngle));
     _data[1] = axis(0) * sinHalf;
     _data[2] = axis(1) * sinHalf;
     _data[3] = axis(2) * sinHalf;
@@ -25,33 +20,33 @@ Quaternion<T>::Quaternion(T angle, const Vector<3, T>& axis) {
 }
 
 template <typename T>
-inline T& Quaternion<T>::operator[](std::size_t idx) {
+inline constexpr T& Quaternion<T>::operator[](std::size_t idx) {
     return _data[idx];
 }
 
 template <typename T>
-inline const T& Quaternion<T>::operator[](std::size_t idx) const {
+inline constexpr const T& Quaternion<T>::operator[](std::size_t idx) const {
     return _data[idx];
 }
 
 template <typename T>
-inline void Quaternion<T>::conjugate() {
+inline constexpr void Quaternion<T>::conjugate() {
     *this = ::lug::Math::conjugate(*this);
 }
 
 template <typename T>
-inline void Quaternion<T>::inverse() {
+inline constexpr void Quaternion<T>::inverse() {
     *this = ::lug::Math::conjugate(*this);
 }
 
 template <typename T>
-inline void Quaternion<T>::normalize() {
+inline constexpr void Quaternion<T>::normalize() {
     *this = ::lug::Math::normalize(*this);
 }
 
 template <typename T>
 inline constexpr T Quaternion<T>::length() const {
-    return std::sqrt(squaredLength());
+    return T(Constexpr::sqrt(squaredLength()));
 }
 
 template <typename T>
@@ -75,9 +70,7 @@ inline Vector<3, T> Quaternion<T>::getAxis() const {
 }
 
 template <typename T>
-inline Mat4x4<T> Quaternion<T>::transform() const {
-    Mat4x4<T> result{Mat4x4<T>::identity()};
-
+inline constexpr Mat4x4<T> Quaternion<T>::transform() const {
     const T xx = _data[1] * _data[1];
     const T xy = _data[1] * _data[2];
     const T xz = _data[1] * _data[3];
@@ -90,51 +83,35 @@ inline Mat4x4<T> Quaternion<T>::transform() const {
     const T zz = _data[3] * _data[3];
     const T wz = _data[0] * _data[3];
 
-    result(0, 0) = T(1) - T(2) * (yy + zz);
-    result(1, 0) = T(2) * (xy + wz);
-    result(2, 0) = T(2) * (xz - wy);
-
-    result(0, 1) = T(2) * (xy - wz);
-    result(1, 1) = T(1) - T(2) * (xx + zz);
-    result(2, 1) = T(2) * (yz + wx);
-
-    result(0, 2) = T(2) * (xz + wy);
-    result(1, 2) = T(2) * (yz - wx);
-    result(2, 2) = T(1) - T(2) * (xx + yy);
-
-    return result;
+    return Mat4x4<T> {
+        T(1) - T(2) * (yy + zz), T(2) * (xy - wz), T(2) * (xz + wy), 0,
+        T(2) * (xy + wz), T(1) - T(2) * (xx + zz), T(2) * (yz - wx), 0,
+        T(2) * (xz - wy), T(2) * (yz + wx), T(1) - T(2) * (xx + yy), 0,
+        0, 0, 0, 1
+    };
 }
 
 template <typename T>
-inline Quaternion<T> Quaternion<T>::identity() {
+inline constexpr Quaternion<T> Quaternion<T>::identity() {
     return {T(1), T(0), T(0), T(0)};
 }
 
 template <typename T>
-inline Quaternion<T> Quaternion<T>::fromAxes(const Vector<3, T>& xAxis, const Vector<3, T>& yAxis, const Vector<3, T>& zAxis) {
-    Matrix<4, 4, T> rotMatrix = Matrix<4, 4, T>::identity();
-
-    rotMatrix(0, 0) = xAxis.x();
-    rotMatrix(1, 0) = xAxis.y();
-    rotMatrix(2, 0) = xAxis.z();
-
-    rotMatrix(0, 1) = yAxis.x();
-    rotMatrix(1, 1) = yAxis.y();
-    rotMatrix(2, 1) = yAxis.z();
-
-    rotMatrix(0, 2) = zAxis.x();
-    rotMatrix(1, 2) = zAxis.y();
-    rotMatrix(2, 2) = zAxis.z();
-
-    return fromRotationMatrix(rotMatrix);
+inline constexpr Quaternion<T> Quaternion<T>::fromAxes(const Vector<3, T>& xAxis, const Vector<3, T>& yAxis, const Vector<3, T>& zAxis) {
+    return fromRotationMatrix(Matrix<4, 4, T> {
+        xAxis.x(), yAxis.x(), zAxis.x(), 0,
+        xAxis.y(), yAxis.y(), zAxis.y(), 0,
+        xAxis.z(), yAxis.z(), zAxis.z(), 0,
+        0, 0, 0, 1
+    });
 }
 
 template <typename T>
-inline Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& rotMatrix) {
+inline constexpr Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& rotMatrix) {
     const T tr = rotMatrix(0, 0) + rotMatrix(1, 1) + rotMatrix(2, 2);
 
     if (tr > 0.0f) {
-        const T s = sqrt(T(1) + tr) * T(2);
+        const T s = T(Constexpr::sqrt(T(1) + tr)) * T(2);
 
         return Quaternion<T>(
             T(0.25f) * s,
@@ -143,7 +120,7 @@ inline Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& ro
             (rotMatrix(1, 0) - rotMatrix(0, 1)) / s
         );
     } else if ((rotMatrix(0, 0) > rotMatrix(1, 1)) && (rotMatrix(0, 0) > rotMatrix(2, 2))) {
-        const T s = sqrt(T(1) + rotMatrix(0, 0) - rotMatrix(1, 1) - rotMatrix(2, 2)) * T(2);
+        const T s = T(Constexpr::sqrt(T(1) + rotMatrix(0, 0) - rotMatrix(1, 1) - rotMatrix(2, 2))) * T(2);
 
         return Quaternion<T>(
             (rotMatrix(2, 1) - rotMatrix(1, 2)) / s,
@@ -152,7 +129,7 @@ inline Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& ro
             (rotMatrix(0, 2) + rotMatrix(2, 0)) / s
         );
     } else if (rotMatrix(1, 1) > rotMatrix(2, 2)) {
-        const T s = sqrt(T(1) + rotMatrix(1, 1) - rotMatrix(0, 0) - rotMatrix(2, 2)) * T(2);
+        const T s = T(Constexpr::sqrt(T(1) + rotMatrix(1, 1) - rotMatrix(0, 0) - rotMatrix(2, 2))) * T(2);
 
         return Quaternion<T>(
             (rotMatrix(0, 2) - rotMatrix(2, 0)) / s,
@@ -161,7 +138,7 @@ inline Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& ro
             (rotMatrix(1, 2) + rotMatrix(2, 1)) / s
         );
     } else {
-        const T s = sqrt(T(1) + rotMatrix(2, 2) - rotMatrix(0, 0) - rotMatrix(1, 1)) * T(2);
+        const T s = T(Constexpr::sqrt(T(1) + rotMatrix(2, 2) - rotMatrix(0, 0) - rotMatrix(1, 1))) * T(2);
 
         return Quaternion<T>(
             (rotMatrix(1, 0) - rotMatrix(0, 1)) / s,
@@ -173,18 +150,18 @@ inline Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& ro
 }
 
 template <typename T>
-inline Quaternion<T> conjugate(const Quaternion<T>& lhs) {
+inline constexpr Quaternion<T> conjugate(const Quaternion<T>& lhs) {
     return {lhs.w(), -lhs.x(), -lhs.y(), -lhs.z()};
 }
 
 template <typename T>
-inline Quaternion<T> normalize(const Quaternion<T>& lhs) {
+inline constexpr Quaternion<T> normalize(const Quaternion<T>& lhs) {
     const T length = lhs.length();
     return {lhs[0] / length, lhs[1] / length, lhs[2] / length, lhs[3] / length};
 }
 
 template <typename T>
-inline Quaternion<T> inverse(const Quaternion<T>& lhs) {
+inline constexpr Quaternion<T> inverse(const Quaternion<T>& lhs) {
     Quaternion<T> result{lhs};
 
     result.conjugate();
@@ -202,7 +179,7 @@ inline Quaternion<T> inverse(const Quaternion<T>& lhs) {
 }
 
 template <typename T>
-inline T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3];
 }
 
@@ -247,22 +224,22 @@ Quaternion<T> directionTo(const Vector<3, T>& original, const Vector<3, T>& expe
 }
 
 template <typename T>
-inline Quaternion<T> operator-(const Quaternion<T>& lhs) {
+inline constexpr Quaternion<T> operator-(const Quaternion<T>& lhs) {
     return {-lhs[0], -lhs[1], -lhs[2], -lhs[3]};
 }
 
 template <typename T>
-inline Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return {lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3]};
 }
 
 template <typename T>
-inline Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3]};
 }
 
 template <typename T>
-inline Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return {
         lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2] - lhs[3] * rhs[3],
         lhs[0] * rhs[1] + lhs[1] * rhs[0] + lhs[2] * rhs[3] - lhs[3] * rhs[2],
@@ -272,17 +249,17 @@ inline Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rh
 }
 
 template <typename T>
-inline Quaternion<T> operator/(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr Quaternion<T> operator/(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs * conjugate(rhs);
 }
 
 template <typename T>
-inline bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3];
 }
 
 template <typename T>
-inline bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs[0] != rhs[0] || lhs[1] != rhs[1] || lhs[2] != rhs[2] || lhs[3] != rhs[3];
 }
 
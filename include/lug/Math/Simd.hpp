@@ -0,0 +1,108 @@
+#pragma once
+
+// Backend of the vectorized operations on 4 floats, chosen at compile time:
+// SSE (SSE2 is always there on x86-64), NEON, or a scalar fallback with the same interface
+// Define LUG_MATH_NO_SIMD to force the scalar fallback
+#if !defined(LUG_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define LUG_MATH_SIMD_SSE
+
+    // AVX is only used when the compiler targets it (e.g. -mavx or /arch:AVX)
+    #if defined(__AVX__)
+        #define LUG_MATH_SIMD_AVX
+    #endif
+#elif !defined(LUG_MATH_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define LUG_MATH_SIMD_NEON
+#else
+    #define LUG_MATH_SIMD_SCALAR
+#endif
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(LUG_MATH_SIMD_AVX)
+    #include <immintrin.h>
+#elif defined(LUG_MATH_SIMD_SSE)
+    #include <emmintrin.h>
+#elif defined(LUG_MATH_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+namespace lug {
+namespace Math {
+namespace Simd {
+
+// Number of floats handled at once by the operations
+constexpr size_t Width = 4;
+
+#if defined(LUG_MATH_SIMD_SSE)
+using Float4 = __m128;
+#elif defined(LUG_MATH_SIMD_NEON)
+using Float4 = float32x4_t;
+#else
+struct Float4 {
+    float values[4];
+};
+#endif
+
+// The loads and stores don't require any alignment, the types holding floats by 4 are aligned on 16 bytes
+// but the heap only guarantees it on some platforms
+Float4 load(const float* values);
+void store(float* values, Float4 value);
+
+// The fourth lane is set to `w`, reads only 3 floats
+Float4 load3(const float* values, float w = 0.0f);
+void store3(float* values, Float4 value);
+
+Float4 set(float x, float y, float z, float w);
+Float4 splat(float value);
+Float4 zero();
+
+Float4 add(Float4 lhs, Float4 rhs);
+Float4 sub(Float4 lhs, Float4 rhs);
+Float4 mul(Float4 lhs, Float4 rhs);
+Float4 div(Float4 lhs, Float4 rhs);
+
+Float4 sqrt(Float4 value);
+
+// lhs * rhs + addend
+Float4 madd(Float4 lhs, Float4 rhs, Float4 addend);
+
+// (lhs[X], lhs[Y], rhs[Z], rhs[W]), as _mm_shuffle_ps
+template <int X, int Y, int Z, int W>
+Float4 shuffle(Float4 lhs, Float4 rhs);
+
+// (value[X], value[Y], value[Z], value[W])
+template <int X, int Y, int Z, int W>
+Float4 swizzle(Float4 value);
+
+// Lane `Index` in the 4 lanes
+template <int Index>
+Float4 broadcast(Float4 value);
+
+float getX(Float4 value);
+
+// Sum of the 4 lanes
+float sum(Float4 value);
+
+float dot4(Float4 lhs, Float4 rhs);
+
+// Cross product of the first 3 lanes, the fourth one is lhs[3] * rhs[3] - lhs[3] * rhs[3] (i.e. 0)
+Float4 cross3(Float4 lhs, Float4 rhs);
+
+// The 4 columns of a 4x4 matrix become its rows
+void transpose(Float4& c0, Float4& c1, Float4& c2, Float4& c3);
+
+// Kernels on 4x4 matrices stored by columns (as lug::Math::Matrix), `result` can't alias the operands
+void multiplyMatrix4(const float* lhs, const float* rhs, float* result);
+void transposeMatrix4(const float* matrix, float* result);
+void inverseMatrix4(const float* matrix, float* result);
+
+// matrix * vector, with the matrix given by its columns or stored by columns
+Float4 transformVector4(Float4 c0, Float4 c1, Float4 c2, Float4 c3, Float4 vector);
+Float4 transformVector4(const float* matrix, Float4 vector);
+
+#include <lug/Math/Simd.inl>
+
+} // Simd
+} // Math
+} // lug
@@ -0,0 +1,390 @@
+#if defined(LUG_MATH_SIMD_SSE)
+
+inline Float4 load(const float* values) {
+    return _mm_loadu_ps(values);
+}
+
+inline void store(float* values, Float4 value) {
+    _mm_storeu_ps(values, value);
+}
+
+inline Float4 set(float x, float y, float z, float w) {
+    return _mm_setr_ps(x, y, z, w);
+}
+
+inline Float4 splat(float value) {
+    return _mm_set1_ps(value);
+}
+
+inline Float4 zero() {
+    return _mm_setzero_ps();
+}
+
+inline Float4 add(Float4 lhs, Float4 rhs) {
+    return _mm_add_ps(lhs, rhs);
+}
+
+inline Float4 sub(Float4 lhs, Float4 rhs) {
+    return _mm_sub_ps(lhs, rhs);
+}
+
+inline Float4 mul(Float4 lhs, Float4 rhs) {
+    return _mm_mul_ps(lhs, rhs);
+}
+
+inline Float4 div(Float4 lhs, Float4 rhs) {
+    return _mm_div_ps(lhs, rhs);
+}
+
+inline Float4 sqrt(Float4 value) {
+    return _mm_sqrt_ps(value);
+}
+
+inline Float4 madd(Float4 lhs, Float4 rhs, Float4 addend) {
+#if defined(__FMA__)
+    return _mm_fmadd_ps(lhs, rhs, addend);
+#else
+    return _mm_add_ps(_mm_mul_ps(lhs, rhs), addend);
+#endif
+}
+
+template <int X, int Y, int Z, int W>
+inline Float4 shuffle(Float4 lhs, Float4 rhs) {
+    return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+template <int X, int Y, int Z, int W>
+inline Float4 swizzle(Float4 value) {
+    return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(value), _MM_SHUFFLE(W, Z, Y, X)));
+}
+
+inline float getX(Float4 value) {
+    return _mm_cvtss_f32(value);
+}
+
+inline float sum(Float4 value) {
+    // (x + z, y + w, ...) then (x + z + y + w, ...)
+    const Float4 pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+    return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+}
+
+#elif defined(LUG_MATH_SIMD_NEON)
+
+inline Float4 load(const float* values) {
+    return vld1q_f32(values);
+}
+
+inline void store(float* values, Float4 value) {
+    vst1q_f32(values, value);
+}
+
+inline Float4 set(float x, float y, float z, float w) {
+    const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+}
+
+inline Float4 splat(float value) {
+    return vdupq_n_f32(value);
+}
+
+inline Float4 zero() {
+    return vdupq_n_f32(0.0f);
+}
+
+inline Float4 add(Float4 lhs, Float4 rhs) {
+    return vaddq_f32(lhs, rhs);
+}
+
+inline Float4 sub(Float4 lhs, Float4 rhs) {
+    return vsubq_f32(lhs, rhs);
+}
+
+inline Float4 mul(Float4 lhs, Float4 rhs) {
+    return vmulq_f32(lhs, rhs);
+}
+
+inline Float4 div(Float4 lhs, Float4 rhs) {
+    // Reciprocal estimate refined twice, vdivq_f32 is AArch64 only
+    Float4 reciprocal = vrecpeq_f32(rhs);
+    reciprocal = vmulq_f32(vrecpsq_f32(rhs, reciprocal), reciprocal);
+    reciprocal = vmulq_f32(vrecpsq_f32(rhs, reciprocal), reciprocal);
+    return vmulq_f32(lhs, reciprocal);
+}
+
+inline Float4 sqrt(Float4 value) {
+#if defined(__aarch64__)
+    return vsqrtq_f32(value);
+#else
+    // sqrt(x) = x / sqrt(x), the reciprocal square root estimate is refined twice and 0 stays 0
+    Float4 reciprocal = vrsqrteq_f32(value);
+    reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(value, reciprocal), reciprocal), reciprocal);
+    reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(value, reciprocal), reciprocal), reciprocal);
+    return vbslq_f32(vceqq_f32(value, vdupq_n_f32(0.0f)), value, vmulq_f32(value, reciprocal));
+#endif
+}
+
+inline Float4 madd(Float4 lhs, Float4 rhs, Float4 addend) {
+    return vmlaq_f32(addend, lhs, rhs);
+}
+
+// NEON has no generic shuffle, the lanes are moved one by one (the compilers merge the common patterns)
+template <int X, int Y, int Z, int W>
+inline Float4 shuffle(Float4 lhs, Float4 rhs) {
+    Float4 result = vmovq_n_f32(vgetq_lane_f32(lhs, X));
+    result = vsetq_lane_f32(vgetq_lane_f32(lhs, Y), result, 1);
+    result = vsetq_lane_f32(vgetq_lane_f32(rhs, Z), result, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(rhs, W), result, 3);
+}
+
+template <int X, int Y, int Z, int W>
+inline Float4 swizzle(Float4 value) {
+    return shuffle<X, Y, Z, W>(value, value);
+}
+
+inline float getX(Float4 value) {
+    return vgetq_lane_f32(value, 0);
+}
+
+inline float sum(Float4 value) {
+    const float32x2_t pairs = vadd_f32(vget_low_f32(value), vget_high_f32(value));
+    return vget_lane_f32(vpadd_f32(pairs, pairs), 0);
+}
+
+#else
+
+inline Float4 load(const float* values) {
+    return {{values[0], values[1], values[2], values[3]}};
+}
+
+inline void store(float* values, Float4 value) {
+    for (int i = 0; i < 4; ++i) {
+        values[i] = value.values[i];
+    }
+}
+
+inline Float4 set(float x, float y, float z, float w) {
+    return {{x, y, z, w}};
+}
+
+inline Float4 splat(float value) {
+    return {{value, value, value, value}};
+}
+
+inline Float4 zero() {
+    return splat(0.0f);
+}
+
+inline Float4 add(Float4 lhs, Float4 rhs) {
+    return {{lhs.values[0] + rhs.values[0], lhs.values[1] + rhs.values[1], lhs.values[2] + rhs.values[2], lhs.values[3] + rhs.values[3]}};
+}
+
+inline Float4 sub(Float4 lhs, Float4 rhs) {
+    return {{lhs.values[0] - rhs.values[0], lhs.values[1] - rhs.values[1], lhs.values[2] - rhs.values[2], lhs.values[3] - rhs.values[3]}};
+}
+
+inline Float4 mul(Float4 lhs, Float4 rhs) {
+    return {{lhs.values[0] * rhs.values[0], lhs.values[1] * rhs.values[1], lhs.values[2] * rhs.values[2], lhs.values[3] * rhs.values[3]}};
+}
+
+inline Float4 div(Float4 lhs, Float4 rhs) {
+    return {{lhs.values[0] / rhs.values[0], lhs.values[1] / rhs.values[1], lhs.values[2] / rhs.values[2], lhs.values[3] / rhs.values[3]}};
+}
+
+inline Float4 sqrt(Float4 value) {
+    return {{std::sqrt(value.values[0]), std::sqrt(value.values[1]), std::sqrt(value.values[2]), std::sqrt(value.values[3])}};
+}
+
+inline Float4 madd(Float4 lhs, Float4 rhs, Float4 addend) {
+    return add(mul(lhs, rhs), addend);
+}
+
+template <int X, int Y, int Z, int W>
+inline Float4 shuffle(Float4 lhs, Float4 rhs) {
+    return {{lhs.values[X], lhs.values[Y], rhs.values[Z], rhs.values[W]}};
+}
+
+template <int X, int Y, int Z, int W>
+inline Float4 swizzle(Float4 value) {
+    return shuffle<X, Y, Z, W>(value, value);
+}
+
+inline float getX(Float4 value) {
+    return value.values[0];
+}
+
+inline float sum(Float4 value) {
+    return (value.values[0] + value.values[2]) + (value.values[1] + value.values[3]);
+}
+
+#endif
+
+inline Float4 load3(const float* values, float w) {
+    return set(values[0], values[1], values[2], w);
+}
+
+inline void store3(float* values, Float4 value) {
+    float result[4];
+    store(result, value);
+
+    values[0] = result[0];
+    values[1] = result[1];
+    values[2] = result[2];
+}
+
+template <int Index>
+inline Float4 broadcast(Float4 value) {
+    return swizzle<Index, Index, Index, Index>(value);
+}
+
+inline float dot4(Float4 lhs, Float4 rhs) {
+    return sum(mul(lhs, rhs));
+}
+
+inline Float4 cross3(Float4 lhs, Float4 rhs) {
+    return sub(
+        mul(swizzle<1, 2, 0, 3>(lhs), swizzle<2, 0, 1, 3>(rhs)),
+        mul(swizzle<2, 0, 1, 3>(lhs), swizzle<1, 2, 0, 3>(rhs))
+    );
+}
+
+inline void transpose(Float4& c0, Float4& c1, Float4& c2, Float4& c3) {
+    const Float4 t0 = shuffle<0, 1, 0, 1>(c0, c1);
+    const Float4 t1 = shuffle<0, 1, 0, 1>(c2, c3);
+    const Float4 t2 = shuffle<2, 3, 2, 3>(c0, c1);
+    const Float4 t3 = shuffle<2, 3, 2, 3>(c2, c3);
+
+    c0 = shuffle<0, 2, 0, 2>(t0, t1);
+    c1 = shuffle<1, 3, 1, 3>(t0, t1);
+    c2 = shuffle<0, 2, 0, 2>(t2, t3);
+    c3 = shuffle<1, 3, 1, 3>(t2, t3);
+}
+
+inline void multiplyMatrix4(const float* lhs, const float* rhs, float* result) {
+#if defined(LUG_MATH_SIMD_AVX)
+    // Two columns of the result at once, the columns of `lhs` are in both halves of the registers
+    const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs));
+    const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+    const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+    const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+
+    for (int i = 0; i < 16; i += 8) {
+        const __m256 columns = _mm256_loadu_ps(rhs + i);
+
+        __m256 sum = _mm256_mul_ps(c0, _mm256_shuffle_ps(columns, columns, 0x00));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(c1, _mm256_shuffle_ps(columns, columns, 0x55)));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(c2, _mm256_shuffle_ps(columns, columns, 0xAA)));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(c3, _mm256_shuffle_ps(columns, columns, 0xFF)));
+
+        _mm256_storeu_ps(result + i, sum);
+    }
+#else
+    const Float4 c0 = load(lhs);
+    const Float4 c1 = load(lhs + 4);
+    const Float4 c2 = load(lhs + 8);
+    const Float4 c3 = load(lhs + 12);
+
+    for (int i = 0; i < 16; i += 4) {
+        store(result + i, transformVector4(c0, c1, c2, c3, load(rhs + i)));
+    }
+#endif
+}
+
+inline void transposeMatrix4(const float* matrix, float* result) {
+    Float4 c0 = load(matrix);
+    Float4 c1 = load(matrix + 4);
+    Float4 c2 = load(matrix + 8);
+    Float4 c3 = load(matrix + 12);
+
+    transpose(c0, c1, c2, c3);
+
+    store(result, c0);
+    store(result + 4, c1);
+    store(result + 8, c2);
+    store(result + 12, c3);
+}
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// 2x2 matrices stored as (m00, m01, m10, m11)
+
+// lhs * rhs
+inline Float4 multiplyMatrix2(Float4 lhs, Float4 rhs) {
+    return add(mul(lhs, swizzle<0, 3, 0, 3>(rhs)), mul(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+}
+
+// adj(lhs) * rhs
+inline Float4 adjMultiplyMatrix2(Float4 lhs, Float4 rhs) {
+    return sub(mul(swizzle<3, 3, 0, 0>(lhs), rhs), mul(swizzle<1, 1, 2, 2>(lhs), swizzle<2, 3, 0, 1>(rhs)));
+}
+
+// lhs * adj(rhs)
+inline Float4 multiplyAdjMatrix2(Float4 lhs, Float4 rhs) {
+    return sub(mul(lhs, swizzle<3, 0, 3, 0>(rhs)), mul(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+}
+
+} // priv
+/**
+ * \endcond
+ */
+
+inline void inverseMatrix4(const float* matrix, float* result) {
+    // Blockwise inversion, with the matrix split in four 2x2 matrices A, B, C and D
+    // The inverse of the transpose is the transpose of the inverse, so the columns can be handled as rows
+    const Float4 r0 = load(matrix);
+    const Float4 r1 = load(matrix + 4);
+    const Float4 r2 = load(matrix + 8);
+    const Float4 r3 = load(matrix + 12);
+
+    const Float4 a = shuffle<0, 1, 0, 1>(r0, r1);
+    const Float4 b = shuffle<2, 3, 2, 3>(r0, r1);
+    const Float4 c = shuffle<0, 1, 0, 1>(r2, r3);
+    const Float4 d = shuffle<2, 3, 2, 3>(r2, r3);
+
+    // Determinants of A, B, C and D
+    const Float4 detSub = sub(
+        mul(shuffle<0, 2, 0, 2>(r0, r2), shuffle<1, 3, 1, 3>(r1, r3)),
+        mul(shuffle<1, 3, 1, 3>(r0, r2), shuffle<0, 2, 0, 2>(r1, r3))
+    );
+
+    const Float4 detA = broadcast<0>(detSub);
+    const Float4 detB = broadcast<1>(detSub);
+    const Float4 detC = broadcast<2>(detSub);
+    const Float4 detD = broadcast<3>(detSub);
+
+    const Float4 dc = priv::adjMultiplyMatrix2(d, c);
+    const Float4 ab = priv::adjMultiplyMatrix2(a, b);
+
+    const Float4 x = sub(mul(detD, a), priv::multiplyMatrix2(b, dc));
+    const Float4 w = sub(mul(detA, d), priv::multiplyMatrix2(c, ab));
+    const Float4 y = sub(mul(detB, c), priv::multiplyAdjMatrix2(d, ab));
+    const Float4 z = sub(mul(detC, b), priv::multiplyAdjMatrix2(a, dc));
+
+    // det(M) = det(A) * det(D) + det(B) * det(C) - tr(adj(A) * B * adj(D) * C)
+    Float4 trace = mul(ab, swizzle<0, 2, 1, 3>(dc));
+    trace = add(trace, swizzle<2, 3, 0, 1>(trace));
+    trace = add(trace, swizzle<1, 0, 3, 2>(trace));
+
+    const Float4 det = sub(add(mul(detA, detD), mul(detB, detC)), trace);
+    const Float4 invDet = div(set(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+    const Float4 invX = mul(x, invDet);
+    const Float4 invY = mul(y, invDet);
+    const Float4 invZ = mul(z, invDet);
+    const Float4 invW = mul(w, invDet);
+
+    store(result, shuffle<3, 1, 3, 1>(invX, invY));
+    store(result + 4, shuffle<2, 0, 2, 0>(invX, invY));
+    store(result + 8, shuffle<3, 1, 3, 1>(invZ, invW));
+    store(result + 12, shuffle<2, 0, 2, 0>(invZ, invW));
+}
+
+inline Float4 transformVector4(Float4 c0, Float4 c1, Float4 c2, Float4 c3, Float4 vector) {
+    return madd(c3, broadcast<3>(vector), madd(c2, broadcast<2>(vector), madd(c1, broadcast<1>(vector), mul(c0, broadcast<0>(vector)))));
+}
+
+inline Float4 transformVector4(const float* matrix, Float4 vector) {
+    return transformVector4(load(matrix), load(matrix + 4), load(matrix + 8), load(matrix + 12), vector);
+}
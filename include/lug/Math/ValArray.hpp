@@ -3,35 +3,65 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <initializer_list>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 
 namespace lug {
 namespace Math {
 
+// Base of the element-wise expressions on ValArrays, `Expression` is the derived type
+// The operators don't compute anything, they build an expression evaluated in a single loop
+// when it is assigned to a ValArray, so a chain of operations creates no temporary array
+// The ValArrays in an expression are held by reference, an expression must not outlive its operands
+template <typename Expression, size_t Size, typename T>
+class ValArrayExpression {
+public:
+    constexpr T operator[](size_t pos) const;
+
+    constexpr size_t size() const;
+
+    constexpr T sum() const;
+
+    constexpr const Expression& getExpression() const;
+};
+
 template <size_t Size, typename T = float>
-class ValArray {
+class ValArray : public ValArrayExpression<ValArray<Size, T>, Size, T> {
+public:
+    // The arrays up to this size (the matrices) are built in a single expression, usable in constant expressions
+    static constexpr size_t MaxUnrolledSize = 16;
+
 public:
     ValArray() = default;
-    explicit ValArray(const T& value);
+    explicit constexpr ValArray(const T& value);
     explicit ValArray(const T* values);
     ValArray(const ValArray<Size, T>& rhs) = default;
     ValArray(ValArray<Size, T>&& rhs) = default;
-    ValArray(std::initializer_list<T> list);
+    constexpr ValArray(std::initializer_list<T> list);
+
+    // Evaluation of an expression
+    template <typename Expression>
+    constexpr ValArray(const ValArrayExpression<Expression, Size, T>& expression);
 
     ValArray<Size, T>& operator=(const ValArray<Size, T>& rhs) = default;
     ValArray<Size, T>& operator=(ValArray<Size, T>&& rhs) = default;
 
+    template <typename Expression>
+    ValArray<Size, T>& operator=(const ValArrayExpression<Expression, Size, T>& expression);
+
     ~ValArray() = default;
 
-    const T& operator[](size_t pos) const;
+    constexpr const T& operator[](size_t pos) const;
     T& operator[](size_t pos);
 
-    const std::array<T, Size>& data() const;
+    constexpr const std::array<T, Size>& data() const;
     std::array<T, Size>& data();
 
     constexpr size_t size() const;
 
-    T sum() const;
+    constexpr T sum() const;
 
     // ValArray/Scalar operations
     ValArray<Size, T>& operator+=(const T& rhs);
@@ -46,52 +76,142 @@ public:
     ValArray<Size, T>& operator/=(const ValArray<Size, T>& rhs);
 
 private:
-    std::array<T, Size> _data;
+    using Unrolled = std::integral_constant<bool, (Size <= MaxUnrolledSize)>;
+
+    template <typename Expression>
+    constexpr ValArray(const Expression& expression, std::true_type unrolled);
+
+    template <typename Expression>
+    ValArray(const Expression& expression, std::false_type unrolled);
+
+    template <typename Expression, size_t... Indices>
+    constexpr ValArray(const Expression& expression, std::index_sequence<Indices...>);
+
+private:
+    // The floats by 4 are aligned on 16 bytes for the SIMD operations (see lug/Math/Simd.hpp)
+    alignas((std::is_same<T, float>::value && Size % 4 == 0) ? 16 : alignof(std::array<T, Size>)) std::array<T, Size> _data;
+};
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// A scalar operand, the same value for all the elements
+template <size_t Size, typename T>
+class ValArrayScalar : public ValArrayExpression<ValArrayScalar<Size, T>, Size, T> {
+public:
+    explicit constexpr ValArrayScalar(const T& value);
+
+    constexpr const T& operator[](size_t pos) const;
+
+private:
+    T _value;
+};
+
+// The values of an initializer list, completed with `T()` if it is too short
+template <size_t Size, typename T>
+class ValArrayList : public ValArrayExpression<ValArrayList<Size, T>, Size, T> {
+public:
+    explicit constexpr ValArrayList(std::initializer_list<T> list);
+
+    constexpr T operator[](size_t pos) const;
+
+private:
+    std::initializer_list<T> _list;
+};
+
+// The ValArrays are held by reference, the other expressions (small) by value
+template <typename Expression>
+struct ValArrayOperand {
+    using Type = const Expression;
+};
+
+template <size_t Size, typename T>
+struct ValArrayOperand<ValArray<Size, T>> {
+    using Type = const ValArray<Size, T>&;
+};
+
+template <typename Lhs, typename Rhs, typename Operator, size_t Size, typename T>
+class ValArrayOperation : public ValArrayExpression<ValArrayOperation<Lhs, Rhs, Operator, Size, T>, Size, T> {
+public:
+    constexpr ValArrayOperation(const Lhs& lhs, const Rhs& rhs);
+
+    constexpr T operator[](size_t pos) const;
+
+private:
+    typename ValArrayOperand<Lhs>::Type _lhs;
+    typename ValArrayOperand<Rhs>::Type _rhs;
+};
+
+struct Add {
+    template <typename T>
+    static constexpr T apply(const T& lhs, const T& rhs);
+};
+
+struct Subtract {
+    template <typename T>
+    static constexpr T apply(const T& lhs, const T& rhs);
+};
+
+struct Multiply {
+    template <typename T>
+    static constexpr T apply(const T& lhs, const T& rhs);
+};
+
+struct Divide {
+    template <typename T>
+    static constexpr T apply(const T& lhs, const T& rhs);
 };
 
+} // priv
+/**
+ * \endcond
+ */
+
 // ValArray/Scalar operations
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const T& rhs);
+template <size_t Size, typename T, typename Lhs>
+constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Add, Size, T> operator+(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const T& rhs);
+template <size_t Size, typename T, typename Lhs>
+constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Subtract, Size, T> operator-(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const T& rhs);
+template <size_t Size, typename T, typename Lhs>
+constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Multiply, Size, T> operator*(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const T& rhs);
+template <size_t Size, typename T, typename Lhs>
+constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Divide, Size, T> operator/(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator+(const T& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Rhs>
+constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Add, Size, T> operator+(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator-(const T& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Rhs>
+constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Subtract, Size, T> operator-(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator*(const T& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Rhs>
+constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Multiply, Size, T> operator*(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator/(const T& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Rhs>
+constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Divide, Size, T> operator/(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
 // ValArray/ValArray operations
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Add, Size, T> operator+(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Subtract, Size, T> operator-(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Multiply, Size, T> operator*(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Divide, Size, T> operator/(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-bool operator==(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+constexpr bool operator==(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
-template <size_t Size, typename T = float>
-bool operator!=(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+constexpr bool operator!=(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs);
 
 #include <lug/Math/ValArray.inl>
 
@@ -1,20 +1,75 @@
-template <size_t Size, typename T>
-ValArray<Size, T>::ValArray(const T& value) {
-    _data.fill(value);
+template <typename Expression, size_t Size, typename T>
+inline constexpr T ValArrayExpression<Expression, Size, T>::operator[](size_t pos) const {
+    return getExpression()[pos];
+}
+
+template <typename Expression, size_t Size, typename T>
+inline constexpr size_t ValArrayExpression<Expression, Size, T>::size() const {
+    return Size;
+}
+
+template <typename Expression, size_t Size, typename T>
+inline constexpr T ValArrayExpression<Expression, Size, T>::sum() const {
+    T sum(0);
+
+    for (size_t i = 0; i < Size; ++i) {
+        sum += getExpression()[i];
+    }
+
+    return sum;
+}
+
+template <typename Expression, size_t Size, typename T>
+inline constexpr const Expression& ValArrayExpression<Expression, Size, T>::getExpression() const {
+    return static_cast<const Expression&>(*this);
 }
 
+template <size_t Size, typename T>
+inline constexpr ValArray<Size, T>::ValArray(const T& value) : ValArray(priv::ValArrayScalar<Size, T>(value), Unrolled{}) {}
+
 template <size_t Size, typename T>
 ValArray<Size, T>::ValArray(const T* values) {
     std::memcpy(_data.data(), values, sizeof(T) * Size);
 }
 
 template <size_t Size, typename T>
-ValArray<Size, T>::ValArray(std::initializer_list<T> list) {
-    std::copy(std::begin(list), std::end(list), std::begin(_data));
+inline constexpr ValArray<Size, T>::ValArray(std::initializer_list<T> list) : ValArray(priv::ValArrayList<Size, T>(list), Unrolled{}) {}
+
+template <size_t Size, typename T>
+template <typename Expression>
+inline constexpr ValArray<Size, T>::ValArray(const ValArrayExpression<Expression, Size, T>& expression) : ValArray(expression.getExpression(), Unrolled{}) {}
+
+template <size_t Size, typename T>
+template <typename Expression>
+inline constexpr ValArray<Size, T>::ValArray(const Expression& expression, std::true_type) : ValArray(expression, std::make_index_sequence<Size>{}) {}
+
+template <size_t Size, typename T>
+template <typename Expression>
+inline ValArray<Size, T>::ValArray(const Expression& expression, std::false_type) {
+    for (size_t i = 0; i < Size; ++i) {
+        _data[i] = expression[i];
+    }
+}
+
+template <size_t Size, typename T>
+template <typename Expression, size_t... Indices>
+inline constexpr ValArray<Size, T>::ValArray(const Expression& expression, std::index_sequence<Indices...>) : _data{{expression[Indices]...}} {}
+
+template <size_t Size, typename T>
+template <typename Expression>
+inline ValArray<Size, T>& ValArray<Size, T>::operator=(const ValArrayExpression<Expression, Size, T>& expression) {
+    const Expression& values = expression.getExpression();
+
+    // Each element only depends on the elements at the same position, so the expression can use this array
+    for (size_t i = 0; i < Size; ++i) {
+        _data[i] = values[i];
+    }
+
+    return *this;
 }
 
 template <size_t Size, typename T>
-inline const T& ValArray<Size, T>::operator[](size_t pos) const {
+inline constexpr const T& ValArray<Size, T>::operator[](size_t pos) const {
     return _data[pos];
 }
 
@@ -24,7 +79,7 @@ inline T& ValArray<Size, T>::operator[](size_t pos) {
 }
 
 template <size_t Size, typename T>
-inline const std::array<T, Size>& ValArray<Size, T>::data() const {
+inline constexpr const std::array<T, Size>& ValArray<Size, T>::data() const {
     return _data;
 }
 
@@ -39,8 +94,14 @@ inline constexpr size_t ValArray<Size, T>::size() const {
 }
 
 template <size_t Size, typename T>
-inline T ValArray<Size, T>::sum() const {
-    return std::accumulate(std::begin(_data), std::end(_data), T(0));
+inline constexpr T ValArray<Size, T>::sum() const {
+    T sum(0);
+
+    for (size_t i = 0; i < Size; ++i) {
+        sum += _data[i];
+    }
+
+    return sum;
 }
 
 // ValArray/Scalar operations
@@ -117,146 +178,134 @@ inline ValArray<Size, T>& ValArray<Size, T>::operator/=(const ValArray<Size, T>&
     return *this;
 }
 
-// ValArray/Scalar operations
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] += rhs;
-    }
-
-    return array;
-}
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] -= rhs;
-    }
+inline constexpr ValArrayScalar<Size, T>::ValArrayScalar(const T& value) : _value(value) {}
 
-    return array;
+template <size_t Size, typename T>
+inline constexpr const T& ValArrayScalar<Size, T>::operator[](size_t) const {
+    return _value;
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] *= rhs;
-    }
+inline constexpr ValArrayList<Size, T>::ValArrayList(std::initializer_list<T> list) : _list(list) {}
 
-    return array;
+template <size_t Size, typename T>
+inline constexpr T ValArrayList<Size, T>::operator[](size_t pos) const {
+    return pos < _list.size() ? _list.begin()[pos] : T();
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
+template <typename Lhs, typename Rhs, typename Operator, size_t Size, typename T>
+inline constexpr ValArrayOperation<Lhs, Rhs, Operator, Size, T>::ValArrayOperation(const Lhs& lhs, const Rhs& rhs) : _lhs(lhs), _rhs(rhs) {}
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] /= rhs;
-    }
+template <typename Lhs, typename Rhs, typename Operator, size_t Size, typename T>
+inline constexpr T ValArrayOperation<Lhs, Rhs, Operator, Size, T>::operator[](size_t pos) const {
+    return Operator::apply(_lhs[pos], _rhs[pos]);
+}
 
-    return array;
+template <typename T>
+inline constexpr T Add::apply(const T& lhs, const T& rhs) {
+    return lhs + rhs;
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator+(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
+template <typename T>
+inline constexpr T Subtract::apply(const T& lhs, const T& rhs) {
+    return lhs - rhs;
+}
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs + array[i];
-    }
+template <typename T>
+inline constexpr T Multiply::apply(const T& lhs, const T& rhs) {
+    return lhs * rhs;
+}
 
-    return array;
+template <typename T>
+inline constexpr T Divide::apply(const T& lhs, const T& rhs) {
+    return lhs / rhs;
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator-(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
+} // priv
+/**
+ * \endcond
+ */
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs - array[i];
-    }
+// ValArray/Scalar operations
+template <size_t Size, typename T, typename Lhs>
+inline constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Add, Size, T> operator+(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs) {
+    return {lhs.getExpression(), priv::ValArrayScalar<Size, T>(rhs)};
+}
 
-    return array;
+template <size_t Size, typename T, typename Lhs>
+inline constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Subtract, Size, T> operator-(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs) {
+    return {lhs.getExpression(), priv::ValArrayScalar<Size, T>(rhs)};
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator*(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
+template <size_t Size, typename T, typename Lhs>
+inline constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Multiply, Size, T> operator*(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs) {
+    return {lhs.getExpression(), priv::ValArrayScalar<Size, T>(rhs)};
+}
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs * array[i];
-    }
+template <size_t Size, typename T, typename Lhs>
+inline constexpr priv::ValArrayOperation<Lhs, priv::ValArrayScalar<Size, T>, priv::Divide, Size, T> operator/(const ValArrayExpression<Lhs, Size, T>& lhs, const T& rhs) {
+    return {lhs.getExpression(), priv::ValArrayScalar<Size, T>(rhs)};
+}
 
-    return array;
+template <size_t Size, typename T, typename Rhs>
+inline constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Add, Size, T> operator+(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {priv::ValArrayScalar<Size, T>(lhs), rhs.getExpression()};
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator/(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
+template <size_t Size, typename T, typename Rhs>
+inline constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Subtract, Size, T> operator-(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {priv::ValArrayScalar<Size, T>(lhs), rhs.getExpression()};
+}
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs / array[i];
-    }
+template <size_t Size, typename T, typename Rhs>
+inline constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Multiply, Size, T> operator*(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {priv::ValArrayScalar<Size, T>(lhs), rhs.getExpression()};
+}
 
-    return array;
+template <size_t Size, typename T, typename Rhs>
+inline constexpr priv::ValArrayOperation<priv::ValArrayScalar<Size, T>, Rhs, priv::Divide, Size, T> operator/(const T& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {priv::ValArrayScalar<Size, T>(lhs), rhs.getExpression()};
 }
 
 // ValArray/ValArray operations
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] += rhs[i];
-    }
-
-    return array;
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+inline constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Add, Size, T> operator+(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {lhs.getExpression(), rhs.getExpression()};
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] -= rhs[i];
-    }
-
-    return array;
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+inline constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Subtract, Size, T> operator-(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {lhs.getExpression(), rhs.getExpression()};
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] *= rhs[i];
-    }
-
-    return array;
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+inline constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Multiply, Size, T> operator*(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {lhs.getExpression(), rhs.getExpression()};
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+inline constexpr priv::ValArrayOperation<Lhs, Rhs, priv::Divide, Size, T> operator/(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return {lhs.getExpression(), rhs.getExpression()};
+}
 
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+inline constexpr bool operator==(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
     for (size_t i = 0; i < Size; ++i) {
-        array[i] /= rhs[i];
+        if (lhs.getExpression()[i] != rhs.getExpression()[i]) {
+            return false;
+        }
     }
 
-    return array;
-}
-
-template <size_t Size, typename T>
-inline bool operator==(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    return std::equal(std::begin(lhs.data()), std::end(lhs.data()), std::begin(rhs.data()), std::end(rhs.data()));
+    return true;
 }
 
-template <size_t Size, typename T>
-inline bool operator!=(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    return !std::equal(std::begin(lhs.data()), std::end(lhs.data()), std::begin(rhs.data()), std::end(rhs.data()));
+template <size_t Size, typename T, typename Lhs, typename Rhs>
+inline constexpr bool operator!=(const ValArrayExpression<Lhs, Size, T>& lhs, const ValArrayExpression<Rhs, Size, T>& rhs) {
+    return !(lhs == rhs);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 #include <lug/Math/Matrix.hpp>
 
 namespace lug {
@@ -16,14 +17,18 @@ public:
     constexpr Vector() = default;
 
     explicit constexpr Vector(T value);
-    Vector(std::initializer_list<T> list);
+    constexpr Vector(std::initializer_list<T> list);
 
     // Convert from matrix (we want non explicit conversion)
-    Vector(const BaseMatrix& matrix);
-    Vector(BaseMatrix&& matrix);
+    constexpr Vector(const BaseMatrix& matrix);
+    constexpr Vector(BaseMatrix&& matrix);
 
-    Vector(const Vector<Rows - 1, T>& vector, T value = 0);
-    Vector(const Vector<Rows + 1, T>& vector);
+    // Evaluation of an expression
+    template <typename OperationValues>
+    constexpr Vector(const priv::MatrixOperation<OperationValues, Rows, 1, T>& operation);
+
+    constexpr Vector(const Vector<Rows - 1, T>& vector, T value = 0);
+    constexpr Vector(const Vector<Rows + 1, T>& vector);
 
     Vector(const Vector<Rows, T>& vector) = default;
     Vector(Vector<Rows, T>&& vector) = default;
@@ -31,6 +36,9 @@ public:
     Vector<Rows, T>& operator=(const Vector<Rows, T>& vector) = default;
     Vector<Rows, T>& operator=(Vector<Rows, T>&& vector) = default;
 
+    template <typename OperationValues>
+    Vector<Rows, T>& operator=(const priv::MatrixOperation<OperationValues, Rows, 1, T>& operation);
+
     ~Vector() = default;
 
     Vector<Rows, T> operator*=(const Matrix<Rows, Rows, T>& rhs);
@@ -40,7 +48,7 @@ public:
 
 #define DEFINE_ACCESS(name, minimum_rows)                                                                               \
     template <bool EnableBool = true, typename = typename std::enable_if<(Rows >= minimum_rows) && EnableBool>::type>   \
-    const T& name() const {                                                                                             \
+    constexpr const T& name() const {                                                                                   \
         return (*this)(minimum_rows - 1);                                                                               \
     }                                                                                                                   \
                                                                                                                         \
@@ -66,6 +74,13 @@ public:
     constexpr T length() const;
     constexpr T squaredLength() const;
     void normalize();
+
+private:
+    template <size_t... Indices>
+    constexpr Vector(const Vector<Rows - 1, T>& vector, T value, std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    constexpr Vector(const Vector<Rows + 1, T>& vector, std::index_sequence<Indices...>);
 };
 
 template <typename T>
@@ -103,23 +118,43 @@ DEFINE_LENGTH_VECTOR(4)
 #undef DEFINE_LENGTH_VECTOR
 
 template <uint8_t Rows, typename T>
-Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
+constexpr Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
 
 template <uint8_t Rows, typename T>
-Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
+constexpr Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
 
 template <uint8_t Rows, typename T>
-Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Matrix<Rows, Rows, T>& rhs);
+constexpr Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Matrix<Rows, Rows, T>& rhs);
 
 template <uint8_t Rows, typename T>
-Vector<Rows, T> operator*(const Matrix<Rows, Rows, T>& lhs, const Vector<Rows, T>& rhs);
+constexpr Vector<Rows, T> operator*(const Matrix<Rows, Rows, T>& lhs, const Vector<Rows, T>& rhs);
 
 // Special case Mat4x4 * Vec3
 template <typename T>
-Vector<3, T> operator*(const Vector<3, T>& lhs, const Matrix<4, 4, T>& rhs);
+constexpr Vector<3, T> operator*(const Vector<3, T>& lhs, const Matrix<4, 4, T>& rhs);
 
 template <typename T>
-Vector<3, T> operator*(const Matrix<4, 4, T>& lhs, const Vector<3, T>& rhs);
+constexpr Vector<3, T> operator*(const Matrix<4, 4, T>& lhs, const Vector<3, T>& rhs);
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+Vector<4, float> transformSimd(const Matrix<4, 4, float>& lhs, const Vector<4, float>& rhs);
+Vector<3, float> transformSimd(const Matrix<4, 4, float>& lhs, const Vector<3, float>& rhs);
+
+} // priv
+/**
+ * \endcond
+ */
+
+// SIMD versions (see lug/Math/Simd.hpp), the generic versions are used in constant expressions
+constexpr Vector<4, float> operator*(const Vector<4, float>& lhs, const Matrix<4, 4, float>& rhs);
+constexpr Vector<4, float> operator*(const Matrix<4, 4, float>& lhs, const Vector<4, float>& rhs);
+
+constexpr Vector<3, float> operator*(const Vector<3, float>& lhs, const Matrix<4, 4, float>& rhs);
+constexpr Vector<3, float> operator*(const Matrix<4, 4, float>& lhs, const Vector<3, float>& rhs);
 
 #include <lug/Math/Vector.inl>
 
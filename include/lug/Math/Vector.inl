@@ -2,28 +2,37 @@ template <uint8_t Rows, typename T>
 inline constexpr Vector<Rows, T>::Vector(T value) : Matrix<Rows, 1, T>(value) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(std::initializer_list<T> list) : Matrix<Rows, 1, T>(list) {}
+inline constexpr Vector<Rows, T>::Vector(std::initializer_list<T> list) : Matrix<Rows, 1, T>(list) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(const typename Vector<Rows, T>::BaseMatrix& matrix) : Matrix<Rows, 1, T>(matrix) {}
+inline constexpr Vector<Rows, T>::Vector(const typename Vector<Rows, T>::BaseMatrix& matrix) : Matrix<Rows, 1, T>(matrix) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(typename Vector<Rows, T>::BaseMatrix&& matrix) : Matrix<Rows, 1, T>(std::move(matrix)) {}
+inline constexpr Vector<Rows, T>::Vector(typename Vector<Rows, T>::BaseMatrix&& matrix) : Matrix<Rows, 1, T>(std::move(matrix)) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(const Vector<Rows - 1, T>& vector, T value) {
-    for (uint8_t row = 0; row < Rows - 1; ++row) {
-        (*this)(row) = vector(row);
-    }
+template <typename OperationValues>
+inline constexpr Vector<Rows, T>::Vector(const priv::MatrixOperation<OperationValues, Rows, 1, T>& operation) : Matrix<Rows, 1, T>(operation) {}
 
-    (*this)(Rows - 1) = value;
-}
+template <uint8_t Rows, typename T>
+inline constexpr Vector<Rows, T>::Vector(const Vector<Rows - 1, T>& vector, T value) : Vector(vector, value, std::make_index_sequence<Rows - 1>{}) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(const Vector<Rows + 1, T>& vector) {
-    for (uint8_t row = 0; row < Rows; ++row) {
-        (*this)(row) = vector(row);
-    }
+inline constexpr Vector<Rows, T>::Vector(const Vector<Rows + 1, T>& vector) : Vector(vector, std::make_index_sequence<Rows>{}) {}
+
+template <uint8_t Rows, typename T>
+template <size_t... Indices>
+inline constexpr Vector<Rows, T>::Vector(const Vector<Rows - 1, T>& vector, T value, std::index_sequence<Indices...>) : Matrix<Rows, 1, T>{vector(Indices)..., value} {}
+
+template <uint8_t Rows, typename T>
+template <size_t... Indices>
+inline constexpr Vector<Rows, T>::Vector(const Vector<Rows + 1, T>& vector, std::index_sequence<Indices...>) : Matrix<Rows, 1, T>{vector(Indices)...} {}
+
+template <uint8_t Rows, typename T>
+template <typename OperationValues>
+inline Vector<Rows, T>& Vector<Rows, T>::operator=(const priv::MatrixOperation<OperationValues, Rows, 1, T>& operation) {
+    BaseMatrix::operator=(operation);
+    return *this;
 }
 
 template <uint8_t Rows, typename T>
@@ -55,7 +64,7 @@ inline Vector<Rows, T> Vector<Rows, T>::operator/=(const Vector<Rows, T>& rhs) {
 
 template <uint8_t Rows, typename T>
 inline constexpr T Vector<Rows, T>::length() const {
-    return T(std::sqrt(squaredLength()));
+    return T(Constexpr::sqrt(squaredLength()));
 }
 
 template <uint8_t Rows, typename T>
@@ -93,39 +102,79 @@ inline constexpr Vector<Rows, T> normalize(const Vector<Rows, T>& lhs) {
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
-    return {lhs.getValues() * rhs.getValues()};
+inline constexpr Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, 1, T>(lhs.getValues() * rhs.getValues());
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
-    return {lhs.getValues() / rhs.getValues()};
+inline constexpr Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, 1, T>(lhs.getValues() / rhs.getValues());
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Matrix<Rows, Rows, T>& rhs) {
-    Vector<Rows, T> vector{lhs};
-
-    vector *= rhs;
-
-    return vector;
+inline constexpr Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Matrix<Rows, Rows, T>& rhs) {
+    return rhs * lhs;
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T> operator*(const Matrix<Rows, Rows, T>& lhs, const Vector<Rows, T>& rhs) {
-    Vector<Rows, T> vector{rhs};
-
-    vector *= lhs;
-
-    return vector;
+inline constexpr Vector<Rows, T> operator*(const Matrix<Rows, Rows, T>& lhs, const Vector<Rows, T>& rhs) {
+    return priv::makeMatrixOperation<Rows, 1, T>(priv::MatrixProduct<Rows, Rows, 1, T>(lhs, rhs));
 }
 
 template <typename T>
-inline Vector<3, T> operator*(const Vector<3, T>& lhs, const Matrix<4, 4, T>& rhs) {
+inline constexpr Vector<3, T> operator*(const Vector<3, T>& lhs, const Matrix<4, 4, T>& rhs) {
     return Vector<4, T>{lhs, T(1)} * rhs;
 }
 
 template <typename T>
-inline Vector<3, T> operator*(const Matrix<4, 4, T>& lhs, const Vector<3, T>& rhs) {
+inline constexpr Vector<3, T> operator*(const Matrix<4, 4, T>& lhs, const Vector<3, T>& rhs) {
     return lhs * Vector<4, T>{rhs, T(1)};
 }
+
+inline constexpr Vector<4, float> operator*(const Vector<4, float>& lhs, const Matrix<4, 4, float>& rhs) {
+    return rhs * lhs;
+}
+
+inline constexpr Vector<4, float> operator*(const Matrix<4, 4, float>& lhs, const Vector<4, float>& rhs) {
+    return Constexpr::isConstantEvaluated() ? operator*<4, float>(lhs, rhs) : priv::transformSimd(lhs, rhs);
+}
+
+inline constexpr Vector<3, float> operator*(const Vector<3, float>& lhs, const Matrix<4, 4, float>& rhs) {
+    return rhs * lhs;
+}
+
+inline constexpr Vector<3, float> operator*(const Matrix<4, 4, float>& lhs, const Vector<3, float>& rhs) {
+    return Constexpr::isConstantEvaluated() ? operator*<float>(lhs, rhs) : priv::transformSimd(lhs, rhs);
+}
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+inline Vector<4, float> transformSimd(const Matrix<4, 4, float>& lhs, const Vector<4, float>& rhs) {
+    Vector<4, float> vector;
+
+    Simd::store(
+        vector.getValues().data().data(),
+        Simd::transformVector4(lhs.getValues().data().data(), Simd::load(rhs.getValues().data().data()))
+    );
+
+    return vector;
+}
+
+inline Vector<3, float> transformSimd(const Matrix<4, 4, float>& lhs, const Vector<3, float>& rhs) {
+    Vector<3, float> vector;
+
+    Simd::store3(
+        vector.getValues().data().data(),
+        Simd::transformVector4(lhs.getValues().data().data(), Simd::load3(rhs.getValues().data().data(), 1.0f))
+    );
+
+    return vector;
+}
+
+} // priv
+/**
+ * \endcond
+ */
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <lug/System/Export.hpp>
+#include <lug/System/Logger/Common.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+class Logger;
+
+// What `push` does when the queue is full
+enum class OverflowPolicy : uint8_t {
+    Block,      // Waits for the background thread to make room, handled in place when pushed by the background thread
+    Drop,       // Discards the new message
+    Overwrite   // Discards the oldest message
+};
+
+// Moves the work of the handlers to a background thread, see `Logger::setAsyncQueue`
+// The loggers only format their message and push it in a bounded ring buffer (lock-free, multiple producers),
+// the background thread pops the messages and calls `Logger::handle` with them, so the handlers
+// of the loggers using the queue are only called from this thread
+// The loggers must outlive the queue, its destructor handles the messages left
+class LUG_SYSTEM_API AsyncQueue {
+public:
+    // The text of the messages is stored in the queue up to this size, the longer ones are allocated
+    static constexpr size_t InlineSize = 216;
+
+public:
+    // `capacity` is rounded up to a power of two
+    explicit AsyncQueue(size_t capacity = 8192, OverflowPolicy policy = OverflowPolicy::Block);
+
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue(AsyncQueue&&) = delete;
+
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(AsyncQueue&&) = delete;
+
+    ~AsyncQueue();
+
+    // Returns false if the message was dropped
+    bool push(Logger& logger, Level level, const char* text, size_t size);
+
+    // The handlers of `logger` are flushed by the background thread
+    bool pushFlush(Logger& logger);
+
+    // Waits until all the messages pushed before the call are handled
+    void wait();
+
+    size_t getCapacity() const;
+    OverflowPolicy getOverflowPolicy() const;
+
+    // Messages discarded by the `Drop` and `Overwrite` policies
+    uint64_t getDroppedCount() const;
+
+private:
+    struct Record {
+        Logger* logger;
+        std::chrono::system_clock::time_point time;
+
+        // `nullptr` if the text is inline
+        char* longText;
+
+        uint32_t size;
+        Level level;
+        bool flush;
+
+        char text[InlineSize];
+    };
+
+    // 256 bytes
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+private:
+    bool push(const Record& record, const char* text);
+    bool tryPush(const Record& record, const char* text);
+    bool tryPop(Record& record);
+    bool isEmpty() const;
+
+    void wakeUp();
+    void run();
+    void handle(Record& record);
+
+    // Calls the handlers of the logger of `record`, `text` is the text of the message
+    void dispatch(const Record& record, const char* text);
+
+private:
+    std::unique_ptr<Cell[]> _cells;
+    const size_t _mask;
+    const OverflowPolicy _policy;
+
+    // Producers and consumer on different cache lines (no alignas, the queue could be allocated with `new`)
+    struct Positions {
+        char padding0[64];
+        std::atomic<size_t> push{0};
+        char padding1[64];
+        std::atomic<size_t> pop{0};
+        std::atomic<size_t> handled{0};
+        char padding2[64];
+    };
+
+    Positions _positions;
+    std::atomic<uint64_t> _droppedCount{0};
+
+    // The background thread sleeps when the queue is empty
+    std::atomic<bool> _sleeping{false};
+    std::atomic<bool> _running{true};
+    std::mutex _mutex;
+    std::condition_variable _condition;
+
+    std::thread _thread;
+};
+
+} // Logger
+} // System
+} // lug
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <lug/System/Export.hpp>
+#include <lug/System/Logger/BinaryFormat.hpp>
+#include <lug/System/Logger/Handler.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+// Reads back the files written by `BinaryHandler` and gives the messages to a handler as text,
+// formatted with the pattern of the handler
+class LUG_SYSTEM_API BinaryDecoder {
+public:
+    BinaryDecoder() = default;
+
+    BinaryDecoder(const BinaryDecoder&) = delete;
+    BinaryDecoder(BinaryDecoder&&) = default;
+
+    BinaryDecoder& operator=(const BinaryDecoder&) = delete;
+    BinaryDecoder& operator=(BinaryDecoder&&) = default;
+
+    ~BinaryDecoder() = default;
+
+    // Reads the log file and its table (`filename` + ".table"), false if one of them is missing or invalid
+    bool open(const std::string& filename);
+
+    // Returns the number of messages given to `handler` (only the ones of its levels),
+    // stops at the first invalid record
+    size_t decode(Handler& handler) const;
+
+private:
+    struct Arg {
+        priv::BinaryFormat::ArgType type;
+
+        union {
+            bool b;
+            char c;
+            int64_t i;
+            uint64_t u;
+            float f;
+            double d;
+        };
+
+        const char* string;
+        uint32_t stringSize;
+    };
+
+    bool readArgs(const char* data, const char* end, uint8_t count, std::vector<Arg>& args) const;
+    bool writeText(fmt::MemoryWriter& out, const std::string& format, const std::vector<Arg>& args) const;
+    const std::string* getString(uint32_t id) const;
+
+    static void writeArg(fmt::MemoryWriter& out, const std::string& spec, const Arg& arg);
+
+private:
+    // The records, header of the file included
+    std::vector<char> _data;
+    std::unordered_map<uint32_t, std::string> _strings;
+};
+
+} // Logger
+} // System
+} // lug
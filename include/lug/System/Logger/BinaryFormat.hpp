@@ -0,0 +1,164 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <lug/System/Logger/Common.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// Layout of the files of `BinaryHandler`, read back by `BinaryDecoder`
+// The log file starts with a `FileHeader` followed by the records, each one a `RecordHeader`
+// followed by the encoded arguments (a type then the value, unaligned) and padded to 8 bytes
+// The strings (formats and logger names) are written once in the table file, as (id, size, characters)
+namespace BinaryFormat {
+
+constexpr char Magic[8] = {'L', 'U', 'G', 'B', 'L', 'O', 'G', '\0'};
+constexpr uint32_t Version = 1;
+constexpr const char* TableExtension = ".table";
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+
+    // Bytes used in the file, header included
+    uint64_t size;
+};
+
+struct RecordHeader {
+    // Header and arguments included
+    uint32_t size;
+
+    uint32_t formatId;
+    uint32_t loggerId;
+    uint8_t level;
+    uint8_t argCount;
+    uint16_t padding;
+
+    // Nanoseconds since the epoch of `std::chrono::system_clock`
+    int64_t time;
+};
+
+enum class ArgType : uint8_t {
+    Bool,
+    Char,
+    Int,        // int64_t
+    UInt,       // uint64_t
+    Float,
+    Double,
+    String,     // uint32_t size then the characters
+    Pointer     // uint64_t
+};
+
+} // BinaryFormat
+
+// What the loggers give to the binary handlers, the arguments are encoded by the handler in its own memory
+struct BinaryMessage {
+    const std::string& loggerName;
+    Level level;
+    std::chrono::system_clock::time_point time;
+
+    // Identified by its address, the content is checked
+    const char* format;
+    size_t formatSize;
+
+    uint8_t argCount;
+    size_t argsSize;
+    void (*encodeArgs)(const void* args, char* out);
+    const void* args;
+};
+
+// How an argument is kept until it's encoded: by value for the fundamental types and the pointers,
+// by reference for the strings, and formatted to a string for the others (e.g. with `operator<<`)
+template <typename T, typename Enable = void>
+struct BinaryArg {
+    using Type = std::string;
+
+    static std::string convert(const T& value);
+};
+
+template <typename T>
+struct BinaryArg<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_pointer<T>::value>::type> {
+    using Type = T;
+
+    static T convert(T value);
+};
+
+template <>
+struct BinaryArg<std::string> {
+    using Type = const std::string&;
+
+    static const std::string& convert(const std::string& value);
+};
+
+size_t getArgSize(bool);
+size_t getArgSize(char);
+size_t getArgSize(float);
+size_t getArgSize(double);
+size_t getArgSize(long double);
+size_t getArgSize(const char* value);
+size_t getArgSize(char* value);
+size_t getArgSize(const std::string& value);
+
+template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value, int>::type = 0>
+size_t getArgSize(T);
+
+template <typename T>
+size_t getArgSize(const T*);
+
+void encodeArg(char*& out, bool value);
+void encodeArg(char*& out, char value);
+void encodeArg(char*& out, float value);
+void encodeArg(char*& out, double value);
+void encodeArg(char*& out, long double value);
+void encodeArg(char*& out, const char* value);
+void encodeArg(char*& out, char* value);
+void encodeArg(char*& out, const std::string& value);
+
+template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value, int>::type = 0>
+void encodeArg(char*& out, T value);
+
+template <typename T>
+void encodeArg(char*& out, const T* value);
+
+template <typename Tuple, size_t... Indices>
+size_t getArgsSize(const Tuple& args, std::index_sequence<Indices...>);
+
+template <typename Tuple, size_t... Indices>
+void encodeArgs(const Tuple& args, char* out, std::index_sequence<Indices...>);
+
+// Type erased `encodeArgs`, for `BinaryMessage::encodeArgs`
+template <typename Tuple>
+void encodeTuple(const void* args, char* out);
+
+// The format strings, by address
+const char* getFormatString(const char* format);
+const char* getFormatString(const std::string& format);
+
+size_t getFormatSize(const char* format);
+size_t getFormatSize(const std::string& format);
+
+#include <lug/System/Logger/BinaryFormat.inl>
+
+} // priv
+/**
+ * \endcond
+ */
+
+} // Logger
+} // System
+} // lug
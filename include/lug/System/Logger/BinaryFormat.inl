@@ -0,0 +1,155 @@
+template <typename T, typename Enable>
+inline std::string BinaryArg<T, Enable>::convert(const T& value) {
+    fmt::MemoryWriter writer;
+    writer.write("{}", value);
+    return writer.str();
+}
+
+template <typename T>
+inline T BinaryArg<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_pointer<T>::value>::type>::convert(T value) {
+    return value;
+}
+
+inline const std::string& BinaryArg<std::string>::convert(const std::string& value) {
+    return value;
+}
+
+template <typename T>
+inline void writeArg(char*& out, BinaryFormat::ArgType type, const T& value) {
+    *out++ = static_cast<char>(type);
+    std::memcpy(out, &value, sizeof(T));
+    out += sizeof(T);
+}
+
+inline void writeString(char*& out, const char* value, size_t size) {
+    const uint32_t stringSize = static_cast<uint32_t>(size);
+
+    writeArg(out, BinaryFormat::ArgType::String, stringSize);
+    std::memcpy(out, value, size);
+    out += size;
+}
+
+inline size_t getArgSize(bool) {
+    return 1 + sizeof(bool);
+}
+
+inline size_t getArgSize(char) {
+    return 1 + sizeof(char);
+}
+
+inline size_t getArgSize(float) {
+    return 1 + sizeof(float);
+}
+
+inline size_t getArgSize(double) {
+    return 1 + sizeof(double);
+}
+
+inline size_t getArgSize(long double) {
+    return 1 + sizeof(double);
+}
+
+inline size_t getArgSize(const char* value) {
+    return 1 + sizeof(uint32_t) + (value ? std::strlen(value) : 0);
+}
+
+inline size_t getArgSize(char* value) {
+    return getArgSize(static_cast<const char*>(value));
+}
+
+inline size_t getArgSize(const std::string& value) {
+    return 1 + sizeof(uint32_t) + value.size();
+}
+
+template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value, int>::type>
+inline size_t getArgSize(T) {
+    return 1 + sizeof(uint64_t);
+}
+
+template <typename T>
+inline size_t getArgSize(const T*) {
+    return 1 + sizeof(uint64_t);
+}
+
+inline void encodeArg(char*& out, bool value) {
+    writeArg(out, BinaryFormat::ArgType::Bool, value);
+}
+
+inline void encodeArg(char*& out, char value) {
+    writeArg(out, BinaryFormat::ArgType::Char, value);
+}
+
+inline void encodeArg(char*& out, float value) {
+    writeArg(out, BinaryFormat::ArgType::Float, value);
+}
+
+inline void encodeArg(char*& out, double value) {
+    writeArg(out, BinaryFormat::ArgType::Double, value);
+}
+
+inline void encodeArg(char*& out, long double value) {
+    writeArg(out, BinaryFormat::ArgType::Double, static_cast<double>(value));
+}
+
+inline void encodeArg(char*& out, const char* value) {
+    writeString(out, value ? value : "", value ? std::strlen(value) : 0);
+}
+
+inline void encodeArg(char*& out, char* value) {
+    encodeArg(out, static_cast<const char*>(value));
+}
+
+inline void encodeArg(char*& out, const std::string& value) {
+    writeString(out, value.data(), value.size());
+}
+
+template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value, int>::type>
+inline void encodeArg(char*& out, T value) {
+    if (std::is_signed<T>::value) {
+        writeArg(out, BinaryFormat::ArgType::Int, static_cast<int64_t>(value));
+    } else {
+        writeArg(out, BinaryFormat::ArgType::UInt, static_cast<uint64_t>(value));
+    }
+}
+
+template <typename T>
+inline void encodeArg(char*& out, const T* value) {
+    writeArg(out, BinaryFormat::ArgType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+}
+
+template <typename Tuple, size_t... Indices>
+inline size_t getArgsSize(const Tuple& args, std::index_sequence<Indices...>) {
+    size_t size = 0;
+    (void)std::initializer_list<int>{(size += getArgSize(std::get<Indices>(args)), 0)...};
+    (void)(args);
+
+    return size;
+}
+
+template <typename Tuple, size_t... Indices>
+inline void encodeArgs(const Tuple& args, char* out, std::index_sequence<Indices...>) {
+    (void)std::initializer_list<int>{(encodeArg(out, std::get<Indices>(args)), 0)...};
+    (void)(args);
+    (void)(out);
+}
+
+template <typename Tuple>
+inline void encodeTuple(const void* args, char* out) {
+    encodeArgs(*static_cast<const Tuple*>(args), out, std::make_index_sequence<std::tuple_size<Tuple>::value>());
+}
+
+inline const char* getFormatString(const char* format) {
+    return format;
+}
+
+inline const char* getFormatString(const std::string& format) {
+    return format.c_str();
+}
+
+inline size_t getFormatSize(const char* format) {
+    return std::strlen(format);
+}
+
+inline size_t getFormatSize(const std::string& format) {
+    return format.size();
+}
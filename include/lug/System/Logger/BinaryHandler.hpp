@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <lug/System/Export.hpp>
+#include <lug/System/Logger/BinaryFormat.hpp>
+#include <lug/System/Logger/Handler.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+// Writes the messages without formatting them: the id of the format string, the level, the time and the raw arguments
+// are copied in a memory-mapped file, and each format string is written once in a separate table (`filename` + ".table")
+// The files are turned back to text with `BinaryDecoder` (or the LogDecoder tool)
+// The messages handled as text (e.g. through an `AsyncQueue`) are written with the format "{}"
+// When the file is full, the messages are dropped
+// The messages can be handled from several threads at once: the space of a record is reserved atomically,
+// the string table and the size in the file header are guarded by a mutex
+class LUG_SYSTEM_API BinaryHandler : public Handler {
+public:
+    static constexpr size_t DefaultCapacity = 64 * 1024 * 1024;
+
+public:
+    BinaryHandler(const std::string& name, const std::string& filename, size_t capacity = DefaultCapacity);
+
+    BinaryHandler(const BinaryHandler&) = delete;
+    BinaryHandler(BinaryHandler&&) = delete;
+
+    BinaryHandler& operator=(const BinaryHandler&) = delete;
+    BinaryHandler& operator=(BinaryHandler&&) = delete;
+
+    // Truncates the file to the size used
+    ~BinaryHandler();
+
+    void handle(const priv::Message& msg) override;
+    void handleBinary(const priv::BinaryMessage& msg) override;
+    void flush() override;
+
+    size_t getSize() const;
+    size_t getCapacity() const;
+    uint64_t getDroppedCount() const;
+
+private:
+    // `_mutex` must be locked
+    uint32_t getStringId(const char* string, size_t size);
+    char* reserve(size_t size);
+
+    // Unmaps and closes the file, `size` is the size it is truncated to
+    void release(size_t size);
+
+private:
+    std::string _filename;
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    void* _file{nullptr};
+    void* _mapping{nullptr};
+#else
+    int _file{-1};
+#endif
+
+    char* _data{nullptr};
+    std::atomic<size_t> _size{0};
+    size_t _capacity{0};
+    std::atomic<uint64_t> _droppedCount{0};
+
+    // Bytes of the records completely written, `_size` also counts the ones being written
+    std::atomic<size_t> _writtenSize{0};
+
+    std::mutex _mutex;
+
+    // The strings already in the table, by address (the content is checked) and by content
+    // `_strings` points to the keys of `_ids`, by id
+    std::unordered_map<const void*, uint32_t> _idsByAddress;
+    std::unordered_map<std::string, uint32_t> _ids;
+    std::vector<const std::string*> _strings;
+    std::ofstream _table;
+};
+
+} // Logger
+} // System
+} // lug
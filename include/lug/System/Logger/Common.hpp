@@ -26,6 +26,19 @@
     PROCESS(Fatal, 0x10)            \
     PROCESS(Assert, 0x20)           
 
+// Minimum level compiled in, the calls to the lower levels are removed
+// e.g. -DLUG_LOG_LEVEL=LUG_LOG_LEVEL_WARNING to strip the debug and info messages
+#define LUG_LOG_LEVEL_DEBUG 0x01
+#define LUG_LOG_LEVEL_INFO 0x02
+#define LUG_LOG_LEVEL_WARNING 0x04
+#define LUG_LOG_LEVEL_ERROR 0x08
+#define LUG_LOG_LEVEL_FATAL 0x10
+#define LUG_LOG_LEVEL_ASSERT 0x20
+
+#if !defined(LUG_LOG_LEVEL)
+    #define LUG_LOG_LEVEL LUG_LOG_LEVEL_DEBUG
+#endif
+
 namespace lug {
 namespace System {
 namespace Logger {
@@ -36,6 +49,11 @@ enum class Level : uint8_t {
 };
 #undef LUG_LOG_ENUM
 
+// The levels are ordered, so the values are compared against the minimum
+constexpr bool isLevelCompiled(Level level) {
+    return static_cast<uint8_t>(level) >= LUG_LOG_LEVEL;
+}
+
 LUG_SYSTEM_API std::ostream& operator<<(std::ostream& os, Level level);
 
 } // Logger
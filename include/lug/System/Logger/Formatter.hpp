@@ -1,9 +1,10 @@
 #pragma once
 
 #include <chrono>
-#include <memory>
-#include <vector>
+#include <cstdint>
+#include <ctime>
 #include <string>
+#include <vector>
 #include <lug/System/Export.hpp>
 
 namespace lug {
@@ -14,52 +15,23 @@ namespace Logger {
  * \cond HIDDEN_SYMBOLS
  */
 namespace priv {
-class Message;
-} // priv
-/**
- * \endcond
- */
-
-class Formatter;
-
-using FlagHandlerPointer = std::string (Formatter::*)(const std::tm* now);
-
-/**
- * \cond HIDDEN_SYMBOLS
- */
-namespace priv {
-
-class Formattable {
-public:
-    virtual std::string format(Message* = nullptr) const = 0;
-};
-
-class UserChars : public Formattable {
-public:
-    void addChar(char c);
-    virtual std::string format(Message* = nullptr) const;
-
-private:
-    std::string _chars;
-};
 
-class LevelFlag : public Formattable {
-public:
-    virtual std::string format(Message* = nullptr) const;
-};
-
-class MessageFlag : public Formattable {
-public:
-    virtual std::string format(Message* = nullptr) const;
-};
+class Message;
 
+// A piece of the compiled pattern
 struct Token {
-    Token() = default;
-    Token(FlagHandlerPointer flagHandle) : basic(flagHandle) {}
-    Token(std::unique_ptr<Formattable> formattable) : advanced(std::move(formattable)) {}
-
-    FlagHandlerPointer basic{nullptr};
-    std::unique_ptr<Formattable> advanced{nullptr};
+    enum class Type : uint8_t {
+        Chars,      // `size` characters of the pattern at `start` in `Formatter::_chars`
+        Time,       // One of the date and time flags
+        Level,
+        Message
+    };
+
+    Type type{Type::Chars};
+    char flag{0};
+
+    uint32_t start{0};
+    uint32_t size{0};
 };
 
 } // priv
@@ -67,6 +39,9 @@ struct Token {
  * \endcond
  */
 
+// Compiles the pattern once, then writes the messages directly in `priv::Message::formatted`
+// The local time is computed once per second and per thread, and the names of the levels once per formatter
+// The formatter isn't modified by `format`, several threads can format with it at the same time
 class LUG_SYSTEM_API Formatter {
 public:
     Formatter(const std::string& pattern);
@@ -79,22 +54,29 @@ public:
 
     virtual ~Formatter ();
 
+    // Uses the time of the message, in local time
     virtual void format(priv::Message& msg);
+
+    // Uses `now`, not cached
     virtual void format(priv::Message& msg, const std::tm* now);
 
 private:
     void handleFlag(char c);
     void compilePattern(const std::string& pattern);
 
-    std::string handleFlagy(const std::tm* now); // Year 2 digits
-    std::string handleFlagY(const std::tm* now); // Year 4 digits
-    std::string handleFlagm(const std::tm* now); // Month from 1 to 12
-    std::string handleFlagd(const std::tm* now); // Day from 1 to 31
-    std::string handleFlagH(const std::tm* now); // Hour from 0 to 24
-    std::string handleFlagM(const std::tm* now); // Minute from 0 to 59
-    std::string handleFlagS(const std::tm* now); // Sec from 0 to 61
+    void setLevelName(uint8_t level, const char* name);
+    const std::string& getLevelName(uint8_t level) const;
+
+    void write(priv::Message& msg, const std::tm* now) const;
 
+private:
     std::vector<priv::Token> _formatChain;
+    std::string _chars;
+
+    // Indexed by the bit of the level, the last one is for unknown levels
+    std::string _levelNames[9];
+
+    bool _hasTime{false};
 };
 
 } // Logger
@@ -12,6 +12,16 @@ namespace lug {
 namespace System {
 namespace Logger {
 
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+struct BinaryMessage;
+} // priv
+/**
+ * \endcond
+ */
+
 class LUG_SYSTEM_API Handler {
 public:
     explicit Handler(const std::string& name);
@@ -31,14 +41,26 @@ public:
     virtual void flush() = 0;
     virtual void handle(const priv::Message& msg) = 0;
 
+    // The binary handlers take the arguments of the messages instead of their text, see `BinaryHandler`
+    // The loggers give them `priv::BinaryMessage` and only format the messages for the other handlers
+    bool isBinary() const;
+    virtual void handleBinary(const priv::BinaryMessage& msg);
+
     bool shouldLog(Level level) const;
     void setLevels(Level level);
     Level getLevels() const;
 
+    // Changed each time the levels of a handler are set, so the loggers know when to update theirs
+    static uint32_t getLevelsGeneration();
+
 protected:
     std::string _name;
     std::unique_ptr<Formatter> _formatter;
     Level _levels;
+    bool _binary{false};
+
+private:
+    static std::atomic<uint32_t> _levelsGeneration;
 };
 
 template<typename T, typename... Args>
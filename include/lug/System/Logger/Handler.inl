@@ -1,3 +1,11 @@
+inline bool Handler::isBinary() const {
+    return _binary;
+}
+
+inline uint32_t Handler::getLevelsGeneration() {
+    return _levelsGeneration.load(std::memory_order_relaxed);
+}
+
 template<typename T, typename... Args>
 inline T* makeHandler(const std::string& handlerName, Args&&... args) {
     std::unique_ptr<T> handler = std::make_unique<T>(handlerName, std::forward<Args>(args)...);
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
-#include <set>
 #include <string>
+#include <vector>
 
 #include <lug/System/Export.hpp>
+#include <lug/System/Logger/AsyncQueue.hpp>
+#include <lug/System/Logger/BinaryFormat.hpp>
 #include <lug/System/Logger/Common.hpp>
+#include <lug/System/Logger/Handler.hpp>
 #include <lug/System/Logger/LoggingFacility.hpp>
 #include <lug/System/Logger/Message.hpp>
 
@@ -13,23 +17,33 @@ namespace lug {
 namespace System {
 namespace Logger {
 
-class Handler;
-
 class LUG_SYSTEM_API Logger {
+    friend class AsyncQueue;
+
 public:
     explicit Logger(const std::string& loggerName);
 
     Logger(const Logger&) = delete;
-    Logger(Logger&&) = default;
+
+    // Not thread-safe, `other` keeps its name and loses its handlers
+    Logger(Logger&& other);
 
     Logger& operator=(const Logger&) = delete;
-    Logger& operator=(Logger&&) = default;
+    Logger& operator=(Logger&&) = delete;
 
     ~Logger() = default;
 
+    // Can run while other threads log, but not at the same time as another `addHandler`
     void addHandler(Handler* handler);
     void addHandler(const std::string& name);
 
+    const std::vector<Handler*>& getHandlers() const;
+
+    // The messages are formatted by the caller and given to the handlers by the background thread of `queue`
+    // `nullptr` to call the handlers directly (the default)
+    void setAsyncQueue(AsyncQueue* queue);
+    AsyncQueue* getAsyncQueue() const;
+
     void defaultErrHandler(const std::string& msg);
     void defaultErrHandler(const std::exception& ex);
 
@@ -57,15 +71,42 @@ public:
     template<typename T, typename... Args>
     void assrt(const T& fmt, Args&&... args);
 
+    // False if none of the handlers takes `level`, checked before the message is formatted
+    bool shouldLog(Level level);
+
     const std::string& getName() const;
+
+    // Only given to the text handlers, the binary handlers take the messages in `log`
     void handle(priv::Message& msg);
     void flush();
 
     static Logger& getInternalLogger();
 
+private:
+    void flushHandlers();
+    void updateLevels();
+
+    // Gives the arguments to the binary handlers, without formatting the message
+    template<typename T, typename... Args>
+    void handleBinary(Level lvl, const T& fmt, const Args&... args);
+
 protected:
     const std::string _name;
-    std::set<Handler*> _handlers;
+
+    // Flat copy of the handlers, replaced when a handler is added so the messages are dispatched without lock
+    // The previous copies are kept with the logger, another thread may still iterate over them
+    std::atomic<const std::vector<Handler*>*> _handlers{nullptr};
+    std::vector<std::unique_ptr<const std::vector<Handler*>>> _handlersCopies;
+
+    AsyncQueue* _asyncQueue{nullptr};
+
+    // Union of the levels of the handlers, up to date with `Handler::getLevelsGeneration()`
+    std::atomic<uint8_t> _levels{0};
+    std::atomic<uint32_t> _levelsGeneration{0};
+
+    // Levels taken by the binary and by the text handlers, a message is only formatted for the text ones
+    std::atomic<uint8_t> _binaryLevels{0};
+    std::atomic<uint8_t> _textLevels{0};
 };
 
 #include <lug/System/Logger/Logger.inl>
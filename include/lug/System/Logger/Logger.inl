@@ -1,6 +1,25 @@
 template<typename T>
 inline void Logger::log(Level lvl, const T& msg) {
+    if (!shouldLog(lvl)) {
+        return;
+    }
+
     try {
+        if (_binaryLevels.load(std::memory_order_relaxed) & static_cast<uint8_t>(lvl)) {
+            handleBinary(lvl, "{}", msg);
+        }
+
+        if (!(_textLevels.load(std::memory_order_relaxed) & static_cast<uint8_t>(lvl))) {
+            return;
+        }
+
+        if (_asyncQueue) {
+            fmt::MemoryWriter raw;
+            raw.write("{}", msg);
+            _asyncQueue->push(*this, lvl, raw.data(), raw.size());
+            return;
+        }
+
         priv::Message logMsg(_name, lvl);
         logMsg.raw.write("{}", msg);
         handle(logMsg);
@@ -11,7 +30,26 @@ inline void Logger::log(Level lvl, const T& msg) {
 
 template<typename... Args, typename T>
 inline void Logger::log(Level lvl, const T& fmt, Args&&... args) {
+    if (!shouldLog(lvl)) {
+        return;
+    }
+
     try {
+        if (_binaryLevels.load(std::memory_order_relaxed) & static_cast<uint8_t>(lvl)) {
+            handleBinary(lvl, fmt, args...);
+        }
+
+        if (!(_textLevels.load(std::memory_order_relaxed) & static_cast<uint8_t>(lvl))) {
+            return;
+        }
+
+        if (_asyncQueue) {
+            fmt::MemoryWriter raw;
+            raw.write(fmt, std::forward<Args>(args)...);
+            _asyncQueue->push(*this, lvl, raw.data(), raw.size());
+            return;
+        }
+
         priv::Message logMsg(_name, lvl);
         logMsg.raw.write(fmt, std::forward<Args>(args)...);
         handle(logMsg);
@@ -22,34 +60,87 @@ inline void Logger::log(Level lvl, const T& fmt, Args&&... args) {
 
 template<typename T, typename... Args>
 inline void Logger::debug(const T& fmt, Args&&... args) {
-    log(Level::Debug, fmt, std::forward<Args>(args)...);
+    if (isLevelCompiled(Level::Debug)) {
+        log(Level::Debug, fmt, std::forward<Args>(args)...);
+    }
 }
 
 template<typename T, typename... Args>
 inline void Logger::info(const T& fmt, Args&&... args) {
-    log(Level::Info, fmt, std::forward<Args>(args)...);
+    if (isLevelCompiled(Level::Info)) {
+        log(Level::Info, fmt, std::forward<Args>(args)...);
+    }
 }
 
 template<typename T, typename... Args>
 inline void Logger::warn(const T& fmt, Args&&... args) {
-    log(Level::Warning, fmt, std::forward<Args>(args)...);
+    if (isLevelCompiled(Level::Warning)) {
+        log(Level::Warning, fmt, std::forward<Args>(args)...);
+    }
 }
 
 template<typename T, typename... Args>
 inline void Logger::error(const T& fmt, Args&&... args) {
-    log(Level::Error, fmt, std::forward<Args>(args)...);
+    if (isLevelCompiled(Level::Error)) {
+        log(Level::Error, fmt, std::forward<Args>(args)...);
+    }
 }
 
 template<typename T, typename... Args>
 inline void Logger::fatal(const T& fmt, Args&&... args) {
-    log(Level::Fatal, fmt, std::forward<Args>(args)...);
+    if (isLevelCompiled(Level::Fatal)) {
+        log(Level::Fatal, fmt, std::forward<Args>(args)...);
+    }
 }
 
 template<typename T, typename... Args>
 inline void Logger::assrt(const T& fmt, Args&&... args) {
-    log(Level::Assert, fmt, std::forward<Args>(args)...);
+    if (isLevelCompiled(Level::Assert)) {
+        log(Level::Assert, fmt, std::forward<Args>(args)...);
+    }
+}
+
+template<typename T, typename... Args>
+inline void Logger::handleBinary(Level lvl, const T& fmt, const Args&... args) {
+    using Tuple = std::tuple<typename priv::BinaryArg<std::decay_t<const Args>>::Type...>;
+
+    // The arguments are kept by value or by reference until the handlers copy them
+    const Tuple binaryArgs(priv::BinaryArg<std::decay_t<const Args>>::convert(args)...);
+
+    const priv::BinaryMessage msg{
+        _name,
+        lvl,
+        std::chrono::system_clock::now(),
+        priv::getFormatString(fmt),
+        priv::getFormatSize(fmt),
+        static_cast<uint8_t>(sizeof...(Args)),
+        priv::getArgsSize(binaryArgs, std::index_sequence_for<Args...>()),
+        &priv::encodeTuple<Tuple>,
+        &binaryArgs
+    };
+
+    for (Handler* handler : getHandlers()) {
+        if (handler->isBinary() && handler->shouldLog(lvl)) {
+            handler->handleBinary(msg);
+        }
+    }
 }
 
+inline bool Logger::shouldLog(Level level) {
+    if (!isLevelCompiled(level)) {
+        return false;
+    }
+
+    if (_levelsGeneration.load(std::memory_order_relaxed) != Handler::getLevelsGeneration()) {
+        updateLevels();
+    }
+
+    return (_levels.load(std::memory_order_relaxed) & static_cast<uint8_t>(level)) != 0;
+}
+
+inline const std::vector<Handler*>& Logger::getHandlers() const {
+    return *_handlers.load(std::memory_order_acquire);
+}
 
 inline Logger* makeLogger(const std::string& loggerName) {
     std::unique_ptr<Logger> logger = std::make_unique<Logger>(loggerName);
@@ -1,8 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <memory>
-#include <unordered_map>
 #include <lug/System/Export.hpp>
 
 namespace lug {
@@ -12,6 +13,10 @@ namespace Logger {
 class Logger;
 class Handler;
 
+// Registry of the loggers and handlers by name, the lookups can run on any thread
+// The registry is copied when something is registered and the lookups read the current copy without locking
+// (the copies and the objects replaced are kept until `clear`), so the registrations should be rare
+// `clear` must not run at the same time as the other functions
 class LUG_SYSTEM_API LoggingFacility {
 public:
     LoggingFacility() = delete;
@@ -19,14 +24,59 @@ public:
 
 public:
     static void registerLogger(const std::string& loggerName, std::unique_ptr<Logger> logger);
+
+    // Returns nullptr if there is no logger named `loggerName`
     static Logger* getLogger(const std::string& loggerName);
 
     static void registerHandler(const std::string& handlerName, std::unique_ptr<Handler> handler);
+
+    // Returns nullptr if there is no handler named `handlerName`
     static Handler* getHandler(const std::string& handlerName);
 
     static void clear();
+
+    // Changed each time the registry is, see `CachedHandle`
+    static uint32_t getGeneration();
+
+private:
+    static std::atomic<uint32_t> _generation;
+};
+
+// Result of a lookup in the registry, only looked up again when the registry changes
+// so the name is not hashed on each use
+// Not thread-safe, each thread should have its own handle
+template <typename T, T* (*Lookup)(const std::string&)>
+class CachedHandle {
+public:
+    explicit CachedHandle(const std::string& name);
+
+    CachedHandle(const CachedHandle&) = default;
+    CachedHandle(CachedHandle&&) = default;
+
+    CachedHandle& operator=(const CachedHandle&) = default;
+    CachedHandle& operator=(CachedHandle&&) = default;
+
+    ~CachedHandle() = default;
+
+    // nullptr if nothing is registered under the name
+    T* get();
+    T* operator->();
+
+    const std::string& getName() const;
+
+private:
+    std::string _name;
+    T* _object{nullptr};
+
+    // 0 until the first lookup, the generation of the registry starts at 1
+    uint32_t _generation{0};
 };
 
+using LoggerHandle = CachedHandle<Logger, &LoggingFacility::getLogger>;
+using HandlerHandle = CachedHandle<Handler, &LoggingFacility::getHandler>;
+
+#include <lug/System/Logger/LoggingFacility.inl>
+
 } // Logger
 } // System
 } // lug
@@ -0,0 +1,28 @@
+inline uint32_t LoggingFacility::getGeneration() {
+    return _generation.load(std::memory_order_acquire);
+}
+
+template <typename T, T* (*Lookup)(const std::string&)>
+inline CachedHandle<T, Lookup>::CachedHandle(const std::string& name) : _name(name) {}
+
+template <typename T, T* (*Lookup)(const std::string&)>
+inline T* CachedHandle<T, Lookup>::get() {
+    const uint32_t generation = LoggingFacility::getGeneration();
+
+    if (generation != _generation) {
+        _object = Lookup(_name);
+        _generation = generation;
+    }
+
+    return _object;
+}
+
+template <typename T, T* (*Lookup)(const std::string&)>
+inline T* CachedHandle<T, Lookup>::operator->() {
+    return get();
+}
+
+template <typename T, T* (*Lookup)(const std::string&)>
+inline const std::string& CachedHandle<T, Lookup>::getName() const {
+    return _name;
+}
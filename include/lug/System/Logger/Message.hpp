@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <lug/System/Logger/Common.hpp>
 
 namespace lug {
@@ -14,7 +15,8 @@ namespace priv {
 class Message {
 public:
     Message() = default;
-    Message(const std::string& _loggerName, Level _level): loggerName(_loggerName), level(_level) {}
+    Message(const std::string& _loggerName, Level _level, std::chrono::system_clock::time_point _time = std::chrono::system_clock::now()) :
+        loggerName(_loggerName), level(_level), time(_time) {}
 
     Message(const Message&) = default;
     Message(Message&&) = default;
@@ -27,6 +29,9 @@ public:
     const std::string loggerName;
     Level level;
 
+    // When the message was logged, not when it's handled
+    std::chrono::system_clock::time_point time;
+
     fmt::MemoryWriter raw;
     fmt::MemoryWriter formatted;
 };
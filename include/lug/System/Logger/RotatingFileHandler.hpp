@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <lug/System/Export.hpp>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+// When the data written is synced to the disk (fsync), the other writes only reach the OS
+enum class SyncPolicy : uint8_t {
+    Never,
+    OnRotate,   // Before the file is rotated and when the handler is destroyed
+    Interval    // Also when the buffer is written, at most once per `syncInterval`
+};
+
+// Writes the messages in a buffer, written to the file when it's full, when `flushInterval` is elapsed
+// (checked with the time of the messages) or on `flush`
+// The file is rotated when it would exceed `maxFileSize` or when it's older than `maxFileAge`:
+// "name" is renamed "name.1", "name.1" is renamed "name.2", ... and "name.<backupCount>" is removed
+// The existing file is appended to and its age is counted from the creation of the handler
+class LUG_SYSTEM_API RotatingFileHandler : public Handler {
+public:
+    struct Options {
+        // 0 for no limit
+        size_t maxFileSize{10 * 1024 * 1024};
+        std::chrono::seconds maxFileAge{0};
+
+        // 0 to truncate the file when it's rotated
+        size_t backupCount{5};
+
+        size_t bufferSize{64 * 1024};
+        std::chrono::milliseconds flushInterval{1000};
+
+        SyncPolicy syncPolicy{SyncPolicy::OnRotate};
+        std::chrono::milliseconds syncInterval{5000};
+    };
+
+public:
+    RotatingFileHandler(const std::string& name, const std::string& filename);
+    RotatingFileHandler(const std::string& name, const std::string& filename, const Options& options);
+
+    RotatingFileHandler(const RotatingFileHandler&) = delete;
+    RotatingFileHandler(RotatingFileHandler&&) = delete;
+
+    RotatingFileHandler& operator=(const RotatingFileHandler&) = delete;
+    RotatingFileHandler& operator=(RotatingFileHandler&&) = delete;
+
+    ~RotatingFileHandler();
+
+    void handle(const priv::Message& msg) override;
+
+    // Writes the buffer, only syncs with `SyncPolicy::Interval` once `syncInterval` is elapsed
+    void flush() override;
+
+    const Options& getOptions() const;
+
+    // Size of the current file, buffer included
+    size_t getFileSize() const;
+
+    // Name of the n-th backup, the current file for 0
+    std::string getBackupName(size_t index) const;
+
+private:
+    void open(bool truncate);
+    void close();
+    void rotate(std::chrono::system_clock::time_point time);
+
+    void writeBuffer();
+    void write(const char* data, size_t size);
+    void sync();
+
+private:
+    std::string _filename;
+    Options _options;
+
+    int _file{-1};
+    size_t _fileSize{0};
+
+    std::vector<char> _buffer;
+    size_t _bufferSize{0};
+
+    std::chrono::system_clock::time_point _openTime;
+    std::chrono::system_clock::time_point _lastWrite;
+    std::chrono::steady_clock::time_point _lastSync;
+};
+
+} // Logger
+} // System
+} // lug
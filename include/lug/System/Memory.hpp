@@ -1,15 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include <new>
 #include <memory>
-#include <functional>
 
 #include <lug/System/Memory/Arena.hpp>
 #include <lug/System/Memory/Policies/Thread.hpp>
 #include <lug/System/Memory/Policies/BoundsChecker.hpp>
 #include <lug/System/Memory/Policies/MemoryMarker.hpp>
+#include <lug/System/Memory/Policies/MemoryTracker.hpp>
+#include <lug/System/Memory/StlAllocator.hpp>
 
 
 // The variadic arguments are always "arena, args..." (args only work for non array allocation and array of non pod)
@@ -24,6 +26,11 @@
 #define LUG_NEW_ARRAY_SIZE(T, size, ...) LUG_NEW_ARRAY_ALIGN_SIZE(T, alignof(typename std::remove_all_extents<T>::type), size, __VA_ARGS__)
 #define LUG_DELETE_ARRAY(object, arena) ::lug::System::Memory::delete_array(object, arena)
 
+// `count` objects allocated separately in `out` (each one can be deleted with LUG_DELETE), the arena is locked once per group of objects
+#define LUG_NEW_BATCH_ALIGN(T, alignment, count, out, ...) ::lug::System::Memory::new_batch<T>(alignment, count, out, __FILE__, __LINE__, __VA_ARGS__)
+#define LUG_NEW_BATCH(T, count, out, ...) LUG_NEW_BATCH_ALIGN(T, alignof(T), count, out, __VA_ARGS__)
+#define LUG_DELETE_BATCH(objects, count, arena) ::lug::System::Memory::delete_batch(objects, count, arena)
+
 
 namespace lug {
 namespace System {
@@ -50,53 +57,95 @@ T* new_array(size_t alignment, size_t nb, const char* file, size_t line, Arena&
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
 void delete_array(T* ptr, Arena& arena);
 
-/**
- * \cond HIDDEN_SYMBOLS
- */
-// unique_ptr
-namespace priv {
+// Returns the number of objects created, lower than `count` if the arena runs out of memory
+template <typename T, class Arena, class ...Args>
+size_t new_batch(size_t alignment, size_t count, T** out, const char* file, size_t line, Arena& arena, const Args&... args);
 
-template <typename T>
-struct make_unique_deleter {
-    using Deleter = std::function<void (T*)>;
+template <typename T, class Arena>
+void delete_batch(T* const* objects, size_t count, Arena& arena);
+
+// Deleter of the objects created by `make_unique`, only holds a pointer to the arena
+// so a `unique_ptr` is two pointers wide
+template <typename T, class Arena>
+class ArenaDeleter {
+public:
+    ArenaDeleter() = default;
+    explicit ArenaDeleter(Arena& arena);
+
+    ArenaDeleter(const ArenaDeleter&) = default;
+    ArenaDeleter(ArenaDeleter&&) = default;
+
+    ArenaDeleter& operator=(const ArenaDeleter&) = default;
+    ArenaDeleter& operator=(ArenaDeleter&&) = default;
+
+    ~ArenaDeleter() = default;
+
+    void operator()(T* ptr) const;
+
+    Arena* getArena() const;
+
+private:
+    Arena* _arena{nullptr};
 };
 
-template <typename T>
-struct make_unique_deleter<T[]> {
-    using Deleter = std::function<void (T*)>;
+template <typename T, class Arena>
+class ArenaDeleter<T[], Arena> {
+public:
+    ArenaDeleter() = default;
+    explicit ArenaDeleter(Arena& arena);
+
+    ArenaDeleter(const ArenaDeleter&) = default;
+    ArenaDeleter(ArenaDeleter&&) = default;
+
+    ArenaDeleter& operator=(const ArenaDeleter&) = default;
+    ArenaDeleter& operator=(ArenaDeleter&&) = default;
+
+    ~ArenaDeleter() = default;
+
+    void operator()(T* ptr) const;
+
+    Arena* getArena() const;
+
+private:
+    Arena* _arena{nullptr};
 };
 
-template <typename T, size_t Count>
-struct make_unique_deleter<T[Count]> {
-    using Deleter = std::function<void (T*)>;
+// Deleter for an arena with static storage duration, stateless
+// so a `static_unique_ptr` is as wide as a raw pointer
+template <typename T, class Arena, Arena& Instance>
+struct StaticArenaDeleter {
+    void operator()(T* ptr) const;
 };
 
-} // namespace priv
-/**
- * \endcond
- */
+template <typename T, class Arena, Arena& Instance>
+struct StaticArenaDeleter<T[], Arena, Instance> {
+    void operator()(T* ptr) const;
+};
 
-template<typename T, typename Deleter = typename priv::make_unique_deleter<T>::Deleter>
-using unique_ptr = std::unique_ptr<T, Deleter>;
+template <typename T, class Arena>
+using unique_ptr = std::unique_ptr<T, ArenaDeleter<T, Arena>>;
+
+template <typename T, class Arena, Arena& Instance>
+using static_unique_ptr = std::unique_ptr<T, StaticArenaDeleter<T, Arena, Instance>>;
 
 /**
  * \cond HIDDEN_SYMBOLS
  */
 namespace priv {
 
-template <typename T>
+template <typename T, class Arena>
 struct make_unique_if {
-    using SingleObject = lug::System::Memory::unique_ptr<T>;
+    using SingleObject = lug::System::Memory::unique_ptr<T, Arena>;
 };
 
-template <typename T>
-struct make_unique_if<T[]> {
-    using UnknownBound = lug::System::Memory::unique_ptr<T[]>;
+template <typename T, class Arena>
+struct make_unique_if<T[], Arena> {
+    using UnknownBound = lug::System::Memory::unique_ptr<T[], Arena>;
 };
 
-template <typename T, size_t Count>
-struct make_unique_if<T[Count]> {
-    using KnownBound = lug::System::Memory::unique_ptr<T[]>;
+template <typename T, class Arena, size_t Count>
+struct make_unique_if<T[Count], Arena> {
+    using KnownBound = lug::System::Memory::unique_ptr<T[], Arena>;
 };
 
 } // namespace priv
@@ -106,50 +155,59 @@ struct make_unique_if<T[Count]> {
 
 // Single object
 template <typename T, class Arena, typename ...Args>
-typename priv::make_unique_if<T>::SingleObject make_unique(Arena& arena, Args&&... args);
+typename priv::make_unique_if<T, Arena>::SingleObject make_unique(Arena& arena, Args&&... args);
 
 template <typename T, class Arena, typename ...Args>
-typename priv::make_unique_if<T>::SingleObject make_unique_align(Arena& arena, size_t alignment, Args&&... args);
+typename priv::make_unique_if<T, Arena>::SingleObject make_unique_align(Arena& arena, size_t alignment, Args&&... args);
 
 // Dynamic array
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::UnknownBound make_unique(Arena& arena, size_t size, Args&&... args);
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique(Arena& arena, size_t size, Args&&... args);
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size, Args&&... args);
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size, Args&&... args);
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::UnknownBound make_unique(Arena& arena, size_t size);
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique(Arena& arena, size_t size);
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size);
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size);
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::UnknownBound make_unique(Arena& arena, size_t size, Args&&... args) = delete;
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique(Arena& arena, size_t size, Args&&... args) = delete;
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size, Args&&... args) = delete;
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size, Args&&... args) = delete;
 
 // Static array
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::KnownBound make_unique(Arena& arena, Args&&... args);
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique(Arena& arena, Args&&... args);
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::KnownBound make_unique_align(Arena& arena, size_t alignment, Args&&... args);
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique_align(Arena& arena, size_t alignment, Args&&... args);
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::KnownBound make_unique(Arena& arena);
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique(Arena& arena);
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::KnownBound make_unique_align(Arena& arena, size_t alignment);
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique_align(Arena& arena, size_t alignment);
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::KnownBound make_unique(Arena& arena, Args&&... args) = delete;
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique(Arena& arena, Args&&... args) = delete;
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
-typename priv::make_unique_if<T>::KnownBound make_unique_align(Arena& arena, size_t alignment, Args&&... args) = delete;
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique_align(Arena& arena, size_t alignment, Args&&... args) = delete;
 
-// TODO: Develop shared_ptr too
+// Single object in an arena with static storage duration
+template <typename T, class Arena, Arena& Instance, typename ...Args>
+static_unique_ptr<T, Arena, Instance> make_static_unique(Args&&... args);
+
+// shared_ptr, the control block and the object are allocated together in the arena
+template <typename T>
+using shared_ptr = std::shared_ptr<T>;
+
+template <typename T, class Arena, typename ...Args>
+shared_ptr<T> make_shared(Arena& arena, Args&&... args);
 
 #include <lug/System/Memory.inl>
 
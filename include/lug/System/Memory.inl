@@ -78,99 +78,194 @@ inline void delete_array(T* ptr, Arena& arena) {
     arena.free(ptr);
 }
 
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// Number of objects handled by one call to `allocateBatch` or `freeBatch` in `new_batch` and `delete_batch`
+constexpr size_t BatchGroupSize = 256;
+
+} // namespace priv
+/**
+ * \endcond
+ */
+
+template <typename T, class Arena, class ...Args>
+inline size_t new_batch(size_t alignment, size_t count, T** out, const char* file, size_t line, Arena& arena, const Args&... args) {
+    void* ptrs[priv::BatchGroupSize];
+
+    for (size_t first = 0; first < count; first += priv::BatchGroupSize) {
+        const size_t groupCount = std::min(priv::BatchGroupSize, count - first);
+        const size_t allocated = arena.allocateBatch(groupCount, sizeof(T), alignment, 0, ptrs, file, line);
+
+        size_t i = 0;
+
+        try {
+            for (; i < allocated; ++i) {
+                out[first + i] = new (ptrs[i]) T{args...};
+            }
+        } catch (...) {
+            // Nothing is returned to the caller, destroy the objects of the group and free all the blocks
+            for (size_t j = 0; j < i; ++j) {
+                out[first + j]->~T();
+            }
+
+            arena.freeBatch(ptrs, allocated);
+            delete_batch(out, first, arena);
+            throw;
+        }
+
+        if (allocated != groupCount) {
+            return first + allocated;
+        }
+    }
+
+    return count;
+}
+
+template <typename T, class Arena>
+inline void delete_batch(T* const* objects, size_t count, Arena& arena) {
+    void* ptrs[priv::BatchGroupSize];
+
+    for (size_t first = 0; first < count; first += priv::BatchGroupSize) {
+        const size_t groupCount = std::min(priv::BatchGroupSize, count - first);
+
+        for (size_t i = 0; i < groupCount; ++i) {
+            T* const object = objects[first + i];
+
+            if (object) {
+                object->~T();
+            }
+
+            ptrs[i] = object;
+        }
+
+        arena.freeBatch(ptrs, groupCount);
+    }
+}
+
+// Deleters
+template <typename T, class Arena>
+inline ArenaDeleter<T, Arena>::ArenaDeleter(Arena& arena) : _arena{&arena} {}
+
+template <typename T, class Arena>
+inline void ArenaDeleter<T, Arena>::operator()(T* ptr) const {
+    LUG_DELETE(ptr, *_arena);
+}
+
+template <typename T, class Arena>
+inline Arena* ArenaDeleter<T, Arena>::getArena() const {
+    return _arena;
+}
+
+template <typename T, class Arena>
+inline ArenaDeleter<T[], Arena>::ArenaDeleter(Arena& arena) : _arena{&arena} {}
+
+template <typename T, class Arena>
+inline void ArenaDeleter<T[], Arena>::operator()(T* ptr) const {
+    LUG_DELETE_ARRAY(ptr, *_arena);
+}
+
+template <typename T, class Arena>
+inline Arena* ArenaDeleter<T[], Arena>::getArena() const {
+    return _arena;
+}
+
+template <typename T, class Arena, Arena& Instance>
+inline void StaticArenaDeleter<T, Arena, Instance>::operator()(T* ptr) const {
+    LUG_DELETE(ptr, Instance);
+}
+
+template <typename T, class Arena, Arena& Instance>
+inline void StaticArenaDeleter<T[], Arena, Instance>::operator()(T* ptr) const {
+    LUG_DELETE_ARRAY(ptr, Instance);
+}
 
 // make_unique of single object
 template <typename T, class Arena, typename ...Args>
-inline typename priv::make_unique_if<T>::SingleObject make_unique(Arena& arena, Args&&... args) {
+inline typename priv::make_unique_if<T, Arena>::SingleObject make_unique(Arena& arena, Args&&... args) {
     return make_unique_align<T>(arena, alignof(T), std::forward<Args>(args)...);
 }
 
 template <typename T, class Arena, typename ...Args>
-typename priv::make_unique_if<T>::SingleObject make_unique_align(Arena& arena, size_t alignment, Args&&... args) {
-    auto deleter = [&arena](T* ptr) {
-        LUG_DELETE(ptr, arena);
-    };
-
-    return typename priv::make_unique_if<T>::SingleObject(
+typename priv::make_unique_if<T, Arena>::SingleObject make_unique_align(Arena& arena, size_t alignment, Args&&... args) {
+    return typename priv::make_unique_if<T, Arena>::SingleObject(
         LUG_NEW_ALIGN(T, alignment, arena, std::forward<Args>(args)...),
-        deleter
+        ArenaDeleter<T, Arena>(arena)
     );
 }
 
 // make_unique of dynamic array (args only for non POD types)
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type>
-inline typename priv::make_unique_if<T>::UnknownBound make_unique(Arena& arena, size_t size, Args&&... args) {
+inline typename priv::make_unique_if<T, Arena>::UnknownBound make_unique(Arena& arena, size_t size, Args&&... args) {
     return make_unique_align<T>(arena, alignof(T), size, std::forward<Args>(args)...);
 }
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type>
-typename priv::make_unique_if<T>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size, Args&&... args) {
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size, Args&&... args) {
     using U = typename std::remove_all_extents<T>::type;
 
-    auto deleter = [&arena](U* ptr) {
-        LUG_DELETE_ARRAY(ptr, arena);
-    };
-
-    return typename priv::make_unique_if<T>::UnknownBound(
+    return typename priv::make_unique_if<T, Arena>::UnknownBound(
         LUG_NEW_ARRAY_ALIGN_SIZE(T, alignment, size, arena, std::forward<Args>(args)...),
-        deleter
+        ArenaDeleter<U[], Arena>(arena)
     );
 }
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
-inline typename priv::make_unique_if<T>::UnknownBound make_unique(Arena& arena, size_t size) {
+inline typename priv::make_unique_if<T, Arena>::UnknownBound make_unique(Arena& arena, size_t size) {
     return make_unique_align<T>(arena, alignof(T), size);
 }
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
-typename priv::make_unique_if<T>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size) {
+typename priv::make_unique_if<T, Arena>::UnknownBound make_unique_align(Arena& arena, size_t alignment, size_t size) {
     using U = typename std::remove_all_extents<T>::type;
 
-    auto deleter = [&arena](U* ptr) {
-        LUG_DELETE_ARRAY(ptr, arena);
-    };
-
-    return typename priv::make_unique_if<T>::UnknownBound(
+    return typename priv::make_unique_if<T, Arena>::UnknownBound(
         LUG_NEW_ARRAY_ALIGN_SIZE(T, alignment, size, arena),
-        deleter
+        ArenaDeleter<U[], Arena>(arena)
     );
 }
 
 // make_unique of static array (args only for non POD types)
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type>
-inline typename priv::make_unique_if<T>::KnownBound make_unique(Arena& arena, Args&&... args) {
+inline typename priv::make_unique_if<T, Arena>::KnownBound make_unique(Arena& arena, Args&&... args) {
     return make_unique_align<T>(arena, alignof(T), std::forward<Args>(args)...);
 }
 
 template <typename T, class Arena, typename ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type>
-typename priv::make_unique_if<T>::KnownBound make_unique_align(Arena& arena, size_t alignment, Args&&... args) {
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique_align(Arena& arena, size_t alignment, Args&&... args) {
     using U = typename std::remove_all_extents<T>::type;
 
-    auto deleter = [&arena](U* ptr) {
-        LUG_DELETE_ARRAY(ptr, arena);
-    };
-
-    return typename priv::make_unique_if<T>::KnownBound(
+    return typename priv::make_unique_if<T, Arena>::KnownBound(
         LUG_NEW_ARRAY_ALIGN(T, alignment, arena, std::forward<Args>(args)...),
-        deleter
+        ArenaDeleter<U[], Arena>(arena)
     );
 }
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
-typename priv::make_unique_if<T>::KnownBound make_unique(Arena& arena) {
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique(Arena& arena) {
     return make_unique_align<T>(arena, alignof(T));
 }
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
-typename priv::make_unique_if<T>::KnownBound make_unique_align(Arena& arena, size_t alignment) {
+typename priv::make_unique_if<T, Arena>::KnownBound make_unique_align(Arena& arena, size_t alignment) {
     using U = typename std::remove_all_extents<T>::type;
 
-    auto deleter = [&arena](U* ptr) {
-        LUG_DELETE_ARRAY(ptr, arena);
-    };
-
-    return typename priv::make_unique_if<T>::KnownBound(
+    return typename priv::make_unique_if<T, Arena>::KnownBound(
         LUG_NEW_ARRAY_ALIGN(T, alignment, arena),
-        deleter
+        ArenaDeleter<U[], Arena>(arena)
     );
 }
+
+// make_unique of single object in an arena with static storage duration
+template <typename T, class Arena, Arena& Instance, typename ...Args>
+inline static_unique_ptr<T, Arena, Instance> make_static_unique(Args&&... args) {
+    return static_unique_ptr<T, Arena, Instance>(LUG_NEW(T, Instance, std::forward<Args>(args)...));
+}
+
+// make_shared
+template <typename T, class Arena, typename ...Args>
+inline shared_ptr<T> make_shared(Arena& arena, Args&&... args) {
+    return std::allocate_shared<T>(StlAllocator<T, Arena>(arena), std::forward<Args>(args)...);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Utils.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Allocator {
+
+// Linear allocator without the size header in front of each block, the blocks are packed as tightly as their alignment allows
+// It doesn't implement `getSize`, so the arena using it can't use a bounds checking or a memory marking policy
+class LUG_SYSTEM_API Bump {
+public:
+    struct Mark {
+        char* current;
+        lug::System::Memory::Area::Page* currentPage;
+    };
+
+public:
+    Bump(lug::System::Memory::Area::IArea* area);
+    Bump(const Bump&) = delete;
+    Bump(Bump&&) = default;
+
+    Bump& operator=(const Bump&) = delete;
+    Bump& operator=(Bump&&) = default;
+
+    ~Bump() = default;
+
+    // `alignment` must be a power of two
+    void* allocate(size_t size, size_t alignment, size_t offset);
+    void free(void* ptr) const;
+    void reset();
+
+    // Dangerous operations
+    // Don't free previously allocated pointer after this mark !
+    Mark getMark() const;
+    void rewind(const Mark& mark);
+
+private:
+    void* allocateOnNextPage(size_t size, size_t alignment, size_t offset);
+
+private:
+    lug::System::Memory::Area::IArea* const _area;
+
+    char* _current{nullptr};
+    char* _end{nullptr};
+    lug::System::Memory::Area::Page* _currentPage{nullptr};
+    lug::System::Memory::Area::Page* _firstPage{nullptr};
+};
+
+#include <lug/System/Memory/Allocator/Bump.inl>
+
+} // Allocator
+} // Memory
+} // System
+} // lug
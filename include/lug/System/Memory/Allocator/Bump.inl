@@ -0,0 +1,27 @@
+inline void* Bump::allocate(size_t size, size_t alignment, size_t offset) {
+    LUG_ASSERT(size > offset, "The size must be greater than the offset");
+    LUG_ASSERT(alignment && (alignment & (alignment - 1)) == 0, "The alignment must be a power of two");
+
+    const uintptr_t ptr = ((reinterpret_cast<uintptr_t>(_current) + offset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - offset;
+
+    if (LUG_LIKELY(ptr + size <= reinterpret_cast<uintptr_t>(_end))) {
+        _current = reinterpret_cast<char*>(ptr + size);
+        return reinterpret_cast<void*>(ptr);
+    }
+
+    return allocateOnNextPage(size, alignment, offset);
+}
+
+inline void Bump::free(void*) const {
+    // Do nothing here
+}
+
+inline Bump::Mark Bump::getMark() const {
+    return {_current, _currentPage};
+}
+
+inline void Bump::rewind(const Bump::Mark& mark) {
+    _current = mark.current;
+    _currentPage = mark.currentPage;
+    _end = _currentPage ? static_cast<char*>(_currentPage->end) + 1 : nullptr;
+}
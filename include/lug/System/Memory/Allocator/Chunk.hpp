@@ -1,10 +1,10 @@
 #pragma once
 
-#include <cmath>
 #include <cstddef>
 #include <lug/System/Debug.hpp>
 #include <lug/System/Export.hpp>
 #include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Memory/AtomicFreeList.hpp>
 #include <lug/System/Memory/FreeList.hpp>
 
 namespace lug {
@@ -12,25 +12,8 @@ namespace System {
 namespace Memory {
 namespace Allocator {
 
-/**
- * \cond HIDDEN_SYMBOLS
- */
-namespace priv {
-
-// std::ceil isn't constexpr in clang and msvc
-constexpr int32_t ceil(float num)
-{
-    return (static_cast<float>(static_cast<int32_t>(num)) == num)
-        ? static_cast<int32_t>(num)
-        : static_cast<int32_t>(num) + ((num > 0) ? 1 : 0);
-}
-
-}
-/**
- * \endcond
- */
-
-template <size_t MaxSize, size_t MaxAlignment = MaxSize, size_t Offset = 0>
+// `FreeListType` can be `FreeList` or `AtomicFreeList` to share the chunk between threads without a thread policy
+template <size_t MaxSize, size_t MaxAlignment = MaxSize, size_t Offset = 0, class FreeListType = FreeList>
 class Chunk {
 public:
     Chunk(lug::System::Memory::Area::IArea* area);
@@ -46,13 +29,19 @@ public:
     void free(void* ptr);
     void reset();
 
+    // Returns the number of blocks written to `out`, lower than `count` if the area runs out of pages
+    size_t allocateBatch(size_t count, size_t size, size_t alignment, size_t offset, void** out);
+    void freeBatch(void* const* ptrs, size_t count);
+
     size_t getSize(void* ptr) const;
 
 private:
-    static constexpr size_t ChunkSize = (MaxAlignment <= 1 ? MaxSize : priv::ceil(static_cast<float>(MaxSize) / MaxAlignment) * MaxAlignment);
+    // MaxSize rounded up to the next multiple of MaxAlignment
+    static constexpr size_t ChunkSize = (MaxAlignment <= 1 ? MaxSize : (MaxSize + MaxAlignment - 1) / MaxAlignment * MaxAlignment);
 
     lug::System::Memory::Area::IArea* const _area;
-    FreeList _freeList{ChunkSize};
+    FreeListType _freeList{ChunkSize};
+    typename FreeListType::GrowPolicy _growGuard;
 
     lug::System::Memory::Area::Page* _currentPage{nullptr};
     lug::System::Memory::Area::Page* _firstPage{nullptr};
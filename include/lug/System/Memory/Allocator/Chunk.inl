@@ -1,38 +1,96 @@
-template <size_t MaxSize, size_t MaxAlignment, size_t Offset>
-Chunk<MaxSize, MaxAlignment, Offset>::Chunk(lug::System::Memory::Area::IArea* area) : _area{area}, _currentPage{_area->requestNextPage()}, _firstPage{_currentPage} {}
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::Chunk(lug::System::Memory::Area::IArea* area) : _area{area}, _currentPage{_area->requestNextPage()}, _firstPage{_currentPage} {}
 
-template <size_t MaxSize, size_t MaxAlignment, size_t Offset>
-void* Chunk<MaxSize, MaxAlignment, Offset>::allocate(size_t size, size_t alignment, size_t offset) {
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+void* Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::allocate(size_t size, size_t alignment, size_t offset) {
     LUG_ASSERT(offset == Offset, "Chunk allocator doesn't support multiple offset");
     LUG_ASSERT(MaxSize >= size, "Size of the allocation is greater than the chunk's max size");
     LUG_ASSERT(MaxAlignment >= alignment, "Alignment of the allocation is greater than the chunk's max alignment");
 
-    void* const ptr = _freeList.allocate();
+    // In release, LUG_ASSERT is discarded
+    (void)(size);
+    (void)(alignment);
+    (void)(offset);
+
+    void* ptr = _freeList.allocate();
 
     if (ptr) {
         return ptr;
     }
 
-    if (!_currentPage || !_freeList.grow(_currentPage->start, _currentPage->end, MaxAlignment, Offset)) {
-        return nullptr;
+    _growGuard.enter();
+
+    // Another thread may have grown the free list while we were waiting
+    ptr = _freeList.allocate();
+
+    if (!ptr && _currentPage && _freeList.grow(_currentPage->start, _currentPage->end, MaxAlignment, Offset)) {
+        _currentPage = _currentPage->next = (_currentPage->next ? _currentPage->next : _area->requestNextPage());
+        ptr = _freeList.allocate();
     }
 
-    _currentPage = _currentPage->next = (_currentPage->next ? _currentPage->next : _area->requestNextPage());
-    return allocate(size, alignment, offset);
+    _growGuard.leave();
+
+    return ptr;
 }
 
-template <size_t MaxSize, size_t MaxAlignment, size_t Offset>
-void Chunk<MaxSize, MaxAlignment, Offset>::free(void* ptr) {
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+void Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::free(void* ptr) {
     _freeList.free(ptr);
 }
 
-template <size_t MaxSize, size_t MaxAlignment, size_t Offset>
-void Chunk<MaxSize, MaxAlignment, Offset>::reset() {
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+size_t Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::allocateBatch(size_t count, size_t size, size_t alignment, size_t offset, void** out) {
+    LUG_ASSERT(offset == Offset, "Chunk allocator doesn't support multiple offset");
+    LUG_ASSERT(MaxSize >= size, "Size of the allocation is greater than the chunk's max size");
+    LUG_ASSERT(MaxAlignment >= alignment, "Alignment of the allocation is greater than the chunk's max alignment");
+
+    // In release, LUG_ASSERT is discarded
+    (void)(size);
+    (void)(alignment);
+    (void)(offset);
+
+    size_t allocated = _freeList.allocateBatch(count, out);
+
+    while (allocated < count) {
+        _growGuard.enter();
+
+        // Another thread may have grown the free list while we were waiting
+        allocated += _freeList.allocateBatch(count - allocated, out + allocated);
+
+        const bool grown = allocated < count && _currentPage && _freeList.grow(_currentPage->start, _currentPage->end, MaxAlignment, Offset);
+
+        if (grown) {
+            _currentPage = _currentPage->next = (_currentPage->next ? _currentPage->next : _area->requestNextPage());
+        }
+
+        _growGuard.leave();
+
+        if (!grown) {
+            break;
+        }
+    }
+
+    return allocated;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+void Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::freeBatch(void* const* ptrs, size_t count) {
+    _freeList.freeBatch(ptrs, count);
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+void Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::reset() {
+    _growGuard.enter();
+
     _freeList.reset();
     _currentPage = _firstPage;
+
+    _area->notifyReset();
+
+    _growGuard.leave();
 }
 
-template <size_t MaxSize, size_t MaxAlignment, size_t Offset>
-size_t Chunk<MaxSize, MaxAlignment, Offset>::getSize(void* ptr) const {
-    return Chunk<MaxSize, MaxAlignment>::ChunkSize;
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, class FreeListType>
+size_t Chunk<MaxSize, MaxAlignment, Offset, FreeListType>::getSize(void*) const {
+    return ChunkSize;
 }
@@ -30,6 +30,11 @@ public:
     void free(void* ptr) const;
     void reset();
 
+    // The blocks are carved one after the other at a constant stride, page by page
+    // Returns the number of blocks written to `out`, lower than `count` if the area runs out of pages
+    size_t allocateBatch(size_t count, size_t size, size_t alignment, size_t offset, void** out);
+    void freeBatch(void* const* ptrs, size_t count) const;
+
     // Dangerous operations
     // Don't free previously allocated pointer after this mark !
     Mark getMark() const;
@@ -7,8 +7,8 @@ namespace System {
 namespace Memory {
 namespace Allocator {
 
-template <typename T, size_t Alignment = alignof(T), size_t Offset = 0>
-using Pool = Chunk<sizeof(T), Alignment, Offset>;
+template <typename T, size_t Alignment = alignof(T), size_t Offset = 0, class FreeListType = FreeList>
+using Pool = Chunk<sizeof(T), Alignment, Offset, FreeListType>;
 
 } // Allocator
 } // Memory
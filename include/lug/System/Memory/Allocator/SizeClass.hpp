@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Utils.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Allocator {
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// 16, 32, 48, 64, 96, 128, 192, ...
+constexpr size_t getSizeClassSize(size_t index) {
+    return index == 0 ? 16
+        : (index % 2 == 1 ? size_t(32) << (index / 2) : size_t(48) << (index / 2 - 1));
+}
+
+inline size_t getMostSignificantBit(size_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+    return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+#else
+    size_t bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+}
+/**
+ * \endcond
+ */
+
+// General purpose allocator segregating the allocations by size
+// The small allocations (up to `MaxClassSize`) are served by one `Chunk` per size class (16, 32, 48, 64, 96, ..., 3072, 4096),
+// built on the first allocation of the class, the bigger ones take whole runs of slabs (at least one)
+// The freed runs are merged with their free neighbours and reused on a first-fit basis, split to the size needed
+// The memory of the area is cut in slabs of `SlabSize` bytes aligned on `SlabSize`, each slab starting with a small header,
+// so the size of an allocation is found by masking its address and no header is added per allocation
+// The pages of the area must be big enough to hold an aligned slab (i.e. at least `2 * SlabSize` bytes)
+// The slab headers live in the area's pages, so `reset` doesn't notify the area
+template <size_t SlabSize = 64 * 1024>
+class SizeClass {
+public:
+    static constexpr size_t ClassCount = 16;
+    static constexpr size_t MinClassSize = 16;
+    static constexpr size_t MaxClassSize = 4096;
+
+    static_assert((SlabSize & (SlabSize - 1)) == 0, "The slab size must be a power of two");
+    static_assert(SlabSize >= 4 * MaxClassSize, "The slab size must hold several blocks of the biggest class");
+    static_assert(SlabSize * MaxClassSize <= (uint64_t(1) << 32), "The slab size is too big to find the blocks with a reciprocal");
+
+public:
+    SizeClass(lug::System::Memory::Area::IArea* area);
+    SizeClass(const SizeClass&) = delete;
+    SizeClass(SizeClass&&) = delete;
+
+    SizeClass& operator=(const SizeClass&) = delete;
+    SizeClass& operator=(SizeClass&&) = delete;
+
+    ~SizeClass();
+
+    void* allocate(size_t size, size_t alignment, size_t offset);
+    void free(void* ptr);
+    void reset();
+
+    size_t getSize(void* ptr) const;
+
+    // Returns `ClassCount` if the allocation is too big or too aligned for the size classes
+    static size_t getClassIndex(size_t size, size_t alignment);
+    static size_t getClassSize(size_t index);
+
+private:
+    struct Slab {
+        // Used by the `Chunk` of the class
+        lug::System::Memory::Area::Page page;
+
+        // `ClassCount` for a run of slabs holding a big allocation
+        size_t classIndex;
+
+        // Small allocations, the blocks are `classSize` bytes apart from `firstBlock`
+        size_t classSize;
+        uint64_t reciprocal;
+        char* firstBlock;
+
+        // Number of slabs covered by this header, always 1 for the classes
+        size_t slabCount;
+
+        // Neighbours in the memory, the slabs taken from one page of the area follow each other
+        Slab* prevSlab;
+        Slab* nextSlab;
+
+        // Next page of the area, only set on the first slab of a page
+        Slab* nextRange;
+
+        // Big allocations
+        bool isFree;
+        Slab* prevFreeRun;
+        Slab* nextFreeRun;
+    };
+
+    // Hands out the slabs of one size class to its `Chunk`
+    class ClassArea : public lug::System::Memory::Area::IArea {
+    public:
+        ClassArea() = default;
+
+        lug::System::Memory::Area::Page* requestNextPage() override;
+
+        SizeClass* owner{nullptr};
+        size_t classIndex{0};
+        lug::System::Memory::Area::Page* lastPage{nullptr};
+    };
+
+    // The blocks of a class are aligned on the lowest bit set of its size
+    template <size_t Index>
+    using Pool = Chunk<priv::getSizeClassSize(Index), priv::getSizeClassSize(Index) & (~priv::getSizeClassSize(Index) + 1)>;
+
+    // Storage of a pool, built on first use so that a class takes no slab before its first allocation
+    template <size_t Index>
+    struct LazyPool {
+        Pool<Index>* pool{nullptr};
+        typename std::aligned_storage<sizeof(Pool<Index>), alignof(Pool<Index>)>::type storage;
+    };
+
+    using ClassIndices = std::make_index_sequence<ClassCount>;
+
+    using AllocateFunction = void* (*)(SizeClass&, size_t alignment);
+    using FreeFunction = void (*)(SizeClass&, void* ptr);
+
+private:
+    template <size_t Index>
+    static void* allocateFromPool(SizeClass& allocator, size_t alignment);
+
+    template <size_t Index>
+    static void freeToPool(SizeClass& allocator, void* ptr);
+
+    template <size_t Index>
+    void resetPool();
+
+    template <size_t Index>
+    void destroyPool();
+
+    template <size_t... Indices>
+    void resetPools(std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    void destroyPools(std::index_sequence<Indices...>);
+
+    void* allocateRun(size_t size, size_t alignment, size_t offset);
+    void freeRun(Slab* run);
+    void splitRun(Slab* run, size_t slabCount);
+    void mergeRuns(Slab* run, Slab* next);
+    void pushFreeRun(Slab* run);
+    void removeFreeRun(Slab* run);
+
+    // Returns the header of `count` new consecutive slabs
+    Slab* requestSlabs(size_t count);
+    Slab* createSlabs(char* memory, size_t count);
+
+    static Slab* getSlab(void* ptr);
+    static char* getBlock(const Slab* slab, void* ptr);
+
+    // The pools and their dispatch tables, indexed by the class
+    template <typename Indices>
+    struct Pools;
+
+    template <size_t... Indices>
+    struct Pools<std::index_sequence<Indices...>> {
+        using Type = std::tuple<LazyPool<Indices>...>;
+
+        static constexpr AllocateFunction allocateFunctions[] = {&SizeClass::allocateFromPool<Indices>...};
+        static constexpr FreeFunction freeFunctions[] = {&SizeClass::freeToPool<Indices>...};
+    };
+
+private:
+    lug::System::Memory::Area::IArea* const _area;
+
+    // Slabs not handed out yet in the current page of the area
+    lug::System::Memory::Area::Page* _currentPage{nullptr};
+    char* _nextSlab{nullptr};
+    char* _endSlab{nullptr};
+
+    // First slab of each page and last slab of the current one
+    Slab* _firstRange{nullptr};
+    Slab* _lastSlab{nullptr};
+
+    Slab* _freeRuns{nullptr};
+
+    ClassArea _classAreas[ClassCount];
+    typename Pools<ClassIndices>::Type _pools;
+};
+
+#include <lug/System/Memory/Allocator/SizeClass.inl>
+
+} // Allocator
+} // Memory
+} // System
+} // lug
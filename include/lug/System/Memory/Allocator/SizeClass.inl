@@ -0,0 +1,391 @@
+template <size_t SlabSize>
+constexpr size_t SizeClass<SlabSize>::ClassCount;
+
+template <size_t SlabSize>
+constexpr size_t SizeClass<SlabSize>::MinClassSize;
+
+template <size_t SlabSize>
+constexpr size_t SizeClass<SlabSize>::MaxClassSize;
+
+template <size_t SlabSize>
+template <size_t... Indices>
+constexpr typename SizeClass<SlabSize>::AllocateFunction SizeClass<SlabSize>::Pools<std::index_sequence<Indices...>>::allocateFunctions[];
+
+template <size_t SlabSize>
+template <size_t... Indices>
+constexpr typename SizeClass<SlabSize>::FreeFunction SizeClass<SlabSize>::Pools<std::index_sequence<Indices...>>::freeFunctions[];
+
+template <size_t SlabSize>
+lug::System::Memory::Area::Page* SizeClass<SlabSize>::ClassArea::requestNextPage() {
+    Slab* const slab = owner->requestSlabs(1);
+
+    if (!slab) {
+        return nullptr;
+    }
+
+    char* const memory = reinterpret_cast<char*>(slab);
+    const size_t classSize = priv::getSizeClassSize(classIndex);
+    const size_t classAlignment = classSize & (~classSize + 1);
+
+    slab->page.start = memory + sizeof(Slab);
+    slab->page.end = memory + SlabSize - 1;
+    slab->page.prev = lastPage;
+
+    // The chunk aligns its first block the same way, the slab itself is aligned on `SlabSize`
+    slab->classIndex = classIndex;
+    slab->classSize = classSize;
+    slab->reciprocal = ((uint64_t(1) << 32) + classSize - 1) / classSize;
+    slab->firstBlock = memory + (sizeof(Slab) + classAlignment - 1) / classAlignment * classAlignment;
+
+    lastPage = &slab->page;
+    return lastPage;
+}
+
+template <size_t SlabSize>
+SizeClass<SlabSize>::SizeClass(lug::System::Memory::Area::IArea* area) : _area{area} {
+    for (size_t i = 0; i < ClassCount; ++i) {
+        _classAreas[i].owner = this;
+        _classAreas[i].classIndex = i;
+    }
+}
+
+template <size_t SlabSize>
+SizeClass<SlabSize>::~SizeClass() {
+    destroyPools(ClassIndices{});
+}
+
+template <size_t SlabSize>
+inline void* SizeClass<SlabSize>::allocate(size_t size, size_t alignment, size_t offset) {
+    alignment = alignment ? alignment : 1;
+    LUG_ASSERT((alignment & (alignment - 1)) == 0, "The alignment must be a power of two");
+
+    // The blocks are aligned on `alignment`, shift the pointer so that `ptr + offset` is aligned too
+    const size_t shift = (size_t(0) - offset) & (alignment - 1);
+    const size_t index = getClassIndex(size + shift, alignment);
+
+    if (LUG_UNLIKELY(index == ClassCount)) {
+        return allocateRun(size, alignment, offset);
+    }
+
+    char* const block = static_cast<char*>(Pools<ClassIndices>::allocateFunctions[index](*this, alignment));
+    return block ? block + shift : nullptr;
+}
+
+template <size_t SlabSize>
+inline void SizeClass<SlabSize>::free(void* ptr) {
+    Slab* const slab = getSlab(ptr);
+
+    if (LUG_UNLIKELY(slab->classIndex == ClassCount)) {
+        freeRun(slab);
+        return;
+    }
+
+    Pools<ClassIndices>::freeFunctions[slab->classIndex](*this, getBlock(slab, ptr));
+}
+
+template <size_t SlabSize>
+void SizeClass<SlabSize>::reset() {
+    resetPools(ClassIndices{});
+
+    // Every run is free again, merged with its neighbours
+    _freeRuns = nullptr;
+
+    for (Slab* range = _firstRange; range; range = range->nextRange) {
+        for (Slab* slab = range; slab; slab = slab->nextSlab) {
+            slab->isFree = false;
+        }
+
+        for (Slab* slab = range; slab;) {
+            Slab* const next = slab->nextSlab;
+
+            if (slab->classIndex == ClassCount) {
+                freeRun(slab);
+            }
+
+            slab = next;
+        }
+    }
+}
+
+template <size_t SlabSize>
+inline size_t SizeClass<SlabSize>::getSize(void* ptr) const {
+    const Slab* const slab = getSlab(ptr);
+
+    if (LUG_UNLIKELY(slab->classIndex == ClassCount)) {
+        return reinterpret_cast<const char*>(slab) + slab->slabCount * SlabSize - static_cast<char*>(ptr);
+    }
+
+    return getBlock(slab, ptr) + slab->classSize - static_cast<char*>(ptr);
+}
+
+template <size_t SlabSize>
+inline size_t SizeClass<SlabSize>::getClassIndex(size_t size, size_t alignment) {
+    if (size > MaxClassSize || alignment > MaxClassSize) {
+        return ClassCount;
+    }
+
+    size_t index = 0;
+
+    if (size > 2 * MinClassSize) {
+        // Between 2^bit and 2^(bit + 1), the classes are 1.5 * 2^bit and 2^(bit + 1)
+        const size_t bit = priv::getMostSignificantBit(size - 1);
+        index = 2 * bit - 7 - (size <= (size_t(3) << (bit - 1)) ? 1 : 0);
+    } else if (size > MinClassSize) {
+        index = 1;
+    }
+
+    while (index < ClassCount && (getClassSize(index) & (~getClassSize(index) + 1)) < alignment) {
+        ++index;
+    }
+
+    return index;
+}
+
+template <size_t SlabSize>
+inline size_t SizeClass<SlabSize>::getClassSize(size_t index) {
+    return priv::getSizeClassSize(index);
+}
+
+template <size_t SlabSize>
+template <size_t Index>
+void* SizeClass<SlabSize>::allocateFromPool(SizeClass& allocator, size_t alignment) {
+    LazyPool<Index>& lazyPool = std::get<Index>(allocator._pools);
+
+    if (LUG_UNLIKELY(!lazyPool.pool)) {
+        lazyPool.pool = new (&lazyPool.storage) Pool<Index>(&allocator._classAreas[Index]);
+    }
+
+    return lazyPool.pool->allocate(priv::getSizeClassSize(Index), alignment, 0);
+}
+
+template <size_t SlabSize>
+template <size_t Index>
+void SizeClass<SlabSize>::freeToPool(SizeClass& allocator, void* ptr) {
+    // The block comes from the pool, so it exists
+    std::get<Index>(allocator._pools).pool->free(ptr);
+}
+
+template <size_t SlabSize>
+template <size_t Index>
+void SizeClass<SlabSize>::resetPool() {
+    if (std::get<Index>(_pools).pool) {
+        std::get<Index>(_pools).pool->reset();
+    }
+}
+
+template <size_t SlabSize>
+template <size_t Index>
+void SizeClass<SlabSize>::destroyPool() {
+    if (std::get<Index>(_pools).pool) {
+        std::get<Index>(_pools).pool->~Pool<Index>();
+        std::get<Index>(_pools).pool = nullptr;
+    }
+}
+
+template <size_t SlabSize>
+template <size_t... Indices>
+void SizeClass<SlabSize>::resetPools(std::index_sequence<Indices...>) {
+    (void)std::initializer_list<int>{(resetPool<Indices>(), 0)...};
+}
+
+template <size_t SlabSize>
+template <size_t... Indices>
+void SizeClass<SlabSize>::destroyPools(std::index_sequence<Indices...>) {
+    (void)std::initializer_list<int>{(destroyPool<Indices>(), 0)...};
+}
+
+template <size_t SlabSize>
+void* SizeClass<SlabSize>::allocateRun(size_t size, size_t alignment, size_t offset) {
+    // The pointer must stay in the first slab of the run to find its header
+    if (alignment > SlabSize / 2) {
+        LUG_ASSERT(false, "Alignment of the allocation is too big for the slabs");
+        return nullptr;
+    }
+
+    const size_t slabCount = (sizeof(Slab) + alignment - 1 + size + SlabSize - 1) / SlabSize;
+    Slab* run = _freeRuns;
+
+    // First fit in the freed runs, the rest of the run stays free
+    while (run && run->slabCount < slabCount) {
+        run = run->nextFreeRun;
+    }
+
+    if (run) {
+        removeFreeRun(run);
+
+        if (run->slabCount > slabCount) {
+            splitRun(run, slabCount);
+        }
+    } else {
+        run = requestSlabs(slabCount);
+
+        if (!run) {
+            return nullptr;
+        }
+
+        run->classIndex = ClassCount;
+    }
+
+    const uintptr_t data = reinterpret_cast<uintptr_t>(run) + sizeof(Slab) + offset;
+    return reinterpret_cast<char*>(((data + alignment - 1) & ~(alignment - 1)) - offset);
+}
+
+template <size_t SlabSize>
+void SizeClass<SlabSize>::freeRun(Slab* run) {
+    Slab* const next = run->nextSlab;
+
+    if (next && next->isFree) {
+        removeFreeRun(next);
+        mergeRuns(run, next);
+    }
+
+    // The previous run is already in the free list
+    Slab* const prev = run->prevSlab;
+
+    if (prev && prev->isFree) {
+        mergeRuns(prev, run);
+        return;
+    }
+
+    pushFreeRun(run);
+}
+
+template <size_t SlabSize>
+void SizeClass<SlabSize>::splitRun(Slab* run, size_t slabCount) {
+    Slab* const rest = new (reinterpret_cast<char*>(run) + slabCount * SlabSize) Slab();
+
+    rest->classIndex = ClassCount;
+    rest->slabCount = run->slabCount - slabCount;
+    rest->prevSlab = run;
+    rest->nextSlab = run->nextSlab;
+
+    if (rest->nextSlab) {
+        rest->nextSlab->prevSlab = rest;
+    }
+
+    run->slabCount = slabCount;
+    run->nextSlab = rest;
+
+    if (_lastSlab == run) {
+        _lastSlab = rest;
+    }
+
+    // The free runs are always merged, the next one can't be free
+    pushFreeRun(rest);
+}
+
+template <size_t SlabSize>
+void SizeClass<SlabSize>::mergeRuns(Slab* run, Slab* next) {
+    run->slabCount += next->slabCount;
+    run->nextSlab = next->nextSlab;
+
+    if (run->nextSlab) {
+        run->nextSlab->prevSlab = run;
+    }
+
+    if (_lastSlab == next) {
+        _lastSlab = run;
+    }
+}
+
+template <size_t SlabSize>
+void SizeClass<SlabSize>::pushFreeRun(Slab* run) {
+    run->isFree = true;
+    run->prevFreeRun = nullptr;
+    run->nextFreeRun = _freeRuns;
+
+    if (_freeRuns) {
+        _freeRuns->prevFreeRun = run;
+    }
+
+    _freeRuns = run;
+}
+
+template <size_t SlabSize>
+void SizeClass<SlabSize>::removeFreeRun(Slab* run) {
+    run->isFree = false;
+
+    if (run->prevFreeRun) {
+        run->prevFreeRun->nextFreeRun = run->nextFreeRun;
+    } else {
+        _freeRuns = run->nextFreeRun;
+    }
+
+    if (run->nextFreeRun) {
+        run->nextFreeRun->prevFreeRun = run->prevFreeRun;
+    }
+}
+
+template <size_t SlabSize>
+typename SizeClass<SlabSize>::Slab* SizeClass<SlabSize>::requestSlabs(size_t count) {
+    const size_t size = count * SlabSize;
+
+    if (static_cast<size_t>(_endSlab - _nextSlab) < size) {
+        lug::System::Memory::Area::Page* const page = _area->requestNextPage();
+
+        if (!page) {
+            return nullptr;
+        }
+
+        // The rest of the current page is kept as a free run
+        const size_t restCount = static_cast<size_t>(_endSlab - _nextSlab) / SlabSize;
+
+        if (restCount) {
+            Slab* const rest = createSlabs(_nextSlab, restCount);
+            rest->classIndex = ClassCount;
+
+            freeRun(rest);
+        }
+
+        if (_currentPage) {
+            _currentPage->next = page;
+        }
+        _currentPage = page;
+
+        const uintptr_t start = (reinterpret_cast<uintptr_t>(page->start) + SlabSize - 1) & ~(uintptr_t(SlabSize) - 1);
+        const uintptr_t end = reinterpret_cast<uintptr_t>(page->end) + 1;
+
+        _nextSlab = reinterpret_cast<char*>(start < end ? start : end);
+        _endSlab = reinterpret_cast<char*>(end);
+        _lastSlab = nullptr;
+
+        if (static_cast<size_t>(_endSlab - _nextSlab) < size) {
+            return nullptr;
+        }
+    }
+
+    Slab* const slab = createSlabs(_nextSlab, count);
+    _nextSlab += size;
+
+    return slab;
+}
+
+template <size_t SlabSize>
+typename SizeClass<SlabSize>::Slab* SizeClass<SlabSize>::createSlabs(char* memory, size_t count) {
+    Slab* const slab = new (memory) Slab();
+
+    slab->slabCount = count;
+    slab->prevSlab = _lastSlab;
+
+    if (_lastSlab) {
+        _lastSlab->nextSlab = slab;
+    } else {
+        slab->nextRange = _firstRange;
+        _firstRange = slab;
+    }
+
+    _lastSlab = slab;
+    return slab;
+}
+
+template <size_t SlabSize>
+inline typename SizeClass<SlabSize>::Slab* SizeClass<SlabSize>::getSlab(void* ptr) {
+    return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t(SlabSize) - 1));
+}
+
+template <size_t SlabSize>
+inline char* SizeClass<SlabSize>::getBlock(const Slab* slab, void* ptr) {
+    // Exact division by `classSize` as the distance is lower than `SlabSize`
+    const uint64_t distance = static_cast<char*>(ptr) - slab->firstBlock;
+    return slab->firstBlock + ((distance * slab->reciprocal) >> 32) * slab->classSize;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <lug/System/Export.hpp>
+#include <lug/System/Utils.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Allocator {
+
+// Thread-local caching front-end for a fixed-size allocator (i.e. `Chunk` or `Pool`)
+// Each thread owns a magazine of free blocks from which `allocate` and `free` are served without locking,
+// the underlying allocator is only accessed under `SynchronizationPrimitive` to refill or flush
+// the magazine by batches of `MagazineSize / 2` blocks
+// As this allocator is thread-safe by itself, the arena using it should use the `SingleThreadPolicy`
+template <class Allocator, class SynchronizationPrimitive = std::mutex, size_t MagazineSize = 64>
+class ThreadCache {
+    static_assert(MagazineSize >= 2, "The magazine must be able to hold at least two blocks");
+
+public:
+    ThreadCache(lug::System::Memory::Area::IArea* area);
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache(ThreadCache&&) = delete;
+
+    ThreadCache& operator=(const ThreadCache&) = delete;
+    ThreadCache& operator=(ThreadCache&&) = delete;
+
+    ~ThreadCache();
+
+    void* allocate(size_t size, size_t alignment, size_t offset);
+    void free(void* ptr);
+    void reset();
+
+    // The underlying allocator must return the same size for every block (true for `Chunk`)
+    size_t getSize(void* ptr) const;
+
+private:
+    class Shared {
+    public:
+        explicit Shared(lug::System::Memory::Area::IArea* area);
+
+        SynchronizationPrimitive primitive;
+        Allocator allocator;
+
+        std::atomic<bool> alive{true};
+        std::atomic<size_t> generation{0};
+    };
+
+    struct Magazine {
+        size_t id;
+        std::shared_ptr<Shared> shared;
+
+        size_t generation;
+        size_t count;
+        void* blocks[MagazineSize];
+    };
+
+    // Owned by a thread, give back the cached blocks to the live caches when the thread exits
+    class LocalMagazines {
+    public:
+        LocalMagazines() = default;
+        LocalMagazines(const LocalMagazines&) = delete;
+        LocalMagazines(LocalMagazines&&) = delete;
+
+        LocalMagazines& operator=(const LocalMagazines&) = delete;
+        LocalMagazines& operator=(LocalMagazines&&) = delete;
+
+        ~LocalMagazines();
+
+        Magazine& get(size_t id, const std::shared_ptr<Shared>& shared);
+
+    private:
+        std::vector<std::unique_ptr<Magazine>> _magazines;
+        Magazine* _last{nullptr};
+    };
+
+private:
+    Magazine& localMagazine();
+
+    static void refill(Magazine& magazine, size_t size, size_t alignment, size_t offset);
+    static void flush(Magazine& magazine, size_t count);
+
+private:
+    static std::atomic<size_t> _nextId;
+
+    const size_t _id;
+    std::shared_ptr<Shared> _shared;
+};
+
+#include <lug/System/Memory/Allocator/ThreadCache.inl>
+
+} // Allocator
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,141 @@
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+std::atomic<size_t> ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::_nextId{0};
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::Shared::Shared(lug::System::Memory::Area::IArea* area) : allocator{area} {}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::LocalMagazines::~LocalMagazines() {
+    for (auto& magazine : _magazines) {
+        std::lock_guard<SynchronizationPrimitive> lock(magazine->shared->primitive);
+
+        if (magazine->shared->alive.load() && magazine->generation == magazine->shared->generation.load()) {
+            for (size_t i = 0; i < magazine->count; ++i) {
+                magazine->shared->allocator.free(magazine->blocks[i]);
+            }
+        }
+    }
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+inline typename ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::Magazine&
+ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::LocalMagazines::get(size_t id, const std::shared_ptr<Shared>& shared) {
+    if (LUG_LIKELY(_last && _last->id == id)) {
+        return *_last;
+    }
+
+    for (auto it = _magazines.begin(); it != _magazines.end();) {
+        // The cache owning this magazine is dead, its memory is not ours to give back
+        if (!(*it)->shared->alive.load()) {
+            it = _magazines.erase(it);
+            continue;
+        }
+
+        if ((*it)->id == id) {
+            _last = it->get();
+            return *_last;
+        }
+
+        ++it;
+    }
+
+    _magazines.push_back(std::make_unique<Magazine>());
+
+    _last = _magazines.back().get();
+    _last->id = id;
+    _last->shared = shared;
+    _last->generation = shared->generation.load();
+    _last->count = 0;
+
+    return *_last;
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::ThreadCache(lug::System::Memory::Area::IArea* area) :
+    _id{_nextId.fetch_add(1)}, _shared{std::make_shared<Shared>(area)} {}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::~ThreadCache() {
+    std::lock_guard<SynchronizationPrimitive> lock(_shared->primitive);
+    _shared->alive.store(false);
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+inline void* ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::allocate(size_t size, size_t alignment, size_t offset) {
+    Magazine& magazine = localMagazine();
+
+    if (LUG_UNLIKELY(magazine.count == 0)) {
+        refill(magazine, size, alignment, offset);
+
+        if (magazine.count == 0) {
+            return nullptr;
+        }
+    }
+
+    return magazine.blocks[--magazine.count];
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+inline void ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::free(void* ptr) {
+    Magazine& magazine = localMagazine();
+
+    if (LUG_UNLIKELY(magazine.count == MagazineSize)) {
+        flush(magazine, MagazineSize / 2);
+    }
+
+    magazine.blocks[magazine.count++] = ptr;
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+void ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::reset() {
+    std::lock_guard<SynchronizationPrimitive> lock(_shared->primitive);
+
+    // The magazines of every thread are invalidated lazily on their next access
+    _shared->allocator.reset();
+    _shared->generation.fetch_add(1);
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+inline size_t ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::getSize(void* ptr) const {
+    return _shared->allocator.getSize(ptr);
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+inline typename ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::Magazine&
+ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::localMagazine() {
+    static thread_local LocalMagazines magazines;
+
+    Magazine& magazine = magazines.get(_id, _shared);
+
+    const size_t generation = _shared->generation.load(std::memory_order_relaxed);
+    if (LUG_UNLIKELY(magazine.generation != generation)) {
+        magazine.generation = generation;
+        magazine.count = 0;
+    }
+
+    return magazine;
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+void ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::refill(Magazine& magazine, size_t size, size_t alignment, size_t offset) {
+    std::lock_guard<SynchronizationPrimitive> lock(magazine.shared->primitive);
+
+    while (magazine.count < MagazineSize / 2) {
+        void* const ptr = magazine.shared->allocator.allocate(size, alignment, offset);
+
+        if (!ptr) {
+            break;
+        }
+
+        magazine.blocks[magazine.count++] = ptr;
+    }
+}
+
+template <class Allocator, class SynchronizationPrimitive, size_t MagazineSize>
+void ThreadCache<Allocator, SynchronizationPrimitive, MagazineSize>::flush(Magazine& magazine, size_t count) {
+    std::lock_guard<SynchronizationPrimitive> lock(magazine.shared->primitive);
+
+    for (; count > 0; --count) {
+        magazine.shared->allocator.free(magazine.blocks[--magazine.count]);
+    }
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdlib>
+#include <cstring>
 #include <lug/System/Export.hpp>
 #include <lug/System/Memory/Area/IArea.hpp>
 
@@ -25,7 +25,7 @@ inline Page* lug::System::Memory::Area::GrowingHeap<PageSize, MaxPageCount>::req
 
     _pages[_current] = {
         _data[_current],
-        static_cast<char*>(_data[_current]) + PageSize,
+        static_cast<char*>(_data[_current]) + PageSize - 1,
         _current == 0 ? nullptr : &_pages[_current - 1],
         nullptr
     };
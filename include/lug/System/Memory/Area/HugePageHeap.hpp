@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Memory/Area/VirtualMemory.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+
+// Same as `Heap` for large arenas: the memory is mapped at once, backed with huge pages to reduce the TLB misses
+// and placed on a NUMA node, falling back on regular pages and any node when they are not available
+template <
+    size_t PageSize = 2 * 1024 * 1024,
+    size_t PageCount = 1,
+    VirtualMemory::HugePages HugePageType = VirtualMemory::HugePages::Transparent,
+    int NumaNode = VirtualMemory::AnyNumaNode
+>
+class HugePageHeap : public IArea {
+public:
+    HugePageHeap();
+    HugePageHeap(const HugePageHeap&) = delete;
+    HugePageHeap(HugePageHeap&&) = delete;
+
+    HugePageHeap& operator=(const HugePageHeap&) = delete;
+    HugePageHeap& operator=(HugePageHeap&&) = delete;
+
+    ~HugePageHeap();
+
+    Page* requestNextPage() override;
+
+    // What the memory is actually backed with
+    VirtualMemory::HugePages getHugePages() const;
+
+private:
+    void* _data{nullptr};
+    VirtualMemory::HugePages _hugePages{VirtualMemory::HugePages::None};
+
+    size_t _current{0};
+    Page _pages[PageCount];
+};
+
+#include <lug/System/Memory/Area/HugePageHeap.inl>
+
+} // Area
+} // Memory
+} // System
+} // lug
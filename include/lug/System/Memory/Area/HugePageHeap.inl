@@ -0,0 +1,41 @@
+template <size_t PageSize, size_t PageCount, VirtualMemory::HugePages HugePageType, int NumaNode>
+lug::System::Memory::Area::HugePageHeap<PageSize, PageCount, HugePageType, NumaNode>::HugePageHeap() {
+    _data = VirtualMemory::map(PageSize * PageCount, HugePageType, NumaNode, &_hugePages);
+
+    if (!_data) {
+        // No page will be returned
+        _current = PageCount;
+        return;
+    }
+
+    char* const tmpPtr = static_cast<char*>(_data);
+    for (size_t i = 0; i < PageCount; ++i) {
+        _pages[i] = {
+            tmpPtr + PageSize * i,
+            tmpPtr + PageSize * (i + 1) - 1,
+            i == 0 ? nullptr : &_pages[i - 1],
+            nullptr
+        };
+    }
+}
+
+template <size_t PageSize, size_t PageCount, VirtualMemory::HugePages HugePageType, int NumaNode>
+lug::System::Memory::Area::HugePageHeap<PageSize, PageCount, HugePageType, NumaNode>::~HugePageHeap() {
+    VirtualMemory::release(_data, PageSize * PageCount);
+    _data = nullptr;
+}
+
+template <size_t PageSize, size_t PageCount, VirtualMemory::HugePages HugePageType, int NumaNode>
+inline Page* lug::System::Memory::Area::HugePageHeap<PageSize, PageCount, HugePageType, NumaNode>::requestNextPage() {
+    if (_current >= PageCount) {
+        return nullptr;
+    }
+
+    _current += 1;
+    return &_pages[_current - 1];
+}
+
+template <size_t PageSize, size_t PageCount, VirtualMemory::HugePages HugePageType, int NumaNode>
+inline VirtualMemory::HugePages lug::System::Memory::Area::HugePageHeap<PageSize, PageCount, HugePageType, NumaNode>::getHugePages() const {
+    return _hugePages;
+}
@@ -29,6 +29,10 @@ public:
     virtual ~IArea() = default;
 
     virtual Page* requestNextPage() = 0;
+
+    // Called by the allocators when they are reset, none of the pages is in use anymore
+    // The pages already returned must stay valid, the area can only drop their content
+    virtual void notifyReset() {}
 };
 
 } // Area
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+
+// Area of one page that can be saved to a file and mapped back later, so an arena built once
+// (e.g. the assets of a scene with `Allocator::Linear`) is restored without rebuilding it
+// The snapshot is mapped at any address: the pointers between the objects of the area must be `offset_ptr`
+// and the objects must be trivially relocatable (no virtual functions, no pointers outside of the area)
+class LUG_SYSTEM_API MappedHeap : public IArea {
+public:
+    // Space taken by the header of the snapshot at the beginning of the area
+    static constexpr size_t HeaderSize = 64;
+
+public:
+    explicit MappedHeap(size_t capacity);
+
+    MappedHeap(const MappedHeap&) = delete;
+    MappedHeap(MappedHeap&&) = delete;
+
+    MappedHeap& operator=(const MappedHeap&) = delete;
+    MappedHeap& operator=(MappedHeap&&) = delete;
+
+    ~MappedHeap();
+
+    // The page starts after the loaded snapshot, if any, so a reset of the allocator keeps it
+    Page* requestNextPage() override;
+
+    // Writes the area up to `end` (excluded) to `filename`, `end` is usually the mark of the allocator
+    bool save(const std::string& filename, const void* end);
+
+    // Replaces the content of the area with the snapshot in `filename`, mapped copy-on-write
+    // The capacity becomes the one of the area that saved it (or the size of the snapshot, if bigger)
+    // Must be called before the allocator using the area is created
+    bool load(const std::string& filename);
+
+    // Entry point of the snapshot, found back with `getRoot` after `load`
+    void setRoot(const void* ptr);
+
+    template <typename T>
+    T* getRoot() const;
+
+    bool contains(const void* ptr) const;
+
+    size_t getCapacity() const;
+
+    // Size of the loaded snapshot, header included, 0 if nothing was loaded
+    size_t getSnapshotSize() const;
+
+private:
+    struct Header;
+
+    Header* getHeader() const;
+    void* getRootPtr() const;
+
+    void setData(char* data, size_t capacity, size_t snapshotSize);
+
+private:
+    char* _data{nullptr};
+    size_t _capacity{0};
+    size_t _snapshotSize{0};
+
+    bool _pageRequested{false};
+    Page _page;
+};
+
+#include <lug/System/Memory/Area/MappedHeap.inl>
+
+} // Area
+} // Memory
+} // System
+} // lug
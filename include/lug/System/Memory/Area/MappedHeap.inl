@@ -0,0 +1,16 @@
+template <typename T>
+inline T* MappedHeap::getRoot() const {
+    return static_cast<T*>(getRootPtr());
+}
+
+inline bool MappedHeap::contains(const void* ptr) const {
+    return ptr >= _data && ptr < _data + _capacity;
+}
+
+inline size_t MappedHeap::getCapacity() const {
+    return _capacity;
+}
+
+inline size_t MappedHeap::getSnapshotSize() const {
+    return _snapshotSize;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Memory/Area/VirtualMemory.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+
+// Reserves a large range of address space up front and commits the pages one by one when they are requested,
+// so the allocators can grow without a fixed page count and the pages never move
+// `PageSize` must be a multiple of `VirtualMemory::getPageSize()`
+template <size_t PageSize = 64 * 1024>
+class VirtualHeap : public IArea {
+public:
+    static constexpr size_t DefaultReservedSize = sizeof(void*) == 8 ? (size_t(64) << 30) : (size_t(256) << 20);
+
+public:
+    // If `decommitOnReset` is true, the memory of every page but the first is given back to the system
+    // each time the allocator is reset
+    explicit VirtualHeap(size_t reservedSize = DefaultReservedSize, bool decommitOnReset = false);
+
+    VirtualHeap(const VirtualHeap&) = delete;
+    VirtualHeap(VirtualHeap&&) = delete;
+
+    VirtualHeap& operator=(const VirtualHeap&) = delete;
+    VirtualHeap& operator=(VirtualHeap&&) = delete;
+
+    ~VirtualHeap();
+
+    Page* requestNextPage() override;
+    void notifyReset() override;
+
+    // Gives the memory of the pages after the first `keepPageCount` back to the system
+    // The pages stay valid and are backed again when touched
+    void decommit(size_t keepPageCount = 0);
+
+    size_t getPageCount() const;
+    size_t getReservedSize() const;
+
+private:
+    void* _data{nullptr};
+
+    size_t _reservedSize;
+    bool _decommitOnReset;
+
+    // Page addresses are stable across push_back
+    std::deque<Page> _pages;
+};
+
+#include <lug/System/Memory/Area/VirtualHeap.inl>
+
+} // Area
+} // Memory
+} // System
+} // lug
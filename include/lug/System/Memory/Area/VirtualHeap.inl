@@ -0,0 +1,71 @@
+template <size_t PageSize>
+lug::System::Memory::Area::VirtualHeap<PageSize>::VirtualHeap(size_t reservedSize, bool decommitOnReset) :
+    _reservedSize{reservedSize - reservedSize % PageSize}, _decommitOnReset{decommitOnReset} {
+    LUG_ASSERT(PageSize % VirtualMemory::getPageSize() == 0, "The page size must be a multiple of the system page size");
+
+    _data = VirtualMemory::reserve(_reservedSize);
+
+    if (!_data) {
+        _reservedSize = 0;
+    }
+}
+
+template <size_t PageSize>
+lug::System::Memory::Area::VirtualHeap<PageSize>::~VirtualHeap() {
+    VirtualMemory::release(_data, _reservedSize);
+    _data = nullptr;
+}
+
+template <size_t PageSize>
+inline Page* lug::System::Memory::Area::VirtualHeap<PageSize>::requestNextPage() {
+    const size_t current = _pages.size();
+
+    if ((current + 1) * PageSize > _reservedSize) {
+        return nullptr;
+    }
+
+    char* const start = static_cast<char*>(_data) + current * PageSize;
+
+    if (!VirtualMemory::commit(start, PageSize)) {
+        return nullptr;
+    }
+
+    _pages.push_back({
+        start,
+        start + PageSize - 1,
+        current == 0 ? nullptr : &_pages[current - 1],
+        nullptr
+    });
+
+    return &_pages.back();
+}
+
+template <size_t PageSize>
+inline void lug::System::Memory::Area::VirtualHeap<PageSize>::notifyReset() {
+    if (_decommitOnReset) {
+        // The first page is reused right away, keep it
+        decommit(1);
+    }
+}
+
+template <size_t PageSize>
+inline void lug::System::Memory::Area::VirtualHeap<PageSize>::decommit(size_t keepPageCount) {
+    if (keepPageCount >= _pages.size()) {
+        return;
+    }
+
+    VirtualMemory::decommit(
+        static_cast<char*>(_data) + keepPageCount * PageSize,
+        (_pages.size() - keepPageCount) * PageSize
+    );
+}
+
+template <size_t PageSize>
+inline size_t lug::System::Memory::Area::VirtualHeap<PageSize>::getPageCount() const {
+    return _pages.size();
+}
+
+template <size_t PageSize>
+inline size_t lug::System::Memory::Area::VirtualHeap<PageSize>::getReservedSize() const {
+    return _reservedSize;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <lug/System/Export.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+namespace VirtualMemory {
+
+enum class HugePages : uint8_t {
+    None,           // Regular pages of `getPageSize()` bytes
+    Transparent,    // Regular mapping the kernel is asked to back with huge pages (madvise(MADV_HUGEPAGE))
+    Explicit        // Huge pages from the reserved pool (MAP_HUGETLB, or MEM_LARGE_PAGES on Windows)
+};
+
+constexpr int AnyNumaNode = -1;
+
+// Granularity of `commit` and `decommit`
+LUG_SYSTEM_API size_t getPageSize();
+
+// Reserves `size` bytes of address space, not accessible and not backed by memory
+LUG_SYSTEM_API void* reserve(size_t size);
+LUG_SYSTEM_API void release(void* ptr, size_t size);
+
+// Makes a reserved range readable and writable, the memory is backed on first touch
+LUG_SYSTEM_API bool commit(void* ptr, size_t size);
+
+// Gives the memory of a committed range back to the system
+// The range stays accessible, its content is lost
+LUG_SYSTEM_API void decommit(void* ptr, size_t size);
+
+// Maps `size` bytes of committed memory, backed with huge pages and placed on `numaNode` when possible
+// Falls back on the next best option when it's not (`Explicit` -> `Transparent` -> `None`, and any node)
+// `obtained` receives what was actually used, the memory is freed with `release`
+LUG_SYSTEM_API void* map(size_t size, HugePages hugePages, int numaNode, HugePages* obtained = nullptr);
+
+// Size of the huge pages of `map` (the default size of the kernel on Linux), or 0 if they are not supported
+// `map` falls back on normal pages when it is 0
+LUG_SYSTEM_API size_t getHugePageSize();
+
+} // VirtualMemory
+} // Area
+} // Memory
+} // System
+} // lug
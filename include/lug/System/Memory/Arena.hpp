@@ -1,18 +1,50 @@
 #pragma once
 
 #include <cstdlib>
+#include <type_traits>
+#include <utility>
 #include <lug/System/Export.hpp>
 #include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Memory/Policies/BoundsChecker.hpp>
+#include <lug/System/Memory/Policies/MemoryMarker.hpp>
+#include <lug/System/Memory/Policies/MemoryTracker.hpp>
 
 namespace lug {
 namespace System {
 namespace Memory {
 
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+template <class Allocator, typename = void>
+struct HasBatch : std::false_type {};
+
+template <class Allocator>
+struct HasBatch<Allocator, decltype(void(std::declval<Allocator&>().allocateBatch(size_t(), size_t(), size_t(), size_t(), static_cast<void**>(nullptr))))> : std::true_type {};
+
+// The policies that never use the size of the allocations
+template <class Policy>
+struct IsNoOpPolicy : std::false_type {};
+
+template <>
+struct IsNoOpPolicy<Policies::NoBoundsChecking> : std::true_type {};
+
+template <>
+struct IsNoOpPolicy<Policies::NoMemoryMarking> : std::true_type {};
+
+}
+/**
+ * \endcond
+ */
+
 template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy = Policies::NoMemoryTracking
 >
 class Arena {
 public:
@@ -31,14 +63,39 @@ public:
     void free(void* ptr);
     void reset();
 
+    // Allocates `count` blocks of the same size in `out` and frees several blocks at once, under a single lock
+    // The allocators providing `allocateBatch` and `freeBatch` are called once, the other ones once per block
+    // Returns the number of blocks allocated, lower than `count` if the allocator runs out of memory
+    size_t allocateBatch(size_t count, size_t size, size_t alignment, size_t offset, void** out, const char* file, size_t line);
+    void freeBatch(void* const* ptrs, size_t count);
+
     Allocator& allocator();
     const Allocator& allocator() const;
 
+    const MemoryTrackingPolicy& memoryTracker() const;
+
+private:
+    // With no-op policies, the size of the allocations isn't requested from the allocator
+    using NeedsSize = std::integral_constant<bool, !priv::IsNoOpPolicy<BoundsCheckingPolicy>::value || !priv::IsNoOpPolicy<MemoryMarkingPolicy>::value>;
+
+    void guardAllocation(char* ptr, std::true_type);
+    void guardAllocation(char* ptr, std::false_type);
+
+    void checkDeallocation(char* originalMemory, std::true_type);
+    void checkDeallocation(char* originalMemory, std::false_type);
+
+    size_t allocateFromAllocator(size_t count, size_t size, size_t alignment, size_t offset, void** out, std::true_type);
+    size_t allocateFromAllocator(size_t count, size_t size, size_t alignment, size_t offset, void** out, std::false_type);
+
+    void freeToAllocator(void* const* ptrs, size_t count, std::true_type);
+    void freeToAllocator(void* const* ptrs, size_t count, std::false_type);
+
 private:
     Allocator _allocator;
     ThreadPolicy _threadGuard;
     BoundsCheckingPolicy _boundsChecker;
     MemoryMarkingPolicy _memoryMarker;
+    MemoryTrackingPolicy _memoryTracker;
 };
 
 #include <lug/System/Memory/Arena.inl>
@@ -2,31 +2,33 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::Arena(Area::IArea* area) : _allocator{area} {}
+Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::Arena(Area::IArea* area) : _allocator{area} {}
 
 template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-void* Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line) {
-    // TODO: Use file and line
-    (void)(file);
-    (void)(line);
-
+void* Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line) {
     const size_t newSize = size + BoundsCheckingPolicy::SizeFront + BoundsCheckingPolicy::SizeBack;
 
     _threadGuard.enter();
 
     char* const ptr = static_cast<char*>(_allocator.allocate(newSize, alignment, offset + BoundsCheckingPolicy::SizeFront));
-    const size_t allocatedSize = _allocator.getSize(ptr);
 
-    _boundsChecker.guardFront(ptr, allocatedSize);
-    _memoryMarker.markAllocation(ptr + BoundsCheckingPolicy::SizeFront, allocatedSize - BoundsCheckingPolicy::SizeFront - BoundsCheckingPolicy::SizeBack);
-    _boundsChecker.guardBack(ptr, allocatedSize);
+    if (!ptr) {
+        _threadGuard.leave();
+        return nullptr;
+    }
+
+    guardAllocation(ptr, NeedsSize{});
+
+    _memoryTracker.trackAllocation(ptr + BoundsCheckingPolicy::SizeFront, size, alignment, file, line);
 
     _threadGuard.leave();
 
@@ -37,22 +39,20 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::free(void* ptr) {
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::free(void* ptr) {
     if (!ptr) {
         return;
     }
 
     char* const originalMemory = static_cast<char*>(ptr) - BoundsCheckingPolicy::SizeFront;
-    const size_t allocatedSize = _allocator.getSize(originalMemory);
 
     _threadGuard.enter();
 
-    _boundsChecker.checkFront(originalMemory, allocatedSize);
-    _boundsChecker.checkBack(originalMemory, allocatedSize);
-
-    _memoryMarker.markDeallocation(originalMemory, allocatedSize);
+    checkDeallocation(originalMemory, NeedsSize{});
+    _memoryTracker.trackDeallocation(ptr);
 
     _allocator.free(originalMemory);
 
@@ -63,12 +63,14 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::reset() {
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::reset() {
     _threadGuard.enter();
 
     _boundsChecker.checkReset();
+    _memoryTracker.trackReset();
     _allocator.reset();
 
     _threadGuard.leave();
@@ -78,9 +80,74 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+size_t Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocateBatch(size_t count, size_t size, size_t alignment, size_t offset, void** out, const char* file, size_t line) {
+    const size_t newSize = size + BoundsCheckingPolicy::SizeFront + BoundsCheckingPolicy::SizeBack;
+
+    _threadGuard.enter();
+
+    const size_t allocated = allocateFromAllocator(count, newSize, alignment, offset + BoundsCheckingPolicy::SizeFront, out, priv::HasBatch<Allocator>{});
+
+    for (size_t i = 0; i < allocated; ++i) {
+        char* const ptr = static_cast<char*>(out[i]);
+        guardAllocation(ptr, NeedsSize{});
+
+        out[i] = ptr + BoundsCheckingPolicy::SizeFront;
+        _memoryTracker.trackAllocation(out[i], size, alignment, file, line);
+    }
+
+    _threadGuard.leave();
+
+    return allocated;
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::allocator() {
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::freeBatch(void* const* ptrs, size_t count) {
+    // The allocator gets back the addresses it returned, by groups
+    constexpr size_t GroupSize = 64;
+    void* originalMemories[GroupSize];
+
+    _threadGuard.enter();
+
+    for (size_t first = 0; first < count; first += GroupSize) {
+        const size_t last = first + GroupSize < count ? first + GroupSize : count;
+        size_t groupCount = 0;
+
+        for (size_t i = first; i < last; ++i) {
+            if (!ptrs[i]) {
+                continue;
+            }
+
+            char* const originalMemory = static_cast<char*>(ptrs[i]) - BoundsCheckingPolicy::SizeFront;
+
+            checkDeallocation(originalMemory, NeedsSize{});
+            _memoryTracker.trackDeallocation(ptrs[i]);
+
+            originalMemories[groupCount++] = originalMemory;
+        }
+
+        freeToAllocator(originalMemories, groupCount, priv::HasBatch<Allocator>{});
+    }
+
+    _threadGuard.leave();
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocator() {
     return _allocator;
 }
 
@@ -88,8 +155,123 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-const Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::allocator() const {
+const Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocator() const {
     return _allocator;
 }
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+const MemoryTrackingPolicy& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::memoryTracker() const {
+    return _memoryTracker;
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+size_t Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocateFromAllocator(size_t count, size_t size, size_t alignment, size_t offset, void** out, std::true_type) {
+    return _allocator.allocateBatch(count, size, alignment, offset, out);
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+size_t Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocateFromAllocator(size_t count, size_t size, size_t alignment, size_t offset, void** out, std::false_type) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = _allocator.allocate(size, alignment, offset);
+
+        if (!out[i]) {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::freeToAllocator(void* const* ptrs, size_t count, std::true_type) {
+    _allocator.freeBatch(ptrs, count);
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::freeToAllocator(void* const* ptrs, size_t count, std::false_type) {
+    for (size_t i = 0; i < count; ++i) {
+        _allocator.free(ptrs[i]);
+    }
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+inline void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::guardAllocation(char* ptr, std::true_type) {
+    const size_t allocatedSize = _allocator.getSize(ptr);
+
+    _boundsChecker.guardFront(ptr, allocatedSize);
+    _memoryMarker.markAllocation(ptr + BoundsCheckingPolicy::SizeFront, allocatedSize - BoundsCheckingPolicy::SizeFront - BoundsCheckingPolicy::SizeBack);
+    _boundsChecker.guardBack(ptr, allocatedSize);
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+inline void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::guardAllocation(char*, std::false_type) {}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+inline void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::checkDeallocation(char* originalMemory, std::true_type) {
+    const size_t allocatedSize = _allocator.getSize(originalMemory);
+
+    _boundsChecker.checkFront(originalMemory, allocatedSize);
+    _boundsChecker.checkBack(originalMemory, allocatedSize);
+
+    _memoryMarker.markDeallocation(originalMemory, allocatedSize);
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+inline void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::checkDeallocation(char*, std::false_type) {}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Policies/Thread.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+// Lock-free version of `FreeList` (Treiber stack), `allocate` and `free` can be called concurrently
+// The head is a tagged pointer (a pointer and a counter incremented on each `allocate`) to prevent ABA
+// `grow` is not lock-free, the allocator using the list has to serialize it with `GrowPolicy`
+// `reset` is only valid when no other thread uses the list
+// The first pointer of an allocated element may still be read by a concurrent `allocate`, as an atomic
+class LUG_SYSTEM_API AtomicFreeList {
+public:
+    using GrowPolicy = Policies::MultiThreadPolicy<std::mutex>;
+
+public:
+    explicit AtomicFreeList(size_t size);
+
+    AtomicFreeList(const AtomicFreeList&) = delete;
+    AtomicFreeList(AtomicFreeList&&) = delete;
+
+    AtomicFreeList& operator=(const AtomicFreeList&) = delete;
+    AtomicFreeList& operator=(AtomicFreeList&&) = delete;
+
+    ~AtomicFreeList() = default;
+
+    bool grow(void* start, void* end, size_t alignment, size_t offset);
+
+    void* allocate();
+    void free(void* ptr);
+    void reset();
+
+    // `freeBatch` pushes all the elements with a single exchange
+    size_t allocateBatch(size_t count, void** out);
+    void freeBatch(void* const* ptrs, size_t count);
+
+private:
+    // `next` is read by `allocate` while another thread may pop the same element and push it again
+    struct LUG_SYSTEM_API Element {
+        std::atomic<Element*> next;
+    };
+
+    using TaggedPointer = uint64_t;
+
+    static TaggedPointer pack(Element* element, uint64_t tag);
+    static Element* unpackPointer(TaggedPointer tagged);
+    static uint64_t unpackTag(TaggedPointer tagged);
+
+    void push(Element* first, Element* last);
+
+private:
+    size_t _size;
+    std::atomic<TaggedPointer> _head{0};
+};
+
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/GrowingHeap.hpp>
+#include <lug/System/Memory/Arena.hpp>
+#include <lug/System/Memory/Policies/BoundsChecker.hpp>
+#include <lug/System/Memory/Policies/MemoryMarker.hpp>
+#include <lug/System/Memory/Policies/Thread.hpp>
+#include <lug/System/Memory/StlAllocator.hpp>
+#include <lug/System/Utils.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+// Scratch memory for the allocations that only live during one frame
+// There is one linear arena per frame in flight, `nextFrame` switches to the next one and resets it,
+// so the memory of a frame stays valid until `getFrameCount()` frames have passed
+// Freeing is a no-op, everything is released at once when the arena of the frame is reused
+// The allocations bigger than a page are served by the system and released the same way
+class LUG_SYSTEM_API FrameArena {
+public:
+    template <typename T>
+    using Allocator = StlAllocator<T, FrameArena>;
+
+    template <typename T>
+    using Vector = std::vector<T, Allocator<T>>;
+
+    static constexpr size_t PageSize = 64 * 1024;
+    static constexpr size_t MaxPageCount = 256;
+
+public:
+    explicit FrameArena(uint32_t frameCount = 3);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) = delete;
+
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+
+    ~FrameArena();
+
+    void* allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line);
+    void free(void* ptr);
+
+    // Discards the memory of every frame
+    void setFrameCount(uint32_t frameCount);
+    uint32_t getFrameCount() const;
+
+    // Ends the current frame, to call at the frame boundary
+    void nextFrame();
+
+    template <typename T>
+    Allocator<T> getAllocator();
+
+    // Bytes requested during the current frame
+    size_t getUsedSize() const;
+
+    // Maximum bytes requested during one frame since the last call to `resetHighWaterMark`
+    size_t getHighWaterMark() const;
+    void resetHighWaterMark();
+
+    // Pages and large blocks requested to the system since the construction
+    size_t getSystemAllocationCount() const;
+
+private:
+    // Counts the pages requested to the system
+    class Area : public Memory::Area::GrowingHeap<PageSize, MaxPageCount> {
+    public:
+        explicit Area(size_t& pageCount);
+
+        Memory::Area::Page* requestNextPage() override;
+
+    private:
+        size_t& _pageCount;
+    };
+
+    using Arena = Memory::Arena<
+        Memory::Allocator::Linear,
+        Policies::SingleThreadPolicy,
+        Policies::NoBoundsChecking,
+        Policies::NoMemoryMarking
+    >;
+
+private:
+    void* allocateLarge(size_t size, size_t alignment, size_t offset);
+    void releaseLarge(uint32_t frame);
+
+private:
+    std::vector<std::unique_ptr<Area>> _areas;
+    std::vector<std::unique_ptr<Arena>> _arenas;
+
+    // Blocks of `allocateLarge`, per frame
+    std::vector<std::vector<void*>> _largeBlocks;
+
+    uint32_t _currentFrame{0};
+    Arena* _currentArena{nullptr};
+
+    size_t _usedSize{0};
+    size_t _highWaterMark{0};
+
+    size_t _systemAllocationCount{0};
+};
+
+#include <lug/System/Memory/FrameArena.inl>
+
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,48 @@
+inline void* FrameArena::allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line) {
+    // The linear allocator can't split an allocation across pages, and would request every page of the area trying
+    void* ptr = nullptr;
+
+    if (LUG_LIKELY(size + alignment + sizeof(size_t) <= PageSize)) {
+        ptr = _currentArena->allocate(size, alignment, offset, file, line);
+    }
+
+    if (LUG_UNLIKELY(ptr == nullptr)) {
+        ptr = allocateLarge(size, alignment, offset);
+    }
+
+    if (LUG_LIKELY(ptr != nullptr)) {
+        _usedSize += size;
+        _highWaterMark = _highWaterMark < _usedSize ? _usedSize : _highWaterMark;
+    }
+
+    return ptr;
+}
+
+inline void FrameArena::free(void*) {
+    // Do nothing here, the memory is released by `nextFrame`
+}
+
+inline uint32_t FrameArena::getFrameCount() const {
+    return static_cast<uint32_t>(_arenas.size());
+}
+
+template <typename T>
+inline FrameArena::Allocator<T> FrameArena::getAllocator() {
+    return Allocator<T>(*this);
+}
+
+inline size_t FrameArena::getUsedSize() const {
+    return _usedSize;
+}
+
+inline size_t FrameArena::getHighWaterMark() const {
+    return _highWaterMark;
+}
+
+inline void FrameArena::resetHighWaterMark() {
+    _highWaterMark = _usedSize;
+}
+
+inline size_t FrameArena::getSystemAllocationCount() const {
+    return _systemAllocationCount;
+}
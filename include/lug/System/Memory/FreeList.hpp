@@ -2,12 +2,16 @@
 
 #include <cstdlib>
 #include <lug/System/Export.hpp>
+#include <lug/System/Memory/Policies/Thread.hpp>
 
 namespace lug {
 namespace System {
 namespace Memory {
 
 class LUG_SYSTEM_API FreeList {
+public:
+    using GrowPolicy = Policies::SingleThreadPolicy;
+
 public:
     explicit FreeList(size_t size);
 
@@ -25,6 +29,10 @@ public:
     void free(void* ptr);
     void reset();
 
+    // Returns the number of elements written to `out`, lower than `count` if the list runs out
+    size_t allocateBatch(size_t count, void** out);
+    void freeBatch(void* const* ptrs, size_t count);
+
 private:
     struct LUG_SYSTEM_API Element {
         Element* next;
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <lug/System/Memory.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+template <typename T, class Arena>
+class intrusive_ptr;
+
+// Base of the objects shared with `intrusive_ptr`, the reference counter lives in the object itself
+// so there is no separate control block and the pointer stays two words wide
+class IntrusiveRefCount {
+    template <typename T, class Arena>
+    friend class intrusive_ptr;
+
+    template <typename T, class Arena, typename ...Args>
+    friend intrusive_ptr<T, Arena> make_intrusive(Arena& arena, Args&&... args);
+
+public:
+    IntrusiveRefCount() = default;
+
+    // A copy is a new object, it doesn't share the references of the original
+    IntrusiveRefCount(const IntrusiveRefCount&);
+    IntrusiveRefCount(IntrusiveRefCount&&) = delete;
+
+    IntrusiveRefCount& operator=(const IntrusiveRefCount&);
+    IntrusiveRefCount& operator=(IntrusiveRefCount&&) = delete;
+
+    uint32_t getRefCount() const;
+
+protected:
+    ~IntrusiveRefCount() = default;
+
+private:
+    mutable std::atomic<uint32_t> _refCount{0};
+};
+
+template <typename T, class Arena>
+class intrusive_ptr {
+    template <typename U, class OtherArena>
+    friend class intrusive_ptr;
+
+    template <typename U, class OtherArena, typename ...Args>
+    friend intrusive_ptr<U, OtherArena> make_intrusive(OtherArena& arena, Args&&... args);
+
+public:
+    intrusive_ptr() = default;
+    intrusive_ptr(std::nullptr_t);
+
+    // Takes a reference on `ptr`, which must have been allocated in `arena`
+    intrusive_ptr(T* ptr, Arena& arena);
+
+    intrusive_ptr(const intrusive_ptr& other);
+    intrusive_ptr(intrusive_ptr&& other);
+
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    intrusive_ptr(const intrusive_ptr<U, Arena>& other);
+
+    intrusive_ptr& operator=(const intrusive_ptr& other);
+    intrusive_ptr& operator=(intrusive_ptr&& other);
+
+    ~intrusive_ptr();
+
+    void reset();
+
+    T* get() const;
+    Arena* getArena() const;
+
+    T& operator*() const;
+    T* operator->() const;
+
+    explicit operator bool() const;
+
+private:
+    void acquire() const;
+    void release();
+
+private:
+    T* _ptr{nullptr};
+    Arena* _arena{nullptr};
+};
+
+template <typename T, typename U, class Arena>
+bool operator==(const intrusive_ptr<T, Arena>& lhs, const intrusive_ptr<U, Arena>& rhs);
+
+template <typename T, typename U, class Arena>
+bool operator!=(const intrusive_ptr<T, Arena>& lhs, const intrusive_ptr<U, Arena>& rhs);
+
+template <typename T, class Arena, typename ...Args>
+intrusive_ptr<T, Arena> make_intrusive(Arena& arena, Args&&... args);
+
+#include <lug/System/Memory/IntrusivePtr.inl>
+
+} // Memory
+} // System
+} // lug
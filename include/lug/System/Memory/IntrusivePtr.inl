@@ -0,0 +1,150 @@
+inline IntrusiveRefCount::IntrusiveRefCount(const IntrusiveRefCount&) {}
+
+inline IntrusiveRefCount& IntrusiveRefCount::operator=(const IntrusiveRefCount&) {
+    // Keep our own references
+    return *this;
+}
+
+inline uint32_t IntrusiveRefCount::getRefCount() const {
+    return _refCount.load(std::memory_order_relaxed);
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>::intrusive_ptr(std::nullptr_t) {}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>::intrusive_ptr(T* ptr, Arena& arena) : _ptr{ptr}, _arena{&arena} {
+    acquire();
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>::intrusive_ptr(const intrusive_ptr& other) : _ptr{other._ptr}, _arena{other._arena} {
+    acquire();
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>::intrusive_ptr(intrusive_ptr&& other) : _ptr{other._ptr}, _arena{other._arena} {
+    other._ptr = nullptr;
+    other._arena = nullptr;
+}
+
+template <typename T, class Arena>
+template <typename U, typename>
+inline intrusive_ptr<T, Arena>::intrusive_ptr(const intrusive_ptr<U, Arena>& other) : _ptr{other._ptr}, _arena{other._arena} {
+    acquire();
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>& intrusive_ptr<T, Arena>::operator=(const intrusive_ptr& other) {
+    // Acquire first, in case of self assignment
+    other.acquire();
+    release();
+
+    _ptr = other._ptr;
+    _arena = other._arena;
+
+    return *this;
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>& intrusive_ptr<T, Arena>::operator=(intrusive_ptr&& other) {
+    if (this != &other) {
+        release();
+
+        _ptr = other._ptr;
+        _arena = other._arena;
+
+        other._ptr = nullptr;
+        other._arena = nullptr;
+    }
+
+    return *this;
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>::~intrusive_ptr() {
+    release();
+}
+
+template <typename T, class Arena>
+inline void intrusive_ptr<T, Arena>::reset() {
+    release();
+
+    _ptr = nullptr;
+    _arena = nullptr;
+}
+
+template <typename T, class Arena>
+inline T* intrusive_ptr<T, Arena>::get() const {
+    return _ptr;
+}
+
+template <typename T, class Arena>
+inline Arena* intrusive_ptr<T, Arena>::getArena() const {
+    return _arena;
+}
+
+template <typename T, class Arena>
+inline T& intrusive_ptr<T, Arena>::operator*() const {
+    return *_ptr;
+}
+
+template <typename T, class Arena>
+inline T* intrusive_ptr<T, Arena>::operator->() const {
+    return _ptr;
+}
+
+template <typename T, class Arena>
+inline intrusive_ptr<T, Arena>::operator bool() const {
+    return _ptr != nullptr;
+}
+
+template <typename T, class Arena>
+inline void intrusive_ptr<T, Arena>::acquire() const {
+    if (_ptr) {
+        static_cast<const IntrusiveRefCount*>(_ptr)->_refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, class Arena>
+inline void intrusive_ptr<T, Arena>::release() {
+    if (!_ptr) {
+        return;
+    }
+
+    std::atomic<uint32_t>& refCount = static_cast<const IntrusiveRefCount*>(_ptr)->_refCount;
+
+    // Sole owner, nobody else can take a reference, skip the read-modify-write
+    // Otherwise the last reference must see every write made through the others before destroying the object
+    if (refCount.load(std::memory_order_acquire) == 1 || refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        LUG_DELETE(_ptr, *_arena);
+    }
+}
+
+template <typename T, typename U, class Arena>
+inline bool operator==(const intrusive_ptr<T, Arena>& lhs, const intrusive_ptr<U, Arena>& rhs) {
+    return lhs.get() == rhs.get();
+}
+
+template <typename T, typename U, class Arena>
+inline bool operator!=(const intrusive_ptr<T, Arena>& lhs, const intrusive_ptr<U, Arena>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T, class Arena, typename ...Args>
+inline intrusive_ptr<T, Arena> make_intrusive(Arena& arena, Args&&... args) {
+    T* const ptr = LUG_NEW(T, arena, std::forward<Args>(args)...);
+
+    if (!ptr) {
+        return nullptr;
+    }
+
+    // The object isn't shared yet, no need for an atomic increment
+    static_cast<const IntrusiveRefCount*>(ptr)->_refCount.store(1, std::memory_order_relaxed);
+
+    intrusive_ptr<T, Arena> result;
+    result._ptr = ptr;
+    result._arena = &arena;
+
+    return result;
+}
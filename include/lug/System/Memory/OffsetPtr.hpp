@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+// Pointer storing the distance between itself and the pointee instead of an address,
+// so a structure linked with them stays valid when its memory is mapped at another address (see `Area::MappedHeap`)
+// Both the pointer and the pointee must be in the same block of memory
+template <typename T>
+class offset_ptr {
+    template <typename U>
+    friend class offset_ptr;
+
+public:
+    offset_ptr() = default;
+    offset_ptr(std::nullptr_t);
+    offset_ptr(T* ptr);
+
+    // The offset is recomputed from the new location
+    offset_ptr(const offset_ptr& other);
+
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    offset_ptr(const offset_ptr<U>& other);
+
+    offset_ptr& operator=(const offset_ptr& other);
+    offset_ptr& operator=(T* ptr);
+    offset_ptr& operator=(std::nullptr_t);
+
+    ~offset_ptr() = default;
+
+    T* get() const;
+
+    T& operator*() const;
+    T* operator->() const;
+    T& operator[](size_t index) const;
+
+    explicit operator bool() const;
+
+private:
+    // An offset of 1 points inside the pointer itself, it can't be a pointee
+    static constexpr intptr_t Null = 1;
+
+    intptr_t getOffset(const T* ptr) const;
+
+private:
+    intptr_t _offset{Null};
+};
+
+template <typename T, typename U>
+bool operator==(const offset_ptr<T>& lhs, const offset_ptr<U>& rhs);
+
+template <typename T, typename U>
+bool operator!=(const offset_ptr<T>& lhs, const offset_ptr<U>& rhs);
+
+template <typename T>
+bool operator==(const offset_ptr<T>& lhs, std::nullptr_t);
+
+template <typename T>
+bool operator!=(const offset_ptr<T>& lhs, std::nullptr_t);
+
+#include <lug/System/Memory/OffsetPtr.inl>
+
+} // Memory
+} // System
+} // lug
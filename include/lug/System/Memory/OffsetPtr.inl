@@ -0,0 +1,91 @@
+template <typename T>
+constexpr intptr_t offset_ptr<T>::Null;
+
+template <typename T>
+inline offset_ptr<T>::offset_ptr(std::nullptr_t) {}
+
+template <typename T>
+inline offset_ptr<T>::offset_ptr(T* ptr) : _offset{getOffset(ptr)} {}
+
+template <typename T>
+inline offset_ptr<T>::offset_ptr(const offset_ptr& other) : _offset{getOffset(other.get())} {}
+
+template <typename T>
+template <typename U, typename>
+inline offset_ptr<T>::offset_ptr(const offset_ptr<U>& other) : _offset{getOffset(other.get())} {}
+
+template <typename T>
+inline offset_ptr<T>& offset_ptr<T>::operator=(const offset_ptr& other) {
+    _offset = getOffset(other.get());
+    return *this;
+}
+
+template <typename T>
+inline offset_ptr<T>& offset_ptr<T>::operator=(T* ptr) {
+    _offset = getOffset(ptr);
+    return *this;
+}
+
+template <typename T>
+inline offset_ptr<T>& offset_ptr<T>::operator=(std::nullptr_t) {
+    _offset = Null;
+    return *this;
+}
+
+template <typename T>
+inline T* offset_ptr<T>::get() const {
+    if (_offset == Null) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<T*>(reinterpret_cast<intptr_t>(this) + _offset);
+}
+
+template <typename T>
+inline T& offset_ptr<T>::operator*() const {
+    return *get();
+}
+
+template <typename T>
+inline T* offset_ptr<T>::operator->() const {
+    return get();
+}
+
+template <typename T>
+inline T& offset_ptr<T>::operator[](size_t index) const {
+    return get()[index];
+}
+
+template <typename T>
+inline offset_ptr<T>::operator bool() const {
+    return _offset != Null;
+}
+
+template <typename T>
+inline intptr_t offset_ptr<T>::getOffset(const T* ptr) const {
+    if (!ptr) {
+        return Null;
+    }
+
+    return reinterpret_cast<intptr_t>(ptr) - reinterpret_cast<intptr_t>(this);
+}
+
+template <typename T, typename U>
+inline bool operator==(const offset_ptr<T>& lhs, const offset_ptr<U>& rhs) {
+    return lhs.get() == rhs.get();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const offset_ptr<T>& lhs, const offset_ptr<U>& rhs) {
+    return lhs.get() != rhs.get();
+}
+
+template <typename T>
+inline bool operator==(const offset_ptr<T>& lhs, std::nullptr_t) {
+    return !lhs;
+}
+
+template <typename T>
+inline bool operator!=(const offset_ptr<T>& lhs, std::nullptr_t) {
+    return static_cast<bool>(lhs);
+}
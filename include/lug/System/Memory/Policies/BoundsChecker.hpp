@@ -19,6 +19,8 @@ public:
 
     void checkFront(void* ptr, size_t size) const;
     void checkBack(void* ptr, size_t size) const;
+
+    void checkReset() const;
 };
 
 class SimpleBoundsChecking {
@@ -32,9 +34,11 @@ public:
     void checkFront(void* ptr, size_t size) const;
     void checkBack(void* ptr, size_t size) const;
 
+    void checkReset() const;
+
 private:
-    static constexpr const char* MagicFront = "\xDE\xAD";
-    static constexpr const char* MagicBack = "\xBE\xEF";
+    static constexpr const char* MagicFront = "\xDE\xAD\xDE\xAD";
+    static constexpr const char* MagicBack = "\xBE\xEF\xBE\xEF";
 };
 
 #include <lug/System/Memory/Policies/BoundsChecker.inl>
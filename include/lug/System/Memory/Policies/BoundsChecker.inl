@@ -4,6 +4,8 @@ inline void NoBoundsChecking::guardBack(void*, size_t) const {}
 inline void NoBoundsChecking::checkFront(void*, size_t) const {}
 inline void NoBoundsChecking::checkBack(void*, size_t) const {}
 
+inline void NoBoundsChecking::checkReset() const {}
+
 inline void SimpleBoundsChecking::guardFront(void* ptr, size_t) const {
     std::memcpy(ptr, SimpleBoundsChecking::MagicFront, SimpleBoundsChecking::SizeFront);
 }
@@ -32,3 +34,7 @@ inline void SimpleBoundsChecking::checkBack(void* ptr, size_t size) const {
         "Memory overwrite at back of the user buffer"
     );
 }
+
+inline void SimpleBoundsChecking::checkReset() const {
+    // The guards of the live allocations are not tracked, nothing to check
+}
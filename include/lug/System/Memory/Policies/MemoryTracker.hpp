@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <lug/System/Export.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Policies {
+
+class NoMemoryTracking {
+public:
+    inline void trackAllocation(void* ptr, size_t size, size_t alignment, const char* file, size_t line) const;
+    inline void trackDeallocation(void* ptr) const;
+    inline void trackReset() const;
+};
+
+// Records the live allocations of the arena with the place they come from
+// The allocations are stored in an open-addressing hash table keyed by address, the sites in a second one keyed by file and line
+// The leaks are logged when the arena is destroyed
+class LUG_SYSTEM_API SimpleMemoryTracking {
+public:
+    struct Site {
+        const char* file;
+        size_t line;
+
+        size_t allocationCount;
+        size_t liveCount;
+        size_t liveBytes;
+    };
+
+public:
+    SimpleMemoryTracking() = default;
+
+    SimpleMemoryTracking(const SimpleMemoryTracking&) = delete;
+
+    // The allocations follow the tracker, the moved-from one is left empty and reports no leak
+    SimpleMemoryTracking(SimpleMemoryTracking&& other);
+
+    SimpleMemoryTracking& operator=(const SimpleMemoryTracking&) = delete;
+    SimpleMemoryTracking& operator=(SimpleMemoryTracking&& other);
+
+    ~SimpleMemoryTracking();
+
+    void trackAllocation(void* ptr, size_t size, size_t alignment, const char* file, size_t line);
+    void trackDeallocation(void* ptr);
+    void trackReset();
+
+    size_t getLiveCount() const;
+    size_t getLiveBytes() const;
+    size_t getPeakBytes() const;
+
+    const std::vector<Site>& getSites() const;
+
+    // Calls `function(ptr, size, alignment, site)` for each live allocation
+    template <typename Function>
+    void forEachAllocation(Function&& function) const;
+
+    // Logs the live allocations, grouped by site
+    void dumpLeaks() const;
+
+private:
+    struct Allocation {
+        void* ptr;
+        size_t size;
+        uint32_t alignment;
+        uint32_t site;
+    };
+
+    static constexpr uint32_t NoSite = UINT32_MAX;
+
+    uint32_t findSite(const char* file, size_t line);
+    void growAllocations();
+    void growSites();
+    void clear();
+
+private:
+    // `ptr == nullptr` for the empty slots, the capacity is a power of two and never more than half full
+    std::vector<Allocation> _allocations;
+    size_t _liveCount{0};
+    size_t _liveBytes{0};
+    size_t _peakBytes{0};
+
+    std::vector<Site> _sites;
+    std::vector<uint32_t> _siteTable;
+    uint32_t _lastSite{NoSite};
+};
+
+#include <lug/System/Memory/Policies/MemoryTracker.inl>
+
+} // Policies
+} // Memory
+} // System
+} // lug
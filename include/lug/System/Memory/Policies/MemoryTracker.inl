@@ -0,0 +1,28 @@
+inline void NoMemoryTracking::trackAllocation(void*, size_t, size_t, const char*, size_t) const {}
+inline void NoMemoryTracking::trackDeallocation(void*) const {}
+inline void NoMemoryTracking::trackReset() const {}
+
+inline size_t SimpleMemoryTracking::getLiveCount() const {
+    return _liveCount;
+}
+
+inline size_t SimpleMemoryTracking::getLiveBytes() const {
+    return _liveBytes;
+}
+
+inline size_t SimpleMemoryTracking::getPeakBytes() const {
+    return _peakBytes;
+}
+
+inline const std::vector<SimpleMemoryTracking::Site>& SimpleMemoryTracking::getSites() const {
+    return _sites;
+}
+
+template <typename Function>
+inline void SimpleMemoryTracking::forEachAllocation(Function&& function) const {
+    for (const Allocation& allocation : _allocations) {
+        if (allocation.ptr) {
+            function(allocation.ptr, allocation.size, static_cast<size_t>(allocation.alignment), _sites[allocation.site]);
+        }
+    }
+}
@@ -1,7 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
 #include <lug/System/Export.hpp>
 
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
 namespace lug {
 namespace System {
 namespace Memory {
@@ -23,6 +31,65 @@ private:
     SynchronizationPrimitive _primitive;
 };
 
+// Test-and-test-and-set lock spinning with an exponential backoff, for critical sections of a few instructions
+// The thread yields once the backoff is at its maximum, so a preempted owner can still make progress
+class SpinLockPolicy {
+public:
+    SpinLockPolicy() = default;
+
+    SpinLockPolicy(const SpinLockPolicy&) = delete;
+    SpinLockPolicy(SpinLockPolicy&&) = delete;
+
+    SpinLockPolicy& operator=(const SpinLockPolicy&) = delete;
+    SpinLockPolicy& operator=(SpinLockPolicy&&) = delete;
+
+    ~SpinLockPolicy() = default;
+
+    void enter();
+    void leave();
+
+private:
+    static constexpr size_t MaxBackoff = 64;
+
+    std::atomic<bool> _locked{false};
+};
+
+// Spins up to `SpinCount` times on the mutex while it's held, then blocks on it
+// The uncontended and short contended cases don't leave user space, the long ones don't burn the CPU
+template <size_t SpinCount = 100>
+class AdaptiveLockPolicy {
+public:
+    AdaptiveLockPolicy() = default;
+
+    AdaptiveLockPolicy(const AdaptiveLockPolicy&) = delete;
+    AdaptiveLockPolicy(AdaptiveLockPolicy&&) = delete;
+
+    AdaptiveLockPolicy& operator=(const AdaptiveLockPolicy&) = delete;
+    AdaptiveLockPolicy& operator=(AdaptiveLockPolicy&&) = delete;
+
+    ~AdaptiveLockPolicy() = default;
+
+    void enter();
+    void leave();
+
+private:
+    std::mutex _mutex;
+    std::atomic<bool> _locked{false};
+};
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// Hint to the CPU that the thread is spinning
+inline void pause();
+
+}
+/**
+ * \endcond
+ */
+
 #include <lug/System/Memory/Policies/Thread.inl>
 
 } // Policies
@@ -10,3 +10,55 @@ template <class SynchronizationPrimitive>
 inline void MultiThreadPolicy<SynchronizationPrimitive>::leave() {
     _primitive.unlock();
 }
+
+inline void priv::pause() {
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+inline void SpinLockPolicy::enter() {
+    size_t backoff = 1;
+
+    // Only try to take the lock when it looks free, to spin on a shared cache line
+    while (_locked.exchange(true, std::memory_order_acquire)) {
+        do {
+            if (backoff < MaxBackoff) {
+                for (size_t i = 0; i < backoff; ++i) {
+                    priv::pause();
+                }
+
+                backoff *= 2;
+            } else {
+                std::this_thread::yield();
+            }
+        } while (_locked.load(std::memory_order_relaxed));
+    }
+}
+
+inline void SpinLockPolicy::leave() {
+    _locked.store(false, std::memory_order_release);
+}
+
+template <size_t SpinCount>
+inline void AdaptiveLockPolicy<SpinCount>::enter() {
+    for (size_t i = 0; i < SpinCount; ++i) {
+        if (!_locked.load(std::memory_order_relaxed) && _mutex.try_lock()) {
+            _locked.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        priv::pause();
+    }
+
+    _mutex.lock();
+    _locked.store(true, std::memory_order_relaxed);
+}
+
+template <size_t SpinCount>
+inline void AdaptiveLockPolicy<SpinCount>::leave() {
+    _locked.store(false, std::memory_order_relaxed);
+    _mutex.unlock();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <lug/System/Export.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+// Rewinds an allocator providing `getMark` and `rewind` (`Linear`, `Bump` or `Stack`) to where it was
+// when the guard was created, releasing everything allocated in the scope at once
+// The pointers allocated in the scope must not be used nor freed after the guard is destroyed
+template <class Allocator>
+class ScopedMark {
+public:
+    explicit ScopedMark(Allocator& allocator);
+
+    ScopedMark(const ScopedMark&) = delete;
+    ScopedMark(ScopedMark&&) = delete;
+
+    ScopedMark& operator=(const ScopedMark&) = delete;
+    ScopedMark& operator=(ScopedMark&&) = delete;
+
+    ~ScopedMark();
+
+private:
+    Allocator& _allocator;
+    const typename Allocator::Mark _mark;
+};
+
+#include <lug/System/Memory/ScopedMark.inl>
+
+} // Memory
+} // System
+} // lug
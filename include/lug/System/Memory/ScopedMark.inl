@@ -0,0 +1,7 @@
+template <class Allocator>
+inline ScopedMark<Allocator>::ScopedMark(Allocator& allocator) : _allocator(allocator), _mark(allocator.getMark()) {}
+
+template <class Allocator>
+inline ScopedMark<Allocator>::~ScopedMark() {
+    _allocator.rewind(_mark);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <lug/System/Export.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+// Adapter to use an arena (or anything with the same `allocate` / `free` interface) as the allocator of a STL container
+// The allocator only holds a pointer to the arena, two allocators are equal if they use the same arena
+// The arena follows the container on copy, move and swap
+template <typename T, class Arena>
+class StlAllocator {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind {
+        using other = StlAllocator<U, Arena>;
+    };
+
+public:
+    explicit StlAllocator(Arena& arena);
+
+    // Not explicit, the containers need to convert their allocator implicitly to the rebound types
+    template <typename U>
+    StlAllocator(const StlAllocator<U, Arena>& other);
+
+    StlAllocator(const StlAllocator&) = default;
+    StlAllocator(StlAllocator&&) = default;
+
+    StlAllocator& operator=(const StlAllocator&) = default;
+    StlAllocator& operator=(StlAllocator&&) = default;
+
+    ~StlAllocator() = default;
+
+    T* allocate(size_type count);
+    void deallocate(T* ptr, size_type count);
+
+    Arena* getArena() const;
+
+private:
+    Arena* _arena;
+};
+
+template <typename T, typename U, class Arena>
+bool operator==(const StlAllocator<T, Arena>& lhs, const StlAllocator<U, Arena>& rhs);
+
+template <typename T, typename U, class Arena>
+bool operator!=(const StlAllocator<T, Arena>& lhs, const StlAllocator<U, Arena>& rhs);
+
+#include <lug/System/Memory/StlAllocator.inl>
+
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,37 @@
+template <typename T, class Arena>
+inline StlAllocator<T, Arena>::StlAllocator(Arena& arena) : _arena{&arena} {}
+
+template <typename T, class Arena>
+template <typename U>
+inline StlAllocator<T, Arena>::StlAllocator(const StlAllocator<U, Arena>& other) : _arena{other.getArena()} {}
+
+template <typename T, class Arena>
+inline T* StlAllocator<T, Arena>::allocate(size_type count) {
+    void* const ptr = _arena->allocate(sizeof(T) * count, alignof(T), 0, __FILE__, __LINE__);
+
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+
+    return static_cast<T*>(ptr);
+}
+
+template <typename T, class Arena>
+inline void StlAllocator<T, Arena>::deallocate(T* ptr, size_type) {
+    _arena->free(ptr);
+}
+
+template <typename T, class Arena>
+inline Arena* StlAllocator<T, Arena>::getArena() const {
+    return _arena;
+}
+
+template <typename T, typename U, class Arena>
+inline bool operator==(const StlAllocator<T, Arena>& lhs, const StlAllocator<U, Arena>& rhs) {
+    return lhs.getArena() == rhs.getArena();
+}
+
+template <typename T, typename U, class Arena>
+inline bool operator!=(const StlAllocator<T, Arena>& lhs, const StlAllocator<U, Arena>& rhs) {
+    return !(lhs == rhs);
+}
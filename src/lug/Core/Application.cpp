@@ -60,11 +60,16 @@ bool Application::run() {
         onFrame(elapsedTime);
         endFrame();
 
+        // Everything allocated in the frame arena during this frame is released when its slot comes back
+        System::Memory::FrameArena& frameArena = _graphics.getRenderer()->getFrameArena();
+        frameArena.nextFrame();
+
         elapsed += elapsedTime.getSeconds<float>();
         frames++;
 
         if (elapsed >= 1.0f) {
-            LUG_LOG.info("FPS: {}", frames / elapsed);
+            LUG_LOG.info("FPS: {}, frame memory high-water mark: {} bytes", frames / elapsed, frameArena.getHighWaterMark());
+            frameArena.resetHighWaterMark();
             frames = 0;
             elapsed = 0;
         }
@@ -1,5 +1,4 @@
 #include <lug/Graphics/Node.hpp>
-#include <lug/Math/Geometry/Transform.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -181,7 +180,8 @@ void Node::update() {
         _absoluteScale = _scale;
     }
 
-    _transform = Math::Geometry::translate(_absolutePosition) * _absoluteRotation.transform() * Math::Geometry::scale(_absoluteScale);
+    _affineTransform = Math::Affine3f::fromTRS(_absolutePosition, _absoluteRotation, _absoluteScale);
+    _transform = _affineTransform.toMatrix();
 
     _needUpdate = false;
 }
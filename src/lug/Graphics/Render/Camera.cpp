@@ -41,7 +41,7 @@ void Camera::updateProj() {
 }
 
 void Camera::updateView() {
-    _viewMatrix = getTransform().inverse();
+    _viewMatrix = getAffineTransform().inverse().toMatrix();
     _needUpdateView = false;
 }
 
@@ -1,5 +1,4 @@
 #include <lug/Graphics/Render/Queue.hpp>
-#include <cstring>
 #include <lug/Graphics/Light/Light.hpp>
 #include <lug/Graphics/Scene/MeshInstance.hpp>
 #include <lug/Graphics/Scene/ModelInstance.hpp>
@@ -16,12 +15,10 @@ void Queue::addMovableObject(Scene::MovableObject* object) {
     }
 
     if (object->getType() == Scene::MovableObject::Type::Light) {
-        _lights[_lightsNb] = static_cast<Light::Light*>(object);
-        ++_lightsNb;
+        _lights.push_back(static_cast<Light::Light*>(object));
         return;
     } else if (object->getType() == Scene::MovableObject::Type::Mesh) {
-        _meshs[_meshsNb] = static_cast<Scene::MeshInstance*>(object);
-        ++_meshsNb;
+        _meshs.push_back(static_cast<Scene::MeshInstance*>(object));
         return;
     } else if (object->getType() == Scene::MovableObject::Type::Model) {
         Scene::ModelInstance* modelInstance = static_cast<Scene::ModelInstance*>(object);
@@ -36,20 +33,27 @@ void Queue::addMovableObject(Scene::MovableObject* object) {
 }
 
 void Queue::clear() {
-    std::memset(_meshs.data(), 0, _meshsNb * sizeof(void*));
-    _meshsNb = 0;
+    const std::size_t meshsNb = _meshs.size();
+    const std::size_t lightsNb = _lights.size();
 
-    std::memset(_lights.data(), 0, _lightsNb * sizeof(void*));
-    _lightsNb = 0;
+    // Give the memory back to the arena before resetting it
+    _meshs = System::Memory::FrameArena::Vector<Scene::MeshInstance*>(_frameArena.getAllocator<Scene::MeshInstance*>());
+    _lights = System::Memory::FrameArena::Vector<Light::Light*>(_frameArena.getAllocator<Light::Light*>());
+
+    _frameArena.nextFrame();
+
+    // The next frame most likely sees as many objects as this one
+    _meshs.reserve(meshsNb);
+    _lights.reserve(lightsNb);
 }
 
 void Queue::removeDirtyProperty() {
-    for (std::size_t i = 0; i < _meshsNb; ++i) {
-        _meshs[i]->isDirty(false);
+    for (auto mesh : _meshs) {
+        mesh->isDirty(false);
     }
 
-    for (std::size_t i = 0; i < _lightsNb; ++i) {
-        _lights[i]->isDirty(false);
+    for (auto light : _lights) {
+        light->isDirty(false);
     }
 }
 
@@ -6,7 +6,7 @@ namespace lug {
 namespace Graphics {
 namespace Scene {
 
-Node::Node(Scene& scene, const std::string& name) : ::lug::Graphics::Node(name), _scene(scene) {}
+Node::Node(Scene& scene, const std::string& name) : ::lug::Graphics::Node(name), _scene(scene), _movableObjects(_scene.getAllocator<std::unique_ptr<MovableObject>>()) {}
 
 Node* Node::createSceneNode(const std::string& name, std::unique_ptr<MovableObject> object) {
     std::unique_ptr<Node> node = _scene.createSceneNode(name, std::move(object));
@@ -11,13 +11,23 @@ namespace Vulkan {
 namespace API {
 
 void CommandBuffer::bindDescriptorSets(const CommandBuffer::CmdBindDescriptors& parameters) const {
-    std::vector<VkDescriptorSet> descriptorSets;
+    // Few descriptor sets are bound at once, keep them on the stack in the common case
+    constexpr size_t maxStackDescriptorSets = 8;
+
+    VkDescriptorSet stackDescriptorSets[maxStackDescriptorSets];
+    std::vector<VkDescriptorSet> heapDescriptorSets;
+
+    VkDescriptorSet* descriptorSets = stackDescriptorSets;
+    if (parameters.descriptorSets.size() > maxStackDescriptorSets) {
+        heapDescriptorSets.resize(parameters.descriptorSets.size());
+        descriptorSets = heapDescriptorSets.data();
+    }
 
     std::transform(
         parameters.descriptorSets.cbegin(),
         parameters.descriptorSets.cend(),
 
-        std::back_inserter(descriptorSets),
+        descriptorSets,
 
         [](const API::DescriptorSet* descriptorSet) {
             return static_cast<VkDescriptorSet>(*descriptorSet);
@@ -30,7 +40,7 @@ void CommandBuffer::bindDescriptorSets(const CommandBuffer::CmdBindDescriptors&
         static_cast<VkPipelineLayout>(parameters.pipelineLayout),
         parameters.firstSet,
         static_cast<uint32_t>(parameters.descriptorSets.size()),
-        descriptorSets.data(),
+        descriptorSets,
         static_cast<uint32_t>(parameters.dynamicOffsets.size()),
         parameters.dynamicOffsets.data()
     );
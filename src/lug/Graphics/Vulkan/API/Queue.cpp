@@ -32,20 +32,36 @@ bool Queue::submit(
     const std::vector<VkPipelineStageFlags>& waitDstStageMasks,
     VkFence fence) const {
 
-    LUG_ASSERT(waitSemaphores.size() == waitDstStageMasks.size(), "waitDstStageMasks should be the same size as waitSemaphores");
+    return submit<std::vector<VkSemaphore>, std::vector<VkSemaphore>, std::vector<VkPipelineStageFlags>>(
+        commandBuffer,
+        signalSemaphores,
+        waitSemaphores,
+        waitDstStageMasks,
+        fence
+    );
+}
+
+bool Queue::submit(
+    const CommandBuffer& commandBuffer,
+    uint32_t signalSemaphoreCount,
+    const VkSemaphore* signalSemaphores,
+    uint32_t waitSemaphoreCount,
+    const VkSemaphore* waitSemaphores,
+    const VkPipelineStageFlags* waitDstStageMasks,
+    VkFence fence) const {
 
     VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
 
     const VkSubmitInfo submitInfo{
         /* submitInfo.sType */ VK_STRUCTURE_TYPE_SUBMIT_INFO,
         /* submitInfo.pNext */ nullptr,
-        /* submitInfo.waitSemaphoreCount */ waitSemaphores.size() > 0 ? (uint32_t)waitSemaphores.size() : 0,
-        /* submitInfo.pWaitSemaphores */ waitSemaphores.size() > 0 ? waitSemaphores.data() : nullptr,
-        /* submitInfo.pWaitDstStageMask */ waitDstStageMasks.size() > 0 ? waitDstStageMasks.data() : nullptr,
+        /* submitInfo.waitSemaphoreCount */ waitSemaphoreCount,
+        /* submitInfo.pWaitSemaphores */ waitSemaphores,
+        /* submitInfo.pWaitDstStageMask */ waitDstStageMasks,
         /* submitInfo.commandBufferCount */ 1,
         /* submitInfo.pCommandBuffers */ &vkCommandBuffer,
-        /* submitInfo.signalSemaphoreCount */ signalSemaphores.size() > 0 ? (uint32_t)signalSemaphores.size() : 0,
-        /* submitInfo.pSignalSemaphores */ signalSemaphores.size() > 0 ? signalSemaphores.data() : nullptr
+        /* submitInfo.signalSemaphoreCount */ signalSemaphoreCount,
+        /* submitInfo.pSignalSemaphores */ signalSemaphores
     };
 
     VkResult result = vkQueueSubmit(_queue, 1, &submitInfo, fence);
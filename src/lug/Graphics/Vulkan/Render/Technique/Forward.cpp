@@ -184,6 +184,15 @@ bool Forward::render(
             cmdBuffer.setBlendConstants(blendConstants);
         }
 
+        // Built once and patched for every light, to not allocate the vectors in the loop
+        API::CommandBuffer::CmdBindDescriptors lightBind {
+            /* lightBind.pipelineLayout */ *_pipelines[Light::Light::Type::Directional].getLayout(),
+            /* lightBind.pipelineBindPoint */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+            /* lightBind.firstSet */ 1,
+            /* lightBind.descriptorSets */ {nullptr},
+            /* lightBind.dynamicOffsets */ {0},
+        };
+
         for (std::size_t i = 0; i < renderQueue.getLightsNb(); ++i) {
 
             {
@@ -203,13 +212,8 @@ bool Forward::render(
 
             BufferPool::SubBuffer* lightBuffer = _subBuffers[light->getName()];
 
-            const API::CommandBuffer::CmdBindDescriptors lightBind {
-                /* cameraBind.pipelineLayout */ *_pipelines[Light::Light::Type::Directional].getLayout(),
-                /* lightBind.pipelineBindPoint */ VK_PIPELINE_BIND_POINT_GRAPHICS,
-                /* lightBind.firstSet */ 1,
-                /* lightBind.descriptorSets */ {lightBuffer->descriptorSet},
-                /* lightBind.dynamicOffsets */ {lightBuffer->offset},
-            };
+            lightBind.descriptorSets[0] = lightBuffer->descriptorSet;
+            lightBind.dynamicOffsets[0] = lightBuffer->offset;
 
             cmdBuffer.bindDescriptorSets(lightBind);
 
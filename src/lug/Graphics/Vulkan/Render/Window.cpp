@@ -1,3 +1,4 @@
+#include <array>
 #include <cstring>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Render/Window.hpp>
@@ -92,7 +93,7 @@ bool Window::beginFrame() {
     FrameData& frameData = _framesData[_currentImageIndex];
     API::CommandBuffer& cmdBuffer = frameData.cmdBuffers[0];
 
-    std::vector<VkSemaphore> imageReadyVkSemaphores;
+    System::Memory::FrameArena::Vector<VkSemaphore> imageReadyVkSemaphores(_renderer.getFrameArena().getAllocator<VkSemaphore>());
     imageReadyVkSemaphores.reserve(frameData.imageReadySemaphores.size());
 
     std::transform(
@@ -104,11 +105,14 @@ bool Window::beginFrame() {
                     }
         );
 
+    const std::array<VkSemaphore, 1> waitSemaphores{{static_cast<VkSemaphore>(acquireImageData->completeSemaphore)}};
+    const std::array<VkPipelineStageFlags, 1> waitDstStageMasks{{VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT}};
+
     return _presentQueue->submit(
         cmdBuffer,
         imageReadyVkSemaphores,
-        {static_cast<VkSemaphore>(acquireImageData->completeSemaphore)},
-        {VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT}
+        waitSemaphores,
+        waitDstStageMasks
         );
 }
 
@@ -116,7 +120,9 @@ bool Window::endFrame() {
     FrameData& frameData = _framesData[_currentImageIndex];
 
     API::CommandBuffer& cmdBuffer = frameData.cmdBuffers[1];
-    std::vector<VkSemaphore> waitSemaphores(_renderViews.size());
+    System::Memory::FrameArena& frameArena = _renderer.getFrameArena();
+
+    System::Memory::FrameArena::Vector<VkSemaphore> waitSemaphores(_renderViews.size(), frameArena.getAllocator<VkSemaphore>());
     uint32_t i = 0;
 
     for (auto& renderView: _renderViews) {
@@ -133,11 +139,17 @@ bool Window::endFrame() {
     if (waitSemaphores.size() != i) {
         waitSemaphores.resize(i);
     }
-    std::vector<VkPipelineStageFlags> waitDstStageMasks(waitSemaphores.size(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    System::Memory::FrameArena::Vector<VkPipelineStageFlags> waitDstStageMasks(
+        waitSemaphores.size(),
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        frameArena.getAllocator<VkPipelineStageFlags>()
+    );
+
+    const std::array<VkSemaphore, 1> signalSemaphores{{static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore)}};
 
     return _presentQueue->submit(
         cmdBuffer,
-        {static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore)},
+        signalSemaphores,
         waitSemaphores, waitDstStageMasks
     ) && _swapchain.present(_presentQueue, _currentImageIndex, static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore));
 }
@@ -416,6 +428,9 @@ bool Window::initFramesData() {
     }
 
     _framesData.resize(frameDataSize);
+
+    // One frame arena per swapchain image, so the memory of a frame outlives the frames still in flight
+    _renderer.getFrameArena().setFrameCount(frameDataSize);
     _acquireImageDatas.resize(frameDataSize + 1);
 
     API::Builder::CommandBuffer commandBufferBuilder(_renderer.getDevice(), _commandPool);
@@ -0,0 +1,238 @@
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <lug/Math/Simd.hpp>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+
+// The elements are handled by groups of `Simd::Width`, the remaining ones with the scalar versions
+
+Vec3f getVector(const Vec3SoA<const float>& vectors, size_t index) {
+    return {vectors[0][index], vectors[1][index], vectors[2][index]};
+}
+
+void setVector(const Vec3SoA<float>& vectors, size_t index, const Vec3f& vector) {
+    for (uint8_t component = 0; component < 3; ++component) {
+        vectors[component][index] = vector(component);
+    }
+}
+
+Quatf getQuaternion(const QuatSoA<const float>& quaternions, size_t index) {
+    return {quaternions[0][index], quaternions[1][index], quaternions[2][index], quaternions[3][index]};
+}
+
+void setQuaternion(const QuatSoA<float>& quaternions, size_t index, const Quatf& quaternion) {
+    for (uint8_t component = 0; component < 4; ++component) {
+        quaternions[component][index] = quaternion[component];
+    }
+}
+
+Mat4x4f getMatrix(const Mat4x4SoA<const float>& matrices, size_t index) {
+    Mat4x4f matrix;
+
+    for (uint8_t component = 0; component < 16; ++component) {
+        matrix.getValues()[component] = matrices[component][index];
+    }
+
+    return matrix;
+}
+
+void setMatrix(const Mat4x4SoA<float>& matrices, size_t index, const Mat4x4f& matrix) {
+    for (uint8_t component = 0; component < 16; ++component) {
+        matrices[component][index] = matrix.getValues()[component];
+    }
+}
+
+void transformPoints(const Mat4x4f& matrix, const Vec3SoA<const float>& points, const Vec3SoA<float>& result, size_t count) {
+    Simd::Float4 coefficients[3][4];
+
+    for (uint8_t row = 0; row < 3; ++row) {
+        for (uint8_t col = 0; col < 4; ++col) {
+            coefficients[row][col] = Simd::splat(matrix(row, col));
+        }
+    }
+
+    size_t i = 0;
+    for (; i + Simd::Width <= count; i += Simd::Width) {
+        const Simd::Float4 x = Simd::load(points[0] + i);
+        const Simd::Float4 y = Simd::load(points[1] + i);
+        const Simd::Float4 z = Simd::load(points[2] + i);
+
+        for (uint8_t row = 0; row < 3; ++row) {
+            Simd::store(
+                result[row] + i,
+                Simd::madd(coefficients[row][2], z, Simd::madd(coefficients[row][1], y, Simd::madd(coefficients[row][0], x, coefficients[row][3])))
+            );
+        }
+    }
+
+    for (; i < count; ++i) {
+        setVector(result, i, matrix * getVector(points, i));
+    }
+}
+
+void multiply(const Mat4x4SoA<const float>& lhs, const Mat4x4SoA<const float>& rhs, const Mat4x4SoA<float>& result, size_t count) {
+    size_t i = 0;
+    for (; i + Simd::Width <= count; i += Simd::Width) {
+        // Everything is computed before the stores, the result can be one of the operands
+        Simd::Float4 values[16];
+
+        for (uint8_t col = 0; col < 4; ++col) {
+            const Simd::Float4 rhs0 = Simd::load(rhs[col * 4] + i);
+            const Simd::Float4 rhs1 = Simd::load(rhs[col * 4 + 1] + i);
+            const Simd::Float4 rhs2 = Simd::load(rhs[col * 4 + 2] + i);
+            const Simd::Float4 rhs3 = Simd::load(rhs[col * 4 + 3] + i);
+
+            for (uint8_t row = 0; row < 4; ++row) {
+                values[col * 4 + row] = Simd::madd(
+                    Simd::load(lhs[12 + row] + i), rhs3, Simd::madd(
+                    Simd::load(lhs[8 + row] + i), rhs2, Simd::madd(
+                    Simd::load(lhs[4 + row] + i), rhs1,
+                    Simd::mul(Simd::load(lhs[row] + i), rhs0)))
+                );
+            }
+        }
+
+        for (uint8_t component = 0; component < 16; ++component) {
+            Simd::store(result[component] + i, values[component]);
+        }
+    }
+
+    for (; i < count; ++i) {
+        setMatrix(result, i, getMatrix(lhs, i) * getMatrix(rhs, i));
+    }
+}
+
+namespace {
+
+struct Vec3x4 {
+    Simd::Float4 x;
+    Simd::Float4 y;
+    Simd::Float4 z;
+};
+
+inline Vec3x4 load(const Vec3SoA<const float>& vectors, size_t index) {
+    return {Simd::load(vectors[0] + index), Simd::load(vectors[1] + index), Simd::load(vectors[2] + index)};
+}
+
+inline Simd::Float4 dot(const Vec3x4& lhs, const Vec3x4& rhs) {
+    return Simd::madd(lhs.z, rhs.z, Simd::madd(lhs.y, rhs.y, Simd::mul(lhs.x, rhs.x)));
+}
+
+inline Vec3x4 cross(const Vec3x4& lhs, const Vec3x4& rhs) {
+    return {
+        Simd::sub(Simd::mul(lhs.y, rhs.z), Simd::mul(lhs.z, rhs.y)),
+        Simd::sub(Simd::mul(lhs.z, rhs.x), Simd::mul(lhs.x, rhs.z)),
+        Simd::sub(Simd::mul(lhs.x, rhs.y), Simd::mul(lhs.y, rhs.x))
+    };
+}
+
+inline Vec3x4 normalize(const Vec3x4& vector) {
+    const Simd::Float4 length = Simd::sqrt(dot(vector, vector));
+    return {Simd::div(vector.x, length), Simd::div(vector.y, length), Simd::div(vector.z, length)};
+}
+
+}
+
+void lookAt(
+    const Vec3SoA<const float>& eyes,
+    const Vec3SoA<const float>& centers,
+    const Vec3SoA<const float>& ups,
+    const Mat4x4SoA<float>& result,
+    size_t count
+) {
+    const Simd::Float4 zero = Simd::zero();
+    const Simd::Float4 one = Simd::splat(1.0f);
+
+    size_t i = 0;
+    for (; i + Simd::Width <= count; i += Simd::Width) {
+        const Vec3x4 eye = load(eyes, i);
+        const Vec3x4 center = load(centers, i);
+
+        const Vec3x4 direction = normalize({Simd::sub(eye.x, center.x), Simd::sub(eye.y, center.y), Simd::sub(eye.z, center.z)});
+        const Vec3x4 right = normalize(cross(load(ups, i), direction));
+        const Vec3x4 up = cross(direction, right);
+
+        const Simd::Float4 values[16] = {
+            right.x, up.x, direction.x, zero,
+            right.y, up.y, direction.y, zero,
+            right.z, up.z, direction.z, zero,
+            Simd::sub(zero, dot(right, eye)), Simd::sub(zero, dot(up, eye)), Simd::sub(zero, dot(direction, eye)), one
+        };
+
+        for (uint8_t component = 0; component < 16; ++component) {
+            Simd::store(result[component] + i, values[component]);
+        }
+    }
+
+    for (; i < count; ++i) {
+        setMatrix(result, i, Geometry::lookAt(getVector(eyes, i), getVector(centers, i), getVector(ups, i)));
+    }
+}
+
+void perspective(
+    const float* fovys,
+    const float* aspects,
+    const float* zNears,
+    const float* zFars,
+    const Mat4x4SoA<float>& result,
+    size_t count
+) {
+    const Simd::Float4 zero = Simd::zero();
+    const Simd::Float4 one = Simd::splat(1.0f);
+    const Simd::Float4 minusOne = Simd::splat(-1.0f);
+
+    size_t i = 0;
+    for (; i + Simd::Width <= count; i += Simd::Width) {
+        // No vectorized tangent
+        float tanHalfFovys[Simd::Width];
+        for (size_t lane = 0; lane < Simd::Width; ++lane) {
+            tanHalfFovys[lane] = Geometry::tan(fovys[i + lane] / 2.0f);
+        }
+
+        const Simd::Float4 tanHalfFovy = Simd::load(tanHalfFovys);
+        const Simd::Float4 zNear = Simd::load(zNears + i);
+        const Simd::Float4 zFar = Simd::load(zFars + i);
+
+        const Simd::Float4 values[16] = {
+            Simd::div(one, Simd::mul(Simd::load(aspects + i), tanHalfFovy)), zero, zero, zero,
+            zero, Simd::div(one, tanHalfFovy), zero, zero,
+            zero, zero, Simd::div(zFar, Simd::sub(zNear, zFar)), minusOne,
+            zero, zero, Simd::div(Simd::mul(zFar, zNear), Simd::sub(zNear, zFar)), zero
+        };
+
+        for (uint8_t component = 0; component < 16; ++component) {
+            Simd::store(result[component] + i, values[component]);
+        }
+    }
+
+    for (; i < count; ++i) {
+        setMatrix(result, i, Geometry::perspective(fovys[i], aspects[i], zNears[i], zFars[i]));
+    }
+}
+
+void normalize(const QuatSoA<const float>& quaternions, const QuatSoA<float>& result, size_t count) {
+    size_t i = 0;
+    for (; i + Simd::Width <= count; i += Simd::Width) {
+        const Simd::Float4 w = Simd::load(quaternions[0] + i);
+        const Simd::Float4 x = Simd::load(quaternions[1] + i);
+        const Simd::Float4 y = Simd::load(quaternions[2] + i);
+        const Simd::Float4 z = Simd::load(quaternions[3] + i);
+
+        const Simd::Float4 length = Simd::sqrt(Simd::madd(z, z, Simd::madd(y, y, Simd::madd(x, x, Simd::mul(w, w)))));
+
+        Simd::store(result[0] + i, Simd::div(w, length));
+        Simd::store(result[1] + i, Simd::div(x, length));
+        Simd::store(result[2] + i, Simd::div(y, length));
+        Simd::store(result[3] + i, Simd::div(z, length));
+    }
+
+    for (; i < count; ++i) {
+        setQuaternion(result, i, ::lug::Math::normalize(getQuaternion(quaternions, i)));
+    }
+}
+
+} // Batch
+} // Math
+} // lug
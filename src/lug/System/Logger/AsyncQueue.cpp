@@ -0,0 +1,278 @@
+#include <lug/System/Logger/AsyncQueue.hpp>
+#include <cstring>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+constexpr size_t AsyncQueue::InlineSize;
+
+namespace {
+
+size_t getPowerOfTwo(size_t value) {
+    size_t result = 2;
+
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+} // anonymous
+
+AsyncQueue::AsyncQueue(size_t capacity, OverflowPolicy policy) :
+    _cells{new Cell[getPowerOfTwo(capacity)]}, _mask{getPowerOfTwo(capacity) - 1}, _policy{policy} {
+    static_assert(sizeof(Cell) == 256, "The cells should fill whole cache lines");
+
+    for (size_t i = 0; i <= _mask; ++i) {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    _thread = std::thread(&AsyncQueue::run, this);
+}
+
+AsyncQueue::~AsyncQueue() {
+    _running.store(false);
+    wakeUp();
+
+    _thread.join();
+}
+
+bool AsyncQueue::push(Logger& logger, Level level, const char* text, size_t size) {
+    Record record;
+    record.logger = &logger;
+    record.time = std::chrono::system_clock::now();
+    record.size = static_cast<uint32_t>(size);
+    record.level = level;
+    record.flush = false;
+
+    // Allocated before taking a cell, so the consumer doesn't wait on it
+    record.longText = nullptr;
+    if (size > InlineSize) {
+        record.longText = new char[size];
+        std::memcpy(record.longText, text, size);
+    }
+
+    return push(record, text);
+}
+
+bool AsyncQueue::pushFlush(Logger& logger) {
+    Record record;
+    record.logger = &logger;
+    record.longText = nullptr;
+    record.size = 0;
+    record.flush = true;
+
+    return push(record, nullptr);
+}
+
+void AsyncQueue::wait() {
+    const size_t target = _positions.push.load();
+
+    while (_positions.handled.load(std::memory_order_acquire) < target) {
+        wakeUp();
+        std::this_thread::yield();
+    }
+}
+
+size_t AsyncQueue::getCapacity() const {
+    return _mask + 1;
+}
+
+OverflowPolicy AsyncQueue::getOverflowPolicy() const {
+    return _policy;
+}
+
+uint64_t AsyncQueue::getDroppedCount() const {
+    return _droppedCount.load(std::memory_order_relaxed);
+}
+
+bool AsyncQueue::push(const Record& record, const char* text) {
+    while (!tryPush(record, text)) {
+        switch (_policy) {
+            case OverflowPolicy::Block:
+                // A handler logging from the background thread, nobody else would make room
+                if (std::this_thread::get_id() == _thread.get_id()) {
+                    dispatch(record, record.longText ? record.longText : text);
+                    delete[] record.longText;
+                    return true;
+                }
+
+                wakeUp();
+                std::this_thread::yield();
+                break;
+
+            case OverflowPolicy::Drop:
+                delete[] record.longText;
+                _droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+
+            case OverflowPolicy::Overwrite: {
+                // The queue is safe with multiple consumers, pop the oldest message in place of the background thread
+                Record oldest;
+
+                if (tryPop(oldest)) {
+                    delete[] oldest.longText;
+                    _droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    _positions.handled.fetch_add(1, std::memory_order_release);
+                }
+                break;
+            }
+        }
+    }
+
+    // Pairs with the fence of `run`: either we see `_sleeping` or the background thread sees the message
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_sleeping.load(std::memory_order_relaxed)) {
+        wakeUp();
+    }
+
+    return true;
+}
+
+// Bounded queue of Dmitry Vyukov: the sequence of a cell tells if it's ready to be written (== position)
+// or to be read (== position + 1) for the current lap
+bool AsyncQueue::tryPush(const Record& record, const char* text) {
+    size_t position = _positions.push.load(std::memory_order_relaxed);
+    Cell* cell;
+
+    while (true) {
+        cell = &_cells[position & _mask];
+        const intptr_t diff = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position);
+
+        if (diff == 0) {
+            if (_positions.push.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Full
+            return false;
+        } else {
+            position = _positions.push.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record& target = cell->record;
+    target.logger = record.logger;
+    target.time = record.time;
+    target.longText = record.longText;
+    target.size = record.size;
+    target.level = record.level;
+    target.flush = record.flush;
+
+    // Only the used part of the text
+    if (!record.longText && record.size) {
+        std::memcpy(target.text, text, record.size);
+    }
+
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncQueue::tryPop(Record& record) {
+    size_t position = _positions.pop.load(std::memory_order_relaxed);
+    Cell* cell;
+
+    while (true) {
+        cell = &_cells[position & _mask];
+        const intptr_t diff = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position + 1);
+
+        if (diff == 0) {
+            if (_positions.pop.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Empty
+            return false;
+        } else {
+            position = _positions.pop.load(std::memory_order_relaxed);
+        }
+    }
+
+    const Record& source = cell->record;
+    record.logger = source.logger;
+    record.time = source.time;
+    record.longText = source.longText;
+    record.size = source.size;
+    record.level = source.level;
+    record.flush = source.flush;
+
+    if (!source.longText && source.size) {
+        std::memcpy(record.text, source.text, source.size);
+    }
+
+    // Ready to be written on the next lap
+    cell->sequence.store(position + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncQueue::isEmpty() const {
+    const size_t position = _positions.pop.load(std::memory_order_relaxed);
+    return _cells[position & _mask].sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+void AsyncQueue::wakeUp() {
+    {
+        // The background thread is either not sleeping yet or waiting on the condition
+        std::lock_guard<std::mutex> lock(_mutex);
+    }
+
+    _condition.notify_one();
+}
+
+void AsyncQueue::run() {
+    Record record;
+
+    while (true) {
+        if (tryPop(record)) {
+            handle(record);
+            continue;
+        }
+
+        // Everything pushed before the destruction is handled
+        if (!_running.load()) {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        // The producers check `_sleeping` after pushing, one of us sees the other
+        // The queue is checked again under the mutex, `wakeUp` can't notify between the check and the wait
+        _sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        _condition.wait(lock, [this]() { return !isEmpty() || !_running.load(); });
+
+        _sleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+void AsyncQueue::handle(Record& record) {
+    dispatch(record, record.longText ? record.longText : record.text);
+
+    delete[] record.longText;
+    _positions.handled.fetch_add(1, std::memory_order_release);
+}
+
+void AsyncQueue::dispatch(const Record& record, const char* text) {
+    try {
+        if (record.flush) {
+            record.logger->flushHandlers();
+        } else {
+            priv::Message msg(record.logger->getName(), record.level, record.time);
+            msg.raw << fmt::StringRef(text, record.size);
+
+            record.logger->handle(msg);
+        }
+    } catch (const std::exception&) {
+        // Logging the error from here could wait on the queue forever
+    }
+}
+
+} // Logger
+} // System
+} // lug
@@ -0,0 +1,250 @@
+#include <lug/System/Logger/BinaryDecoder.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <lug/System/Logger/Message.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+bool BinaryDecoder::open(const std::string& filename) {
+    _data.clear();
+    _strings.clear();
+
+    std::ifstream file(filename, std::ifstream::in | std::ifstream::binary);
+    std::ifstream table(filename + priv::BinaryFormat::TableExtension, std::ifstream::in | std::ifstream::binary);
+
+    if (!file.good() || !table.good()) {
+        return false;
+    }
+
+    _data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    priv::BinaryFormat::FileHeader header;
+
+    if (_data.size() < sizeof(header)) {
+        _data.clear();
+        return false;
+    }
+
+    std::memcpy(&header, _data.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, priv::BinaryFormat::Magic, sizeof(header.magic)) != 0
+        || header.version != priv::BinaryFormat::Version
+        || header.headerSize < sizeof(header)) {
+        _data.clear();
+        return false;
+    }
+
+    // The file keeps its whole capacity if the handler wasn't destroyed
+    _data.resize(static_cast<size_t>(std::min<uint64_t>(header.size, _data.size())));
+
+    uint32_t id;
+    uint32_t size;
+
+    while (table.read(reinterpret_cast<char*>(&id), sizeof(id)) && table.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+        std::string string(size, '\0');
+
+        if (!table.read(&string[0], size)) {
+            break;
+        }
+
+        _strings[id] = std::move(string);
+    }
+
+    return true;
+}
+
+size_t BinaryDecoder::decode(Handler& handler) const {
+    if (_data.empty()) {
+        return 0;
+    }
+
+    priv::BinaryFormat::FileHeader fileHeader;
+    std::memcpy(&fileHeader, _data.data(), sizeof(fileHeader));
+
+    const char* data = _data.data() + fileHeader.headerSize;
+    const char* const end = _data.data() + _data.size();
+
+    std::vector<Arg> args;
+    size_t count = 0;
+
+    while (data + sizeof(priv::BinaryFormat::RecordHeader) <= end) {
+        priv::BinaryFormat::RecordHeader header;
+        std::memcpy(&header, data, sizeof(header));
+
+        const char* const next = data + header.size;
+        const std::string* const format = getString(header.formatId);
+        const std::string* const loggerName = getString(header.loggerId);
+
+        if (header.size < sizeof(header) || next > end || !format || !loggerName) {
+            break;
+        }
+
+        const Level level = static_cast<Level>(header.level);
+
+        if (handler.shouldLog(level)) {
+            if (!readArgs(data + sizeof(header), next, header.argCount, args)) {
+                break;
+            }
+
+            const auto time = std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.time))
+            );
+
+            priv::Message msg(*loggerName, level, time);
+
+            // The format strings fmt accepts but this parser doesn't (e.g. nested fields) are written as is
+            bool written;
+
+            try {
+                written = writeText(msg.raw, *format, args);
+            } catch (const std::exception&) {
+                written = false;
+            }
+
+            if (!written) {
+                msg.raw.clear();
+                msg.raw << *format;
+            }
+
+            handler.format(msg);
+            handler.handle(msg);
+            ++count;
+        }
+
+        data = next;
+    }
+
+    return count;
+}
+
+bool BinaryDecoder::readArgs(const char* data, const char* end, uint8_t count, std::vector<Arg>& args) const {
+    args.resize(count);
+
+    for (Arg& arg : args) {
+        if (data >= end) {
+            return false;
+        }
+
+        arg.type = static_cast<priv::BinaryFormat::ArgType>(*data++);
+
+        size_t size;
+
+        switch (arg.type) {
+            case priv::BinaryFormat::ArgType::Bool: size = sizeof(arg.b); break;
+            case priv::BinaryFormat::ArgType::Char: size = sizeof(arg.c); break;
+            case priv::BinaryFormat::ArgType::Int: size = sizeof(arg.i); break;
+            case priv::BinaryFormat::ArgType::UInt: size = sizeof(arg.u); break;
+            case priv::BinaryFormat::ArgType::Float: size = sizeof(arg.f); break;
+            case priv::BinaryFormat::ArgType::Double: size = sizeof(arg.d); break;
+            case priv::BinaryFormat::ArgType::String: size = sizeof(arg.stringSize); break;
+            case priv::BinaryFormat::ArgType::Pointer: size = sizeof(arg.u); break;
+            default: return false;
+        }
+
+        if (data + size > end) {
+            return false;
+        }
+
+        if (arg.type == priv::BinaryFormat::ArgType::String) {
+            std::memcpy(&arg.stringSize, data, size);
+            data += size;
+
+            if (data + arg.stringSize > end) {
+                return false;
+            }
+
+            arg.string = data;
+            data += arg.stringSize;
+        } else {
+            // All the members of the union start at its address
+            std::memcpy(&arg.u, data, size);
+            data += size;
+        }
+    }
+
+    return true;
+}
+
+bool BinaryDecoder::writeText(fmt::MemoryWriter& out, const std::string& format, const std::vector<Arg>& args) const {
+    size_t nextIndex = 0;
+    size_t i = 0;
+
+    while (i < format.size()) {
+        const size_t brace = format.find_first_of("{}", i);
+
+        if (brace == std::string::npos) {
+            out << fmt::StringRef(format.data() + i, format.size() - i);
+            break;
+        }
+
+        out << fmt::StringRef(format.data() + i, brace - i);
+
+        // Escaped brace
+        if (brace + 1 < format.size() && format[brace + 1] == format[brace]) {
+            out << format[brace];
+            i = brace + 2;
+            continue;
+        }
+
+        if (format[brace] == '}') {
+            return false;
+        }
+
+        const size_t close = format.find('}', brace);
+
+        if (close == std::string::npos) {
+            return false;
+        }
+
+        // {[index][:spec]}
+        const std::string field = format.substr(brace + 1, close - brace - 1);
+        const size_t colon = field.find(':');
+        const std::string index = field.substr(0, colon);
+        const std::string spec = colon == std::string::npos ? std::string() : field.substr(colon + 1);
+
+        if (spec.find('{') != std::string::npos
+            || !std::all_of(index.begin(), index.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; })) {
+            return false;
+        }
+
+        const size_t argIndex = index.empty() ? nextIndex++ : static_cast<size_t>(std::stoul(index));
+
+        if (argIndex >= args.size()) {
+            return false;
+        }
+
+        writeArg(out, spec, args[argIndex]);
+        i = close + 1;
+    }
+
+    return true;
+}
+
+const std::string* BinaryDecoder::getString(uint32_t id) const {
+    const auto it = _strings.find(id);
+    return it == _strings.end() ? nullptr : &it->second;
+}
+
+void BinaryDecoder::writeArg(fmt::MemoryWriter& out, const std::string& spec, const Arg& arg) {
+    const std::string format = spec.empty() ? std::string("{}") : "{:" + spec + "}";
+
+    switch (arg.type) {
+        case priv::BinaryFormat::ArgType::Bool: out.write(format, arg.b); break;
+        case priv::BinaryFormat::ArgType::Char: out.write(format, arg.c); break;
+        case priv::BinaryFormat::ArgType::Int: out.write(format, arg.i); break;
+        case priv::BinaryFormat::ArgType::UInt: out.write(format, arg.u); break;
+        case priv::BinaryFormat::ArgType::Float: out.write(format, arg.f); break;
+        case priv::BinaryFormat::ArgType::Double: out.write(format, arg.d); break;
+        case priv::BinaryFormat::ArgType::String: out.write(format, fmt::StringRef(arg.string, arg.stringSize)); break;
+        case priv::BinaryFormat::ArgType::Pointer: out.write(spec.empty() ? std::string("0x{:x}") : format, arg.u); break;
+    }
+}
+
+} // Logger
+} // System
+} // lug
@@ -0,0 +1,250 @@
+#include <lug/System/Logger/BinaryHandler.hpp>
+#include <cstring>
+#include <iostream>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Exception.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+constexpr size_t BinaryHandler::DefaultCapacity;
+
+BinaryHandler::BinaryHandler(const std::string& name, const std::string& filename, size_t capacity) :
+    Handler(name), _filename(filename), _capacity(capacity) {
+    _binary = true;
+
+    LUG_ASSERT(capacity > sizeof(priv::BinaryFormat::FileHeader), "The capacity must hold the header");
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    _file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (_file != INVALID_HANDLE_VALUE) {
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(uint64_t(capacity) >> 32), static_cast<DWORD>(capacity), nullptr);
+    }
+
+    if (_mapping) {
+        _data = static_cast<char*>(MapViewOfFile(_mapping, FILE_MAP_WRITE, 0, 0, capacity));
+    }
+#else
+    _file = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (_file >= 0 && ftruncate(_file, static_cast<off_t>(capacity)) == 0) {
+        void* const data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+        _data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+    }
+#endif
+
+    _table.open(filename + priv::BinaryFormat::TableExtension, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (!_data || !_table.good()) {
+        // The destructor isn't called
+        release(0);
+        LUG_EXCEPT(FileNotFoundException, "Failed to map the binary log file");
+    }
+
+    priv::BinaryFormat::FileHeader header;
+    std::memcpy(header.magic, priv::BinaryFormat::Magic, sizeof(header.magic));
+    header.version = priv::BinaryFormat::Version;
+    header.headerSize = sizeof(header);
+    header.size = sizeof(header);
+
+    std::memcpy(_data, &header, sizeof(header));
+    _size.store(sizeof(header));
+    _writtenSize.store(sizeof(header));
+}
+
+BinaryHandler::~BinaryHandler() {
+    const size_t size = _size.load();
+
+    // The size used is in the header even if the file can't be truncated
+    reinterpret_cast<priv::BinaryFormat::FileHeader*>(_data)->size = size;
+
+    release(size);
+}
+
+void BinaryHandler::handle(const priv::Message& msg) {
+    // Same layout as a message logged with the format "{}"
+    const std::string text = msg.raw.str();
+    const std::tuple<const std::string&> args(text);
+
+    handleBinary({
+        msg.loggerName,
+        msg.level,
+        msg.time,
+        "{}",
+        2,
+        1,
+        priv::getArgSize(text),
+        &priv::encodeTuple<std::tuple<const std::string&>>,
+        &args
+    });
+}
+
+void BinaryHandler::handleBinary(const priv::BinaryMessage& msg) {
+    uint32_t formatId;
+    uint32_t loggerId;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        formatId = getStringId(msg.format, msg.formatSize);
+        loggerId = getStringId(msg.loggerName.data(), msg.loggerName.size());
+    }
+
+    // The records start on 8 bytes
+    const size_t size = (sizeof(priv::BinaryFormat::RecordHeader) + msg.argsSize + 7) & ~size_t(7);
+    char* const record = reserve(size);
+
+    if (!record) {
+        _droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    priv::BinaryFormat::RecordHeader header;
+    header.size = static_cast<uint32_t>(size);
+    header.formatId = formatId;
+    header.loggerId = loggerId;
+    header.level = static_cast<uint8_t>(msg.level);
+    header.argCount = msg.argCount;
+    header.padding = 0;
+    header.time = std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count();
+
+    std::memcpy(record, &header, sizeof(header));
+    msg.encodeArgs(msg.args, record + sizeof(header));
+
+    // The header of the file tells how much of it is valid, even if the process doesn't exit cleanly
+    // It is only updated when no record is being written before `writtenSize`, the destructor writes the final size
+    const size_t writtenSize = _writtenSize.fetch_add(size) + size;
+
+    if (writtenSize == _size.load()) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        priv::BinaryFormat::FileHeader* const fileHeader = reinterpret_cast<priv::BinaryFormat::FileHeader*>(_data);
+
+        if (fileHeader->size < writtenSize) {
+            fileHeader->size = writtenSize;
+        }
+    }
+}
+
+void BinaryHandler::flush() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _table.flush();
+    }
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    FlushViewOfFile(_data, _size.load());
+#else
+    msync(_data, _size.load(), MS_ASYNC);
+#endif
+}
+
+size_t BinaryHandler::getSize() const {
+    return _size.load();
+}
+
+size_t BinaryHandler::getCapacity() const {
+    return _capacity;
+}
+
+uint64_t BinaryHandler::getDroppedCount() const {
+    return _droppedCount.load(std::memory_order_relaxed);
+}
+
+uint32_t BinaryHandler::getStringId(const char* string, size_t size) {
+    // Fast path, the format strings are mostly literals
+    const auto it = _idsByAddress.find(string);
+
+    if (it != _idsByAddress.end()) {
+        const std::string& known = *_strings[it->second];
+
+        if (known.size() == size && std::memcmp(known.data(), string, size) == 0) {
+            return it->second;
+        }
+    }
+
+    std::string content(string, size);
+    auto contentIt = _ids.find(content);
+
+    if (contentIt == _ids.end()) {
+        const uint32_t id = static_cast<uint32_t>(_strings.size());
+        const uint32_t stringSize = static_cast<uint32_t>(size);
+
+        // The nodes of `_ids` don't move
+        contentIt = _ids.emplace(std::move(content), id).first;
+        _strings.push_back(&contentIt->first);
+
+        // Written right away, so the table is complete if the process doesn't exit cleanly
+        _table.write(reinterpret_cast<const char*>(&id), sizeof(id));
+        _table.write(reinterpret_cast<const char*>(&stringSize), sizeof(stringSize));
+        _table.write(string, size);
+        _table.flush();
+    }
+
+    _idsByAddress[string] = contentIt->second;
+    return contentIt->second;
+}
+
+char* BinaryHandler::reserve(size_t size) {
+    size_t used = _size.load(std::memory_order_relaxed);
+
+    do {
+        if (used + size > _capacity) {
+            return nullptr;
+        }
+    } while (!_size.compare_exchange_weak(used, used + size, std::memory_order_relaxed));
+
+    return _data + used;
+}
+
+void BinaryHandler::release(size_t size) {
+    bool truncated = true;
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+
+    if (_mapping) {
+        CloseHandle(_mapping);
+    }
+
+    if (_file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER fileSize;
+        fileSize.QuadPart = static_cast<LONGLONG>(size);
+
+        truncated = SetFilePointerEx(_file, fileSize, nullptr, FILE_BEGIN) && SetEndOfFile(_file);
+        CloseHandle(_file);
+    }
+#else
+    if (_data) {
+        munmap(_data, _capacity);
+    }
+
+    if (_file >= 0) {
+        truncated = ftruncate(_file, static_cast<off_t>(size)) == 0;
+        close(_file);
+    }
+#endif
+
+    _data = nullptr;
+
+    // The file keeps its capacity, zeroed after the size given by the header
+    if (!truncated) {
+        std::cerr << "Failed to truncate the binary log file " << _filename << std::endl;
+    }
+}
+
+} // Logger
+} // System
+} // lug
@@ -1,137 +1,124 @@
 #include <lug/System/Logger/Formatter.hpp>
 #include <algorithm>
-#include <iomanip>
-#include <sstream>
+#include <cctype>
 #include <lug/System/Logger/Message.hpp>
 
 namespace lug {
 namespace System {
 namespace Logger {
-namespace priv {
 
-std::string UserChars::format(Message*) const {
-    return _chars;
-}
-
-void UserChars::addChar(char c) {
-    _chars += c;
-}
+namespace {
 
-std::string LevelFlag::format(Message* message) const {
-    if (!message) {
-        return "NoMsg!";
+void writeDigits(char* out, int value, size_t count) {
+    for (size_t i = count; i > 0; --i) {
+        out[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
     }
-
-    std::stringstream ss;
-    ss << std::left << std::setfill(' ') << std::setw(7) << message->level;
-    std::string tmp(ss.str());
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), [](char c) {
-        return static_cast<char>(toupper(c));
-    });
-    return tmp;
 }
 
-std::string MessageFlag::format(Message* message) const {
-    if (!message) {
-        return "NoMsg!";
+// Same output as `std::put_time` for these flags, returns the number of characters written
+uint32_t renderTime(char flag, const std::tm* now, char* out) {
+    switch (flag) {
+        case 'y':
+            writeDigits(out, now->tm_year % 100, 2);
+            return 2;
+        case 'Y':
+            writeDigits(out, now->tm_year + 1900, 4);
+            return 4;
+        case 'm':
+            writeDigits(out, now->tm_mon + 1, 2);
+            return 2;
+        case 'd':
+            writeDigits(out, now->tm_mday, 2);
+            return 2;
+        case 'H':
+            writeDigits(out, now->tm_hour, 2);
+            return 2;
+        case 'M':
+            writeDigits(out, now->tm_min, 2);
+            return 2;
+        case 'S':
+            writeDigits(out, now->tm_sec, 2);
+            return 2;
     }
 
-    return message->raw.str();
+    return 0;
 }
 
-} // namespace priv
+// The conversion to local time is the slow part, it is cached for the current second
+// The cache is per thread so the formatters stay read-only while formatting
+const std::tm* getLocalTime(std::time_t time) {
+    static thread_local std::time_t cachedTime = -1;
+    static thread_local std::tm cachedLocalTime;
 
-std::string Formatter::handleFlagy(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%y");
-    return ss.str();
-}
+    if (time != cachedTime) {
+#if defined(LUG_SYSTEM_WINDOWS)
+        // Use windows secure versions of localtime
+        localtime_s(&cachedLocalTime, &time);
+#else
+        // Use linux secure versions of localtime
+        // TODO: test on android
+        // It could not work (what is the localtime secure version for android ?)
+        localtime_r(&time, &cachedLocalTime);
+#endif
 
-std::string Formatter::handleFlagY(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%Y");
-    return ss.str();
-}
+        cachedTime = time;
+    }
 
-std::string Formatter::handleFlagm(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%m");
-    return ss.str();
+    return &cachedLocalTime;
 }
 
-std::string Formatter::handleFlagd(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%d");
-    return ss.str();
-}
+size_t getLevelIndex(uint8_t level) {
+    // Only one bit set
+    if (!level || (level & (level - 1))) {
+        return 8;
+    }
 
-std::string Formatter::handleFlagH(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%H");
-    return ss.str();
-}
+    size_t index = 0;
+    while (!(level & 1)) {
+        level >>= 1;
+        ++index;
+    }
 
-std::string Formatter::handleFlagM(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%M");
-    return ss.str();
+    return index;
 }
 
-std::string Formatter::handleFlagS(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%S");
-    return ss.str();
-}
+} // anonymous
 
 inline void Formatter::handleFlag(char flag) {
     priv::Token token;
 
     switch (flag) {
         case 'y':
-            token.basic = &Formatter::handleFlagy;
-            break;
         case 'Y':
-            token.basic = &Formatter::handleFlagY;
-            break;
         case 'm':
-            token.basic = &Formatter::handleFlagm;
-            break;
         case 'd':
-            token.basic = &Formatter::handleFlagd;
-            break;
         case 'H':
-            token.basic = &Formatter::handleFlagH;
-            break;
         case 'M':
-            token.basic = &Formatter::handleFlagM;
-            break;
         case 'S':
-            token.basic = &Formatter::handleFlagS;
+            token.type = priv::Token::Type::Time;
+            token.flag = flag;
+            _hasTime = true;
             break;
         case 'v':
-            token.advanced = std::make_unique<priv::MessageFlag>();
+            token.type = priv::Token::Type::Message;
             break;
         case 'l':
-            token.advanced = std::make_unique<priv::LevelFlag>();
+            token.type = priv::Token::Type::Level;
             break;
+        default:
+            // Unknown flags are ignored
+            return;
     }
 
-    _formatChain.push_back(std::move(token));
+    _formatChain.push_back(token);
 }
 
 inline void Formatter::compilePattern(const std::string& pattern) {
-    std::unique_ptr<priv::UserChars> chars;
-
     auto end = pattern.end();
 
     for (auto it = pattern.begin(); it != end; ++it) {
         if (*it == '%') {
-            if (chars) {
-                // Append raw chars found so far
-                _formatChain.push_back(priv::Token(std::move(chars)));
-                chars = nullptr;
-            }
-
             if (++it != end) {
                 handleFlag(*it);
             } else {
@@ -139,52 +126,83 @@ inline void Formatter::compilePattern(const std::string& pattern) {
             }
         } else {
             // Chars not following the % sign should be displayed as is
-            if (!chars) {
-                chars = std::make_unique<priv::UserChars>();
+            if (_formatChain.empty() || _formatChain.back().type != priv::Token::Type::Chars) {
+                priv::Token token;
+                token.start = static_cast<uint32_t>(_chars.size());
+                _formatChain.push_back(token);
             }
 
-            chars->addChar(*it);
+            _chars += *it;
+            ++_formatChain.back().size;
         }
     }
+}
+
+void Formatter::setLevelName(uint8_t level, const char* name) {
+    std::string& levelName = _levelNames[getLevelIndex(level)];
 
-    if (chars) {
-        // Append raw chars found so far
-        _formatChain.push_back(priv::Token(std::move(chars)));
+    levelName = name;
+    std::transform(levelName.begin(), levelName.end(), levelName.begin(), [](char c) {
+        return static_cast<char>(toupper(c));
+    });
+
+    if (levelName.size() < 7) {
+        levelName.resize(7, ' ');
     }
 }
 
+const std::string& Formatter::getLevelName(uint8_t level) const {
+    return _levelNames[getLevelIndex(level)];
+}
+
 Formatter::Formatter(const std::string& pattern) {
     compilePattern(pattern);
+
+    setLevelName(0, "Unknown");
+
+#define LUG_LOG_NAME(CHANNEL, VALUE) setLevelName(VALUE, #CHANNEL);
+    LUG_LOG_LEVELS(LUG_LOG_NAME)
+#undef LUG_LOG_NAME
 }
 
 Formatter::~Formatter() = default;
 
 void Formatter::format(priv::Message& msg) {
-    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-    std::time_t tt = std::chrono::system_clock::to_time_t(now);
-    std::tm tf;
-
-#if defined(LUG_SYSTEM_WINDOWS)
-    // Use windows secure versions of localtime
-    localtime_s(&tf, &tt);
-#else
-    // Use linux secure versions of localtime
-    // TODO: test on android
-    // It could not work (what is the localtime secure version for android ?)
-    localtime_r(&tt, &tf);
-#endif
-
-    format(msg, &tf);
+    if (_hasTime) {
+        write(msg, getLocalTime(std::chrono::system_clock::to_time_t(msg.time)));
+    } else {
+        write(msg, nullptr);
+    }
 }
 
 void Formatter::format(priv::Message& msg, const std::tm* now) {
+    write(msg, now);
+}
+
+void Formatter::write(priv::Message& msg, const std::tm* now) const {
     msg.formatted.clear();
 
-    for (priv::Token& elem : _formatChain) {
-        if (elem.basic) {
-            msg.formatted << (this->*elem.basic)(now);
-        } else if (elem.advanced) {
-            msg.formatted << elem.advanced->format(&msg);
+    for (const priv::Token& token : _formatChain) {
+        switch (token.type) {
+            case priv::Token::Type::Chars:
+                msg.formatted << fmt::StringRef(_chars.data() + token.start, token.size);
+                break;
+
+            case priv::Token::Type::Time: {
+                char text[4];
+                msg.formatted << fmt::StringRef(text, renderTime(token.flag, now, text));
+                break;
+            }
+
+            case priv::Token::Type::Level: {
+                const std::string& name = getLevelName(static_cast<uint8_t>(msg.level));
+                msg.formatted << fmt::StringRef(name.data(), name.size());
+                break;
+            }
+
+            case priv::Token::Type::Message:
+                msg.formatted << fmt::StringRef(msg.raw.data(), msg.raw.size());
+                break;
         }
     }
 }
@@ -6,10 +6,17 @@ namespace lug {
 namespace System {
 namespace Logger {
 
+#define LUG_LOG_MASK(CHANNEL, VALUE) | VALUE
+constexpr uint8_t allLevels = 0 LUG_LOG_LEVELS(LUG_LOG_MASK);
+#undef LUG_LOG_MASK
+
+std::atomic<uint32_t> Handler::_levelsGeneration{0};
+
+// `_levels` is a mask, all the levels are handled by default
 Handler::Handler(const std::string& name) :
     _name(name),
     _formatter(std::make_unique<Formatter>("[%H:%M:%S][%l] %v\n")),
-    _levels(Level::Debug) {}
+    _levels(static_cast<Level>(allLevels)) {}
 
 void Handler::setFormatter(std::unique_ptr<Formatter> formatter) {
     _formatter = std::move(formatter);
@@ -25,12 +32,17 @@ void Handler::format(priv::Message& msg) {
 
 void Handler::setLevels(Level levels) {
     _levels = levels;
+    _levelsGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 Level Handler::getLevels() const {
     return _levels;
 }
 
+void Handler::handleBinary(const priv::BinaryMessage&) {
+    // Only called on the binary handlers
+}
+
 bool Handler::shouldLog(Level level) const {
     return ((uint8_t)level & (uint8_t)_levels);
 }
@@ -1,4 +1,5 @@
 #include <lug/System/Logger/Logger.hpp>
+#include <algorithm>
 #include <lug/System/Logger/Handler.hpp>
 
 namespace lug {
@@ -15,14 +16,50 @@ namespace Logger {
 
     #undef LUG_LOG_ENUM
 
-    Logger::Logger(const std::string& loggerName) : _name(loggerName) {}
+    Logger::Logger(const std::string& loggerName) : _name(loggerName) {
+        _handlersCopies.push_back(std::make_unique<std::vector<Handler*>>());
+        _handlers.store(_handlersCopies.back().get(), std::memory_order_release);
+
+        updateLevels();
+    }
+
+    Logger::Logger(Logger&& other) : _name(other._name), _handlersCopies(std::move(other._handlersCopies)), _asyncQueue(other._asyncQueue) {
+        _handlers.store(other._handlers.load(std::memory_order_acquire), std::memory_order_release);
+
+        other._handlersCopies.clear();
+        other._handlersCopies.push_back(std::make_unique<std::vector<Handler*>>());
+        other._handlers.store(other._handlersCopies.back().get(), std::memory_order_release);
+        other.updateLevels();
+
+        updateLevels();
+    }
 
     void Logger::addHandler(Handler* handler) {
-        _handlers.insert(handler);
+        const std::vector<Handler*>& handlers = getHandlers();
+
+        if (!handler || std::find(handlers.begin(), handlers.end(), handler) != handlers.end()) {
+            return;
+        }
+
+        std::unique_ptr<std::vector<Handler*>> copy = std::make_unique<std::vector<Handler*>>(handlers);
+        copy->push_back(handler);
+
+        _handlers.store(copy.get(), std::memory_order_release);
+        _handlersCopies.push_back(std::move(copy));
+
+        updateLevels();
     }
 
     void Logger::addHandler(const std::string& name) {
-        _handlers.insert(LoggingFacility::getHandler(name));
+        addHandler(LoggingFacility::getHandler(name));
+    }
+
+    void Logger::setAsyncQueue(AsyncQueue* queue) {
+        _asyncQueue = queue;
+    }
+
+    AsyncQueue* Logger::getAsyncQueue() const {
+        return _asyncQueue;
     }
 
     void Logger::defaultErrHandler(const std::string& msg) {
@@ -38,8 +75,8 @@ namespace Logger {
     }
 
     void Logger::handle(priv::Message& msg) {
-        for (auto& handler : _handlers) {
-            if (handler->shouldLog(msg.level)) {
+        for (Handler* handler : getHandlers()) {
+            if (!handler->isBinary() && handler->shouldLog(msg.level)) {
                 handler->format(msg);
                 handler->handle(msg);
             }
@@ -47,7 +84,36 @@ namespace Logger {
     }
 
     void Logger::flush() {
-        for (auto& handler : _handlers) {
+        if (_asyncQueue) {
+            _asyncQueue->pushFlush(*this);
+            return;
+        }
+
+        flushHandlers();
+    }
+
+    void Logger::updateLevels() {
+        // Several threads may update the levels at the same time, they store the same values
+        const uint32_t generation = Handler::getLevelsGeneration();
+        uint8_t binaryLevels = 0;
+        uint8_t textLevels = 0;
+
+        for (Handler* handler : getHandlers()) {
+            if (handler->isBinary()) {
+                binaryLevels |= static_cast<uint8_t>(handler->getLevels());
+            } else {
+                textLevels |= static_cast<uint8_t>(handler->getLevels());
+            }
+        }
+
+        _binaryLevels.store(binaryLevels, std::memory_order_relaxed);
+        _textLevels.store(textLevels, std::memory_order_relaxed);
+        _levels.store(binaryLevels | textLevels, std::memory_order_relaxed);
+        _levelsGeneration.store(generation, std::memory_order_relaxed);
+    }
+
+    void Logger::flushHandlers() {
+        for (Handler* handler : getHandlers()) {
             handler->flush();
         }
     }
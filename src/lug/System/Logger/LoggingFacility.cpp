@@ -1,4 +1,7 @@
 #include <lug/System/Logger/LoggingFacility.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <lug/System/Logger/Logger.hpp>
 #include <lug/System/Logger/Handler.hpp>
 
@@ -6,28 +9,91 @@ namespace lug {
 namespace System {
 namespace Logger {
 
-static std::unordered_map<std::string, std::unique_ptr<Logger>> loggers{};
-static std::unordered_map<std::string, std::unique_ptr<Handler>> handlers{};
+namespace {
+
+// Never modified once published
+struct Registry {
+    std::unordered_map<std::string, Logger*> loggers;
+    std::unordered_map<std::string, Handler*> handlers;
+};
+
+// Protects everything except `current`
+std::mutex mutex;
+std::atomic<const Registry*> current{nullptr};
+
+// All the copies of the registry and all the objects registered, until `clear`
+std::vector<std::unique_ptr<const Registry>> registries;
+std::vector<std::unique_ptr<Logger>> loggers;
+std::vector<std::unique_ptr<Handler>> handlers;
+
+template <typename Function>
+void update(Function&& function) {
+    const Registry* registry = current.load(std::memory_order_relaxed);
+    std::unique_ptr<Registry> copy = registry ? std::make_unique<Registry>(*registry) : std::make_unique<Registry>();
+
+    function(*copy);
+
+    current.store(copy.get(), std::memory_order_release);
+    registries.push_back(std::move(copy));
+}
+
+}
+
+std::atomic<uint32_t> LoggingFacility::_generation{1};
 
 void LoggingFacility::registerLogger(const std::string& loggerName, std::unique_ptr<Logger> logger) {
-    loggers[loggerName] = std::move(logger);
+    std::lock_guard<std::mutex> lock(mutex);
+
+    update([&](Registry& registry) {
+        registry.loggers[loggerName] = logger.get();
+    });
+
+    loggers.push_back(std::move(logger));
+    _generation.fetch_add(1, std::memory_order_release);
 }
 
 Logger* LoggingFacility::getLogger(const std::string& loggerName) {
-    return loggers[loggerName].get();
+    const Registry* registry = current.load(std::memory_order_acquire);
+
+    if (!registry) {
+        return nullptr;
+    }
+
+    const auto it = registry->loggers.find(loggerName);
+    return it == registry->loggers.end() ? nullptr : it->second;
 }
 
 void LoggingFacility::registerHandler(const std::string& handlerName, std::unique_ptr<Handler> handler) {
-    handlers[handlerName] = std::move(handler);
+    std::lock_guard<std::mutex> lock(mutex);
+
+    update([&](Registry& registry) {
+        registry.handlers[handlerName] = handler.get();
+    });
+
+    handlers.push_back(std::move(handler));
+    _generation.fetch_add(1, std::memory_order_release);
 }
 
 Handler* LoggingFacility::getHandler(const std::string& handlerName) {
-    return handlers[handlerName].get();
+    const Registry* registry = current.load(std::memory_order_acquire);
+
+    if (!registry) {
+        return nullptr;
+    }
+
+    const auto it = registry->handlers.find(handlerName);
+    return it == registry->handlers.end() ? nullptr : it->second;
 }
 
 void LoggingFacility::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    current.store(nullptr, std::memory_order_release);
+    _generation.fetch_add(1, std::memory_order_release);
+
     handlers.clear();
     loggers.clear();
+    registries.clear();
 }
 
 } // Logger
@@ -0,0 +1,196 @@
+#include <lug/System/Logger/RotatingFileHandler.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <lug/System/Exception.hpp>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+RotatingFileHandler::RotatingFileHandler(const std::string& name, const std::string& filename) :
+    RotatingFileHandler(name, filename, Options()) {}
+
+RotatingFileHandler::RotatingFileHandler(const std::string& name, const std::string& filename, const Options& options) :
+    Handler(name), _filename(filename), _options(options), _buffer(options.bufferSize) {
+    open(false);
+
+    if (_file < 0) {
+        LUG_EXCEPT(FileNotFoundException, "Failed to open file");
+    }
+
+    _openTime = std::chrono::system_clock::now();
+    _lastWrite = _openTime;
+    _lastSync = std::chrono::steady_clock::now();
+}
+
+RotatingFileHandler::~RotatingFileHandler() {
+    writeBuffer();
+
+    if (_options.syncPolicy != SyncPolicy::Never) {
+        sync();
+    }
+
+    close();
+}
+
+void RotatingFileHandler::handle(const priv::Message& msg) {
+    const char* const data = msg.formatted.data();
+    const size_t size = msg.formatted.size();
+
+    if (_options.maxFileAge.count() > 0 && msg.time - _openTime >= _options.maxFileAge) {
+        rotate(msg.time);
+    }
+
+    // A message bigger than the limit is still written, alone in its file
+    if (_options.maxFileSize > 0 && getFileSize() > 0 && getFileSize() + size > _options.maxFileSize) {
+        rotate(msg.time);
+    }
+
+    if (_bufferSize + size > _buffer.size()) {
+        writeBuffer();
+    }
+
+    if (size >= _buffer.size()) {
+        write(data, size);
+    } else {
+        std::memcpy(_buffer.data() + _bufferSize, data, size);
+        _bufferSize += size;
+    }
+
+    if (msg.time - _lastWrite >= _options.flushInterval) {
+        writeBuffer();
+        _lastWrite = msg.time;
+    }
+}
+
+void RotatingFileHandler::flush() {
+    writeBuffer();
+    _lastWrite = std::chrono::system_clock::now();
+}
+
+const RotatingFileHandler::Options& RotatingFileHandler::getOptions() const {
+    return _options;
+}
+
+size_t RotatingFileHandler::getFileSize() const {
+    return _fileSize + _bufferSize;
+}
+
+std::string RotatingFileHandler::getBackupName(size_t index) const {
+    return index == 0 ? _filename : _filename + "." + std::to_string(index);
+}
+
+void RotatingFileHandler::open(bool truncate) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    _file = _open(_filename.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY | (truncate ? _O_TRUNC : _O_APPEND), _S_IREAD | _S_IWRITE);
+    _fileSize = _file >= 0 ? static_cast<size_t>(_lseeki64(_file, 0, SEEK_END)) : 0;
+#else
+    _file = ::open(_filename.c_str(), O_WRONLY | O_CREAT | (truncate ? O_TRUNC : O_APPEND), 0644);
+    _fileSize = _file >= 0 ? static_cast<size_t>(lseek(_file, 0, SEEK_END)) : 0;
+#endif
+}
+
+void RotatingFileHandler::close() {
+    if (_file < 0) {
+        return;
+    }
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    _close(_file);
+#else
+    ::close(_file);
+#endif
+
+    _file = -1;
+}
+
+void RotatingFileHandler::rotate(std::chrono::system_clock::time_point time) {
+    writeBuffer();
+
+    if (_options.syncPolicy != SyncPolicy::Never) {
+        sync();
+    }
+
+    close();
+
+    if (_options.backupCount > 0) {
+        std::remove(getBackupName(_options.backupCount).c_str());
+
+        for (size_t i = _options.backupCount; i > 0; --i) {
+            std::rename(getBackupName(i - 1).c_str(), getBackupName(i).c_str());
+        }
+    }
+
+    open(_options.backupCount == 0);
+    _openTime = time;
+}
+
+void RotatingFileHandler::writeBuffer() {
+    if (_bufferSize == 0) {
+        return;
+    }
+
+    write(_buffer.data(), _bufferSize);
+    _bufferSize = 0;
+
+    // The syncs are batched, at most one per interval
+    if (_options.syncPolicy == SyncPolicy::Interval && std::chrono::steady_clock::now() - _lastSync >= _options.syncInterval) {
+        sync();
+    }
+}
+
+void RotatingFileHandler::write(const char* data, size_t size) {
+    if (_file < 0) {
+        return;
+    }
+
+    _fileSize += size;
+
+    while (size > 0) {
+#if defined(LUG_SYSTEM_WINDOWS)
+        const int written = _write(_file, data, static_cast<unsigned int>(size));
+#else
+        const ssize_t written = ::write(_file, data, size);
+#endif
+
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+
+        // Nowhere to report the error, the rest of the data is lost
+        if (written <= 0) {
+            return;
+        }
+
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void RotatingFileHandler::sync() {
+    if (_file < 0) {
+        return;
+    }
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    _commit(_file);
+#else
+    fsync(_file);
+#endif
+
+    _lastSync = std::chrono::steady_clock::now();
+}
+
+} // Logger
+} // System
+} // lug
@@ -9,7 +9,9 @@ namespace Allocator {
 
 void* Basic::allocate(size_t size, size_t alignment, size_t offset) const {
 #if defined(LUG_SYSTEM_LINUX)
-    return aligned_alloc(alignment + offset, size);
+    // The size given to aligned_alloc has to be a multiple of the alignment
+    const size_t realAlignment = alignment + offset;
+    return aligned_alloc(realAlignment, (size + realAlignment - 1) / realAlignment * realAlignment);
 #elif defined(LUG_SYSTEM_ANDROID)
     void* ret = nullptr;
 
@@ -0,0 +1,55 @@
+#include <lug/System/Memory/Allocator/Bump.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Allocator {
+
+Bump::Bump(lug::System::Memory::Area::IArea* area) : _area{area}, _currentPage{_area->requestNextPage()}, _firstPage{_currentPage} {
+    if (_currentPage) {
+        _current = static_cast<char*>(_currentPage->start);
+        _end = static_cast<char*>(_currentPage->end) + 1;
+    }
+}
+
+void* Bump::allocateOnNextPage(size_t size, size_t alignment, size_t offset) {
+    while (_currentPage) {
+        // Out of memory on this page, just request a new one and try to reallocate
+        _currentPage = _currentPage->next = _currentPage->next ? _currentPage->next : _area->requestNextPage();
+
+        if (!_currentPage) {
+            break;
+        }
+
+        _current = static_cast<char*>(_currentPage->start);
+        _end = static_cast<char*>(_currentPage->end) + 1;
+
+        const uintptr_t ptr = ((reinterpret_cast<uintptr_t>(_current) + offset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - offset;
+
+        if (ptr + size <= reinterpret_cast<uintptr_t>(_end)) {
+            _current = reinterpret_cast<char*>(ptr + size);
+            return reinterpret_cast<void*>(ptr);
+        }
+    }
+
+    _current = nullptr;
+    _end = nullptr;
+
+    return nullptr;
+}
+
+void Bump::reset() {
+    _currentPage = _firstPage;
+
+    if (_currentPage) {
+        _current = static_cast<char*>(_currentPage->start);
+        _end = static_cast<char*>(_currentPage->end) + 1;
+    }
+
+    _area->notifyReset();
+}
+
+} // Allocator
+} // Memory
+} // System
+} // lug
@@ -1,5 +1,7 @@
 #include <lug/System/Memory/Allocator/Linear.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <lug/System/Debug.hpp>
 
@@ -31,8 +33,8 @@ void* Linear::allocate(size_t size, size_t alignment, size_t offset) {
             if (std::align(alignment, newSize - newOffset, _current, sizeLeft)) {
                 _current = static_cast<char*>(_current) + newSize - newOffset;
 
-                // Store the size
-                *static_cast<size_t*>(static_cast<void*>(static_cast<char*>(_current) - newSize)) = size;
+                // Store the size, the header isn't aligned for `size_t` when `alignment` is lower
+                std::memcpy(static_cast<char*>(_current) - newSize, &size, sizeof(size_t));
 
                 return static_cast<char*>(_current) - size;
             }
@@ -50,12 +52,53 @@ void Linear::free(void*) const {
     // Do nothing here
 }
 
+size_t Linear::allocateBatch(size_t count, size_t size, size_t alignment, size_t offset, void** out) {
+    alignment = alignment ? alignment : 1;
+
+    // `ptr + offset` of the first block is aligned, so is the one of the next blocks
+    const size_t stride = (size + sizeof(size_t) + alignment - 1) / alignment * alignment;
+    size_t allocated = 0;
+
+    while (allocated < count) {
+        char* const first = static_cast<char*>(allocate(size, alignment, offset));
+
+        if (!first) {
+            break;
+        }
+
+        out[allocated++] = first;
+
+        // Fill the rest of the page
+        const size_t sizeLeft = static_cast<char*>(_currentPage->end) + 1 - (first + size);
+        const size_t nextCount = std::min(sizeLeft / stride, count - allocated);
+
+        for (size_t i = 1; i <= nextCount; ++i) {
+            char* const ptr = first + i * stride;
+
+            // Store the size
+            std::memcpy(ptr - sizeof(size_t), &size, sizeof(size_t));
+
+            out[allocated++] = ptr;
+        }
+
+        _current = first + nextCount * stride + size;
+    }
+
+    return allocated;
+}
+
+void Linear::freeBatch(void* const*, size_t) const {
+    // Do nothing here
+}
+
 void Linear::reset() {
     _currentPage = _firstPage;
 
     if (_currentPage) {
         _current = _currentPage->start;
     }
+
+    _area->notifyReset();
 }
 
 Linear::Mark Linear::getMark() const {
@@ -68,7 +111,9 @@ void Linear::rewind(const Linear::Mark& mark) {
 }
 
 size_t Linear::getSize(void* ptr) const {
-    return static_cast<size_t*>(ptr)[-1];
+    size_t size;
+    std::memcpy(&size, static_cast<char*>(ptr) - sizeof(size_t), sizeof(size_t));
+    return size;
 }
 
 } // Allocator
@@ -70,6 +70,8 @@ void Stack::reset() {
     if (_currentPage) {
         _current = _currentPage->start;
     }
+
+    _area->notifyReset();
 }
 
 Stack::Mark Stack::getMark() const {
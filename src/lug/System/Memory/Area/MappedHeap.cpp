@@ -0,0 +1,222 @@
+#include <lug/System/Memory/Area/MappedHeap.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Memory/Area/VirtualMemory.hpp>
+
+#if !defined(LUG_SYSTEM_WINDOWS)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+
+constexpr size_t MappedHeap::HeaderSize;
+
+struct MappedHeap::Header {
+    static constexpr char Magic[8] = {'L', 'U', 'G', 'A', 'R', 'E', 'N', 'A'};
+    static constexpr uint16_t Version = 1;
+
+    char magic[8];
+    uint16_t version;
+
+    // The layout of the objects depends on it
+    uint16_t pointerSize;
+    uint32_t headerSize;
+
+    uint64_t capacity;
+
+    // Header included
+    uint64_t size;
+
+    // Offset from the beginning of the area, 0 if there is no root
+    uint64_t root;
+};
+
+constexpr char MappedHeap::Header::Magic[8];
+constexpr uint16_t MappedHeap::Header::Version;
+
+namespace {
+
+size_t alignOnPage(size_t size) {
+    const size_t pageSize = VirtualMemory::getPageSize();
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+} // anonymous
+
+MappedHeap::MappedHeap(size_t capacity) {
+    static_assert(sizeof(Header) <= HeaderSize, "The header doesn't fit");
+
+    capacity = alignOnPage(std::max(capacity, HeaderSize + 1));
+    char* const data = static_cast<char*>(VirtualMemory::map(capacity, VirtualMemory::HugePages::None, VirtualMemory::AnyNumaNode));
+
+    if (data) {
+        setData(data, capacity, 0);
+    }
+}
+
+MappedHeap::~MappedHeap() {
+    VirtualMemory::release(_data, _capacity);
+    _data = nullptr;
+}
+
+Page* MappedHeap::requestNextPage() {
+    if (_pageRequested || !_data) {
+        return nullptr;
+    }
+
+    char* const start = _data + std::max(_snapshotSize, HeaderSize);
+
+    if (start >= _data + _capacity) {
+        return nullptr;
+    }
+
+    _pageRequested = true;
+    _page = {start, _data + _capacity - 1, nullptr, nullptr};
+
+    return &_page;
+}
+
+bool MappedHeap::save(const std::string& filename, const void* end) {
+    LUG_ASSERT(_data, "The area has no memory");
+    LUG_ASSERT(end >= _data + HeaderSize && end <= _data + _capacity, "The end of the snapshot is not in the area");
+
+    Header* const header = getHeader();
+    header->size = static_cast<const char*>(end) - _data;
+
+    // The file may be the one mapped by this area, truncating it would drop the pages not read yet
+    // Write another file and replace it
+    const std::string tmpFilename = filename + ".tmp";
+    std::FILE* const file = std::fopen(tmpFilename.c_str(), "wb");
+
+    if (!file) {
+        return false;
+    }
+
+    const bool written = std::fwrite(_data, 1, header->size, file) == header->size;
+
+    if (std::fclose(file) != 0 || !written) {
+        std::remove(tmpFilename.c_str());
+        return false;
+    }
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    // Doesn't replace an existing file
+    std::remove(filename.c_str());
+#endif
+
+    return std::rename(tmpFilename.c_str(), filename.c_str()) == 0;
+}
+
+bool MappedHeap::load(const std::string& filename) {
+    LUG_ASSERT(!_pageRequested, "The snapshot must be loaded before the area is used");
+
+    Header header;
+
+    std::FILE* const file = std::fopen(filename.c_str(), "rb");
+
+    if (!file) {
+        return false;
+    }
+
+    const bool read = std::fread(&header, sizeof(header), 1, file) == 1;
+    std::fseek(file, 0, SEEK_END);
+    const long fileSize = std::ftell(file);
+
+    if (!read
+        || fileSize < static_cast<long>(HeaderSize)
+        || std::memcmp(header.magic, Header::Magic, sizeof(Header::Magic)) != 0
+        || header.version != Header::Version
+        || header.pointerSize != sizeof(void*)
+        || header.headerSize != HeaderSize
+        || header.size != static_cast<uint64_t>(fileSize)
+        || header.root >= header.size) {
+        std::fclose(file);
+        return false;
+    }
+
+    const size_t capacity = alignOnPage(static_cast<size_t>(std::max(header.capacity, header.size)));
+    char* data = nullptr;
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    // No copy-on-write view of a file inside a larger mapping, read it instead
+    data = static_cast<char*>(VirtualMemory::map(capacity, VirtualMemory::HugePages::None, VirtualMemory::AnyNumaNode));
+
+    if (data) {
+        std::fseek(file, 0, SEEK_SET);
+
+        if (std::fread(data, 1, header.size, file) != header.size) {
+            VirtualMemory::release(data, capacity);
+            data = nullptr;
+        }
+    }
+#else
+    // Anonymous memory for the whole capacity, with the file mapped over its beginning
+    // The pages of the snapshot are read on first touch and copied on first write, the file is never modified
+    data = static_cast<char*>(VirtualMemory::map(capacity, VirtualMemory::HugePages::None, VirtualMemory::AnyNumaNode));
+
+    if (data && mmap(data, header.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fileno(file), 0) == MAP_FAILED) {
+        VirtualMemory::release(data, capacity);
+        data = nullptr;
+    }
+#endif
+
+    std::fclose(file);
+
+    if (!data) {
+        return false;
+    }
+
+    VirtualMemory::release(_data, _capacity);
+    setData(data, capacity, header.size);
+
+    // The capacity can be bigger than the one the snapshot was saved with
+    getHeader()->capacity = capacity;
+
+    return true;
+}
+
+void MappedHeap::setRoot(const void* ptr) {
+    LUG_ASSERT(!ptr || contains(ptr), "The root is not in the area");
+
+    getHeader()->root = ptr ? static_cast<const char*>(ptr) - _data : 0;
+}
+
+MappedHeap::Header* MappedHeap::getHeader() const {
+    return reinterpret_cast<Header*>(_data);
+}
+
+void* MappedHeap::getRootPtr() const {
+    const uint64_t root = _data ? getHeader()->root : 0;
+    return root ? _data + root : nullptr;
+}
+
+void MappedHeap::setData(char* data, size_t capacity, size_t snapshotSize) {
+    _data = data;
+    _capacity = capacity;
+    _snapshotSize = snapshotSize;
+
+    if (!snapshotSize) {
+        Header* const header = getHeader();
+
+        std::memcpy(header->magic, Header::Magic, sizeof(Header::Magic));
+        header->version = Header::Version;
+        header->pointerSize = sizeof(void*);
+        header->headerSize = HeaderSize;
+        header->capacity = capacity;
+        header->size = HeaderSize;
+        header->root = 0;
+    }
+}
+
+} // Area
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,226 @@
+#include <lug/System/Memory/Area/VirtualMemory.hpp>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #include <Windows.h>
+#else
+    #include <cstdio>
+    #include <cstring>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#if defined(LUG_SYSTEM_LINUX)
+    #include <sys/syscall.h>
+#endif
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+namespace VirtualMemory {
+
+size_t getPageSize() {
+#if defined(LUG_SYSTEM_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    // Reservations are aligned on the allocation granularity, not the page size
+    return static_cast<size_t>(info.dwAllocationGranularity);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+void* reserve(size_t size) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void* const ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+}
+
+void release(void* ptr, size_t size) {
+    if (!ptr) {
+        return;
+    }
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    (void)(size);
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+bool commit(void* ptr, size_t size) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void decommit(void* ptr, size_t size) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    // MEM_DECOMMIT would make the range inaccessible, MEM_RESET keeps it usable
+    VirtualAlloc(ptr, size, MEM_RESET, PAGE_READWRITE);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+#endif
+}
+
+#if !defined(LUG_SYSTEM_WINDOWS)
+
+// The default huge page size of the kernel (2MB on x86_64, but 1GB, 16MB or 512MB on other configurations), 0 if unknown
+static size_t readHugePageSize() {
+    FILE* const file = std::fopen("/proc/meminfo", "r");
+
+    if (!file) {
+        return 0;
+    }
+
+    size_t size = 0;
+    char line[128];
+
+    while (std::fgets(line, sizeof(line), file)) {
+        unsigned long kiloBytes = 0;
+
+        if (std::strncmp(line, "Hugepagesize:", 13) == 0 && std::sscanf(line + 13, "%lu", &kiloBytes) == 1) {
+            size = static_cast<size_t>(kiloBytes) * 1024;
+            break;
+        }
+    }
+
+    std::fclose(file);
+
+    return size;
+}
+
+#endif
+
+size_t getHugePageSize() {
+#if defined(LUG_SYSTEM_WINDOWS)
+    return static_cast<size_t>(GetLargePageMinimum());
+#else
+    static const size_t hugePageSize = readHugePageSize();
+    return hugePageSize;
+#endif
+}
+
+#if defined(LUG_SYSTEM_WINDOWS)
+
+void* map(size_t size, HugePages hugePages, int numaNode, HugePages* obtained) {
+    const DWORD type = MEM_RESERVE | MEM_COMMIT;
+    const size_t hugePageSize = getHugePageSize();
+
+    void* ptr = nullptr;
+
+    // Large pages need the SeLockMemoryPrivilege, the call fails without it
+    if (hugePages == HugePages::Explicit && hugePageSize && size % hugePageSize == 0) {
+        ptr = numaNode == AnyNumaNode
+            ? VirtualAlloc(nullptr, size, type | MEM_LARGE_PAGES, PAGE_READWRITE)
+            : VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, type | MEM_LARGE_PAGES, PAGE_READWRITE, static_cast<DWORD>(numaNode));
+    }
+
+    if (ptr) {
+        hugePages = HugePages::Explicit;
+    } else {
+        // There is no transparent huge pages on Windows
+        hugePages = HugePages::None;
+
+        ptr = numaNode == AnyNumaNode
+            ? VirtualAlloc(nullptr, size, type, PAGE_READWRITE)
+            : VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, type, PAGE_READWRITE, static_cast<DWORD>(numaNode));
+    }
+
+    if (obtained) {
+        *obtained = hugePages;
+    }
+
+    return ptr;
+}
+
+#else
+
+void* map(size_t size, HugePages hugePages, int numaNode, HugePages* obtained) {
+    void* ptr = MAP_FAILED;
+    const size_t hugePageSize = getHugePageSize();
+
+    // Without the size of the huge pages, the mapping can't be rounded to them
+    if (!hugePageSize) {
+        hugePages = HugePages::None;
+    }
+
+#if defined(MAP_HUGETLB)
+    // Without MAP_NORESERVE the huge pages are reserved now, so the mapping fails here
+    // instead of a SIGBUS on first touch when the pool is too small
+    if (hugePages == HugePages::Explicit && size % hugePageSize == 0) {
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+
+    if (ptr == MAP_FAILED) {
+        hugePages = hugePages == HugePages::None ? HugePages::None : HugePages::Transparent;
+
+        // The kernel only uses huge pages for the aligned parts of the mapping,
+        // map more and trim both ends to start on a huge page boundary
+        const size_t alignment = hugePages == HugePages::Transparent && size >= hugePageSize ? hugePageSize : 0;
+        char* const raw = static_cast<char*>(mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+        if (raw == MAP_FAILED) {
+            return nullptr;
+        }
+
+        ptr = raw;
+
+        if (alignment) {
+            char* const aligned = raw + (alignment - reinterpret_cast<uintptr_t>(raw) % alignment) % alignment;
+
+            if (aligned != raw) {
+                munmap(raw, aligned - raw);
+            }
+
+            if (aligned + size != raw + size + alignment) {
+                munmap(aligned + size, raw + size + alignment - (aligned + size));
+            }
+
+            ptr = aligned;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (hugePages == HugePages::Transparent && madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+            hugePages = HugePages::None;
+        }
+#else
+        hugePages = HugePages::None;
+#endif
+    }
+
+#if defined(LUG_SYSTEM_LINUX) && defined(SYS_mbind)
+    // Preferred rather than bound, the kernel takes another node when this one is full
+    // Called directly to not depend on libnuma, errors (no NUMA support, invalid node) are ignored
+    if (numaNode != AnyNumaNode && numaNode >= 0 && numaNode < static_cast<int>(sizeof(unsigned long) * 8)) {
+        constexpr int mpolPreferred = 1;
+        const unsigned long nodeMask = 1ul << numaNode;
+
+        syscall(SYS_mbind, ptr, size, mpolPreferred, &nodeMask, sizeof(nodeMask) * 8 + 1, 0);
+    }
+#else
+    (void)(numaNode);
+#endif
+
+    if (obtained) {
+        *obtained = hugePages;
+    }
+
+    return ptr;
+}
+
+#endif
+
+} // VirtualMemory
+} // Area
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,134 @@
+#include <lug/System/Memory/AtomicFreeList.hpp>
+#include <memory>
+#include <lug/System/Debug.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+// The user-space addresses fit in 48 bits on the supported 64 bits platforms, the 16 upper bits are used for the tag
+static constexpr uint64_t PointerBits = sizeof(void*) == 8 ? 48 : 32;
+static constexpr uint64_t PointerMask = (uint64_t{1} << PointerBits) - 1;
+
+AtomicFreeList::AtomicFreeList(size_t size) : _size(size) {
+    LUG_ASSERT(_size > sizeof(AtomicFreeList::Element*), "The size is not enough for this implementation of freelist");
+}
+
+bool AtomicFreeList::grow(void* start, void* end, size_t alignment, size_t offset) {
+    // First, align the start pointer
+    {
+        start = static_cast<char*>(start) + offset;
+
+        if (start > end) {
+            return false;
+        }
+
+        size_t size = static_cast<char*>(end) - static_cast<char*>(start) + 1;
+
+        if (!std::align(alignment, _size - offset, start, size)) {
+            return false;
+        }
+
+        start = static_cast<char*>(start) - offset;
+    }
+
+    // Second create the linked list and push it all at once
+    {
+        Element* const first = static_cast<Element*>(start);
+        Element* it = first;
+
+        size_t size = static_cast<char*>(end) - static_cast<char*>(start) + 1;
+
+        for (size_t i = 1, count = size / _size; i < count; ++i) {
+            void* const next = static_cast<char*>(static_cast<void*>(it)) + _size;
+
+            it->next.store(static_cast<Element*>(next), std::memory_order_relaxed);
+            it = static_cast<Element*>(next);
+        }
+
+        push(first, it);
+    }
+
+    return true;
+}
+
+void* AtomicFreeList::allocate() {
+    TaggedPointer head = _head.load(std::memory_order_acquire);
+
+    while (Element* const element = unpackPointer(head)) {
+        // `element` may have been popped and written by another thread, in that case
+        // `next` is garbage but the tag has changed and the exchange fails
+        const TaggedPointer next = pack(element->next.load(std::memory_order_relaxed), unpackTag(head) + 1);
+
+        if (_head.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return element;
+        }
+    }
+
+    return nullptr;
+}
+
+void AtomicFreeList::free(void* ptr) {
+    Element* const element = static_cast<Element*>(ptr);
+    push(element, element);
+}
+
+size_t AtomicFreeList::allocateBatch(size_t count, void** out) {
+    // The elements are popped one by one, following the chain further than the head could read
+    // a garbage pointer from an element already popped and written by another thread
+    size_t allocated = 0;
+
+    for (; allocated < count; ++allocated) {
+        out[allocated] = allocate();
+
+        if (!out[allocated]) {
+            break;
+        }
+    }
+
+    return allocated;
+}
+
+void AtomicFreeList::freeBatch(void* const* ptrs, size_t count) {
+    if (!count) {
+        return;
+    }
+
+    for (size_t i = 0; i + 1 < count; ++i) {
+        static_cast<Element*>(ptrs[i])->next.store(static_cast<Element*>(ptrs[i + 1]), std::memory_order_relaxed);
+    }
+
+    push(static_cast<Element*>(ptrs[0]), static_cast<Element*>(ptrs[count - 1]));
+}
+
+void AtomicFreeList::reset() {
+    // Keep the tag going, it is only 16 bits wide and would wrap sooner from zero
+    const TaggedPointer head = _head.load(std::memory_order_relaxed);
+    _head.store(pack(nullptr, unpackTag(head) + 1), std::memory_order_release);
+}
+
+AtomicFreeList::TaggedPointer AtomicFreeList::pack(Element* element, uint64_t tag) {
+    return (tag << PointerBits) | (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(element)) & PointerMask);
+}
+
+AtomicFreeList::Element* AtomicFreeList::unpackPointer(TaggedPointer tagged) {
+    return reinterpret_cast<Element*>(static_cast<uintptr_t>(tagged & PointerMask));
+}
+
+uint64_t AtomicFreeList::unpackTag(TaggedPointer tagged) {
+    return tagged >> PointerBits;
+}
+
+void AtomicFreeList::push(Element* first, Element* last) {
+    LUG_ASSERT(unpackPointer(pack(first, 0)) == first, "The pointer doesn't fit in the tagged pointer");
+
+    TaggedPointer head = _head.load(std::memory_order_relaxed);
+
+    do {
+        last->next.store(unpackPointer(head), std::memory_order_relaxed);
+    } while (!_head.compare_exchange_weak(head, pack(first, unpackTag(head)), std::memory_order_release, std::memory_order_relaxed));
+}
+
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,101 @@
+#include <lug/System/Memory/FrameArena.hpp>
+#include <new>
+#include <lug/System/Debug.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+constexpr size_t FrameArena::PageSize;
+constexpr size_t FrameArena::MaxPageCount;
+
+FrameArena::Area::Area(size_t& pageCount) : _pageCount(pageCount) {}
+
+Memory::Area::Page* FrameArena::Area::requestNextPage() {
+    Memory::Area::Page* page = GrowingHeap::requestNextPage();
+
+    if (page) {
+        ++_pageCount;
+    }
+
+    return page;
+}
+
+FrameArena::FrameArena(uint32_t frameCount) {
+    setFrameCount(frameCount);
+}
+
+FrameArena::~FrameArena() {
+    for (uint32_t i = 0; i < _largeBlocks.size(); ++i) {
+        releaseLarge(i);
+    }
+}
+
+void FrameArena::setFrameCount(uint32_t frameCount) {
+    LUG_ASSERT(frameCount > 0, "The frame arena needs at least one frame");
+
+    for (uint32_t i = 0; i < _largeBlocks.size(); ++i) {
+        releaseLarge(i);
+    }
+
+    _arenas.clear();
+    _areas.clear();
+    _largeBlocks.clear();
+
+    for (uint32_t i = 0; i < frameCount; ++i) {
+        _areas.push_back(std::make_unique<Area>(_systemAllocationCount));
+        _arenas.push_back(std::make_unique<Arena>(_areas.back().get()));
+    }
+
+    _largeBlocks.resize(frameCount);
+
+    _currentFrame = 0;
+    _currentArena = _arenas[_currentFrame].get();
+    _usedSize = 0;
+}
+
+void FrameArena::nextFrame() {
+    _currentFrame = (_currentFrame + 1) % _arenas.size();
+    _currentArena = _arenas[_currentFrame].get();
+    _currentArena->reset();
+    releaseLarge(_currentFrame);
+
+    _usedSize = 0;
+}
+
+void* FrameArena::allocateLarge(size_t size, size_t alignment, size_t offset) {
+    alignment = alignment ? alignment : 1;
+
+    // The slot is reserved first, so the block can't leak if the vector fails to grow
+    std::vector<void*>& blocks = _largeBlocks[_currentFrame];
+    if (blocks.size() == blocks.capacity()) {
+        blocks.reserve(blocks.empty() ? 8 : blocks.size() * 2);
+    }
+
+    // Reserve the space to align `ptr + offset`, the raw pointer is kept to release the block
+    char* const block = static_cast<char*>(::operator new(size + alignment - 1, std::nothrow));
+
+    if (!block) {
+        return nullptr;
+    }
+
+    blocks.push_back(block);
+    ++_systemAllocationCount;
+
+    const uintptr_t aligned = (reinterpret_cast<uintptr_t>(block) + offset + alignment - 1) & ~(alignment - 1);
+    const uintptr_t ptr = aligned - offset;
+
+    return block + (ptr - reinterpret_cast<uintptr_t>(block));
+}
+
+void FrameArena::releaseLarge(uint32_t frame) {
+    for (void* block : _largeBlocks[frame]) {
+        ::operator delete(block);
+    }
+
+    _largeBlocks[frame].clear();
+}
+
+} // Memory
+} // System
+} // lug
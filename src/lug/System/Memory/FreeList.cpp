@@ -69,6 +69,33 @@ void FreeList::reset() {
     _nextFree = nullptr;
 }
 
+size_t FreeList::allocateBatch(size_t count, void** out) {
+    Element* it = _nextFree;
+    size_t allocated = 0;
+
+    for (; allocated < count && it; ++allocated) {
+        out[allocated] = it;
+        it = it->next;
+    }
+
+    _nextFree = it;
+    return allocated;
+}
+
+void FreeList::freeBatch(void* const* ptrs, size_t count) {
+    if (!count) {
+        return;
+    }
+
+    // Chain the elements and put them in front of the list at once
+    for (size_t i = 0; i + 1 < count; ++i) {
+        static_cast<Element*>(ptrs[i])->next = static_cast<Element*>(ptrs[i + 1]);
+    }
+
+    static_cast<Element*>(ptrs[count - 1])->next = _nextFree;
+    _nextFree = static_cast<Element*>(ptrs[0]);
+}
+
 } // Memory
 } // System
 } // lug
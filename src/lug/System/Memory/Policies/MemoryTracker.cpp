@@ -0,0 +1,229 @@
+#include <lug/System/Memory/Policies/MemoryTracker.hpp>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Policies {
+
+constexpr uint32_t SimpleMemoryTracking::NoSite;
+
+static constexpr size_t InitialCapacity = 64;
+
+static inline size_t hashPointer(const void* ptr) {
+    // The low bits are always zero because of the alignment
+    return static_cast<size_t>((reinterpret_cast<uintptr_t>(ptr) >> 4) * 0x9E3779B97F4A7C15ull);
+}
+
+static inline size_t hashSite(const char* file, size_t line) {
+    return static_cast<size_t>((reinterpret_cast<uintptr_t>(file) ^ (line << 16)) * 0x9E3779B97F4A7C15ull);
+}
+
+SimpleMemoryTracking::SimpleMemoryTracking(SimpleMemoryTracking&& other) :
+    _allocations(std::move(other._allocations)),
+    _liveCount(other._liveCount),
+    _liveBytes(other._liveBytes),
+    _peakBytes(other._peakBytes),
+    _sites(std::move(other._sites)),
+    _siteTable(std::move(other._siteTable)),
+    _lastSite(other._lastSite) {
+    other.clear();
+}
+
+SimpleMemoryTracking& SimpleMemoryTracking::operator=(SimpleMemoryTracking&& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    // The allocations tracked until now are lost as with the destructor
+    if (_liveCount) {
+        dumpLeaks();
+    }
+
+    _allocations = std::move(other._allocations);
+    _liveCount = other._liveCount;
+    _liveBytes = other._liveBytes;
+    _peakBytes = other._peakBytes;
+    _sites = std::move(other._sites);
+    _siteTable = std::move(other._siteTable);
+    _lastSite = other._lastSite;
+
+    other.clear();
+
+    return *this;
+}
+
+SimpleMemoryTracking::~SimpleMemoryTracking() {
+    if (_liveCount) {
+        dumpLeaks();
+    }
+}
+
+void SimpleMemoryTracking::trackAllocation(void* ptr, size_t size, size_t alignment, const char* file, size_t line) {
+    if ((_liveCount + 1) * 2 > _allocations.size()) {
+        growAllocations();
+    }
+
+    // Consecutive allocations often come from the same place
+    const uint32_t site = (_lastSite != NoSite && _sites[_lastSite].line == line && _sites[_lastSite].file == file) ? _lastSite : findSite(file, line);
+    _lastSite = site;
+
+    const size_t mask = _allocations.size() - 1;
+    size_t index = hashPointer(ptr) & mask;
+
+    while (_allocations[index].ptr) {
+        LUG_ASSERT(_allocations[index].ptr != ptr, "The address is already allocated");
+        index = (index + 1) & mask;
+    }
+
+    _allocations[index] = {ptr, size, static_cast<uint32_t>(alignment), site};
+
+    _liveCount += 1;
+    _liveBytes += size;
+    _peakBytes = _peakBytes < _liveBytes ? _liveBytes : _peakBytes;
+
+    _sites[site].allocationCount += 1;
+    _sites[site].liveCount += 1;
+    _sites[site].liveBytes += size;
+}
+
+void SimpleMemoryTracking::trackDeallocation(void* ptr) {
+    if (_allocations.empty()) {
+        LUG_ASSERT(false, "Deallocation of an address that is not allocated");
+        return;
+    }
+
+    const size_t mask = _allocations.size() - 1;
+    size_t index = hashPointer(ptr) & mask;
+
+    while (_allocations[index].ptr != ptr) {
+        if (!_allocations[index].ptr) {
+            LUG_ASSERT(false, "Deallocation of an address that is not allocated");
+            return;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    const Allocation& allocation = _allocations[index];
+
+    _liveCount -= 1;
+    _liveBytes -= allocation.size;
+
+    _sites[allocation.site].liveCount -= 1;
+    _sites[allocation.site].liveBytes -= allocation.size;
+
+    // Shift back the following entries of the cluster instead of leaving a tombstone
+    size_t hole = index;
+    for (size_t next = (index + 1) & mask; _allocations[next].ptr; next = (next + 1) & mask) {
+        const size_t home = hashPointer(_allocations[next].ptr) & mask;
+
+        // Move the entry if its home isn't between the hole and its current slot
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            _allocations[hole] = _allocations[next];
+            hole = next;
+        }
+    }
+
+    _allocations[hole].ptr = nullptr;
+}
+
+void SimpleMemoryTracking::trackReset() {
+    for (Allocation& allocation : _allocations) {
+        allocation.ptr = nullptr;
+    }
+
+    for (Site& site : _sites) {
+        site.liveCount = 0;
+        site.liveBytes = 0;
+    }
+
+    _liveCount = 0;
+    _liveBytes = 0;
+}
+
+void SimpleMemoryTracking::dumpLeaks() const {
+    LUG_LOG.warn("Memory: {} allocations ({} bytes) still alive", _liveCount, _liveBytes);
+
+    for (const Site& site : _sites) {
+        if (site.liveCount) {
+            LUG_LOG.warn("Memory: {} allocations ({} bytes) from {}:{}", site.liveCount, site.liveBytes, site.file ? site.file : "?", site.line);
+        }
+    }
+}
+
+uint32_t SimpleMemoryTracking::findSite(const char* file, size_t line) {
+    if ((_sites.size() + 1) * 2 > _siteTable.size()) {
+        growSites();
+    }
+
+    const size_t mask = _siteTable.size() - 1;
+    size_t index = hashSite(file, line) & mask;
+
+    while (_siteTable[index] != NoSite) {
+        const Site& site = _sites[_siteTable[index]];
+
+        if (site.file == file && site.line == line) {
+            return _siteTable[index];
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    _siteTable[index] = static_cast<uint32_t>(_sites.size());
+    _sites.push_back({file, line, 0, 0, 0});
+
+    return _siteTable[index];
+}
+
+void SimpleMemoryTracking::growAllocations() {
+    std::vector<Allocation> allocations(_allocations.empty() ? InitialCapacity : _allocations.size() * 2, Allocation{nullptr, 0, 0, 0});
+    const size_t mask = allocations.size() - 1;
+
+    for (const Allocation& allocation : _allocations) {
+        if (allocation.ptr) {
+            size_t index = hashPointer(allocation.ptr) & mask;
+
+            while (allocations[index].ptr) {
+                index = (index + 1) & mask;
+            }
+
+            allocations[index] = allocation;
+        }
+    }
+
+    _allocations.swap(allocations);
+}
+
+void SimpleMemoryTracking::clear() {
+    // The moved-from vectors are valid but unspecified
+    _allocations.clear();
+    _sites.clear();
+    _siteTable.clear();
+
+    _liveCount = 0;
+    _liveBytes = 0;
+    _peakBytes = 0;
+    _lastSite = NoSite;
+}
+
+void SimpleMemoryTracking::growSites() {
+    _siteTable.assign(_siteTable.empty() ? InitialCapacity : _siteTable.size() * 2, NoSite);
+    const size_t mask = _siteTable.size() - 1;
+
+    for (uint32_t i = 0; i < _sites.size(); ++i) {
+        size_t index = hashSite(_sites[i].file, _sites[i].line) & mask;
+
+        while (_siteTable[index] != NoSite) {
+            index = (index + 1) & mask;
+        }
+
+        _siteTable[index] = i;
+    }
+}
+
+} // Policies
+} // Memory
+} // System
+} // lug
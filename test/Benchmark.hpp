@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace lug {
+namespace Benchmark {
+
+// Prevents the compiler from optimizing away a computed value
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+    static volatile const void* sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// Returns the time in seconds spent in `function`, best of `repeat` runs
+template <typename Function>
+inline double measure(Function&& function, size_t repeat = 3) {
+    double best = 0.0;
+
+    for (size_t i = 0; i < repeat; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+
+        const double elapsed = std::chrono::duration<double>(end - start).count();
+        best = (i == 0 ? elapsed : std::min(best, elapsed));
+    }
+
+    return best;
+}
+
+// Runs `function(threadIndex)` on `threadCount` threads released at the same time
+// and returns the wall-clock time in seconds until the last one finishes
+template <typename Function>
+inline double measureThreads(size_t threadCount, Function&& function) {
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+
+    threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i]() {
+            ready.fetch_add(1);
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+
+            function(i);
+        });
+    }
+
+    while (ready.load() != threadCount) {
+        std::this_thread::yield();
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+inline void report(const char* name, size_t operations, double seconds) {
+    std::printf(
+        "[ BENCHMARK ] %-56s %14.0f ops/s %10.3f ms\n",
+        name,
+        seconds > 0.0 ? operations / seconds : 0.0,
+        seconds * 1000.0
+    );
+}
+
+// Prints the percentiles of the latencies in nanoseconds, `latencies` is sorted
+inline void reportLatency(const char* name, std::vector<uint64_t>& latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto percentile = [&latencies](double value) {
+        return static_cast<unsigned long long>(latencies[static_cast<size_t>(value * (latencies.size() - 1))]);
+    };
+
+    std::printf(
+        "[ BENCHMARK ] %-56s p50 %6llu ns, p99 %6llu ns, p99.9 %8llu ns, max %9llu ns\n",
+        name,
+        percentile(0.5),
+        percentile(0.99),
+        percentile(0.999),
+        static_cast<unsigned long long>(latencies.back())
+    );
+}
+
+// Counts the hardware cache misses of the calling thread between `start` and `stop`
+// `isAvailable` is false when the counters can't be read (other systems, virtual machines, restricted perf events)
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attributes{};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        _fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if (_fd >= 0) {
+            close(_fd);
+        }
+#endif
+    }
+
+    bool isAvailable() const {
+        return _fd >= 0;
+    }
+
+    void start() {
+#if defined(__linux__)
+        if (_fd >= 0) {
+            ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t count = 0;
+
+#if defined(__linux__)
+        if (_fd >= 0) {
+            ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+            if (read(_fd, &count, sizeof(count)) != sizeof(count)) {
+                count = 0;
+            }
+        }
+#endif
+
+        return count;
+    }
+
+private:
+    int _fd{-1};
+};
+
+} // Benchmark
+} // lug
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <lug/Math/Affine3.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <lug/Math/Geometry/Trigonometry.hpp>
+
+#define MAT4_ASSERT_NEAR(a, b, abs_error)                                       \
+    {                                                                           \
+        const Mat4x4d tmpA = a;                                                 \
+        const Mat4x4d tmpB = b;                                                 \
+                                                                                \
+        for (uint8_t i = 0; i < 16; ++i) {                                      \
+            ASSERT_NEAR(tmpA.getValues()[i], tmpB.getValues()[i], abs_error)    \
+                << "i = " << static_cast<int>(i);                               \
+        }                                                                       \
+    }
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+const Vec3d position{1.0, -2.0, 3.0};
+const Quatd rotation{Geometry::radians(35.0), normalize(Vec3d{1.0, 2.0, -0.5})};
+const Vec3d scale{2.0, 0.5, 3.0};
+
+// The transformation of a node, built as before Affine3
+Mat4x4d trsMatrix() {
+    return Geometry::translate(position) * rotation.transform() * Geometry::scale(scale);
+}
+
+}
+
+TEST(Affine3, Construction) {
+    ASSERT_EQ(Affine3d::identity().toMatrix(), Mat4x4d::identity());
+
+    MAT4_ASSERT_NEAR(Affine3d::fromTRS(position, rotation, scale).toMatrix(), trsMatrix(), 1e-12);
+
+    // The last row is dropped
+    ASSERT_EQ(Affine3d(trsMatrix()).toMatrix(), trsMatrix());
+    ASSERT_EQ(Affine3d(trsMatrix()).getTranslation(), position);
+}
+
+TEST(Affine3, Inverse) {
+    const Affine3d affine = Affine3d::fromTRS(position, rotation, scale);
+
+    MAT4_ASSERT_NEAR(affine.inverse().toMatrix(), trsMatrix().inverse(), 1e-12);
+    MAT4_ASSERT_NEAR((affine * affine.inverse()).toMatrix(), Mat4x4d::identity(), 1e-12);
+    MAT4_ASSERT_NEAR((affine.inverse() * affine).toMatrix(), Mat4x4d::identity(), 1e-12);
+
+    // With a shear, not a TRS
+    const Affine3d sheared{Mat3x3d{
+        1.0, 2.0, 3.0,
+        0.0, 1.0, 4.0,
+        5.0, 6.0, 0.0
+    }, position};
+
+    MAT4_ASSERT_NEAR(sheared.inverse().toMatrix(), sheared.toMatrix().inverse(), 1e-12);
+}
+
+TEST(Affine3, Composition) {
+    const Affine3d lhs = Affine3d::fromTRS(position, rotation, scale);
+    const Affine3d rhs = Affine3d::fromTRS(Vec3d{-4.0, 0.5, 2.0}, inverse(rotation), Vec3d{1.0, 4.0, 0.25});
+
+    MAT4_ASSERT_NEAR((lhs * rhs).toMatrix(), lhs.toMatrix() * rhs.toMatrix(), 1e-12);
+
+    ASSERT_EQ(lhs * Affine3d::identity(), lhs);
+    ASSERT_NE(lhs * rhs, rhs * lhs);
+}
+
+TEST(Affine3, Transform) {
+    const Affine3d affine = Affine3d::fromTRS(position, rotation, scale);
+    const Vec3d point{0.5, 7.0, -2.0};
+
+    const Vec3d transformedPoint = affine.transformPoint(point);
+    const Vec4d expectedPoint = trsMatrix() * Vec4d{point, 1.0};
+
+    const Vec3d transformedDirection = affine.transformDirection(point);
+    const Vec4d expectedDirection = trsMatrix() * Vec4d{point, 0.0};
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        ASSERT_NEAR(transformedPoint(i), expectedPoint(i), 1e-12);
+        ASSERT_NEAR(transformedDirection(i), expectedDirection(i), 1e-12);
+    }
+}
+
+} // Math
+} // lug
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+
+// The kernels are compared to the scalar versions, with a count not multiple of the SIMD width to cover the remaining elements
+
+namespace lug {
+namespace Math {
+namespace Batch {
+
+namespace {
+
+constexpr size_t Count = 19;
+
+float value(size_t index, size_t component) {
+    return static_cast<float>((index * 7 + component * 3) % 11) * 0.5f - 2.0f;
+}
+
+Mat4x4f createMatrix(size_t index) {
+    Mat4x4f matrix;
+
+    for (uint8_t component = 0; component < 16; ++component) {
+        matrix.getValues()[component] = value(index, component);
+    }
+
+    return matrix;
+}
+
+void expectNear(const Mat4x4f& result, const Mat4x4f& correctResult, float epsilon) {
+    for (uint8_t row = 0; row < 4; ++row) {
+        for (uint8_t col = 0; col < 4; ++col) {
+            ASSERT_NEAR(result(row, col), correctResult(row, col), epsilon)
+                << "row = " << static_cast<int>(row) << "\n"
+                << "col = " << static_cast<int>(col);
+        }
+    }
+}
+
+}
+
+TEST(Batch, Access) {
+    std::vector<float> data(16 * Count);
+    const Mat4x4SoA<float> matrices{data.data(), Count};
+
+    setMatrix(matrices, 3, createMatrix(3));
+
+    expectNear(getMatrix(matrices, 3), createMatrix(3), 0.0f);
+    ASSERT_EQ(data[(1 * 4 + 2) * Count + 3], createMatrix(3)(2, 1));
+}
+
+TEST(Batch, TransformPoints) {
+    std::vector<float> data(3 * Count);
+    const Vec3SoA<float> points{data.data(), Count};
+
+    for (size_t i = 0; i < Count; ++i) {
+        setVector(points, i, {value(i, 0), value(i, 1), value(i, 2)});
+    }
+
+    const Mat4x4f matrix = createMatrix(1);
+
+    // In place
+    transformPoints(matrix, points, points, Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        const Vec3f correctResult = matrix * Vec3f{value(i, 0), value(i, 1), value(i, 2)};
+        const Vec3f result = getVector(points, i);
+
+        for (uint8_t row = 0; row < 3; ++row) {
+            ASSERT_NEAR(result(row), correctResult(row), 0.0001f) << "i = " << i << ", row = " << static_cast<int>(row);
+        }
+    }
+}
+
+TEST(Batch, Multiply) {
+    std::vector<float> lhsData(16 * Count);
+    std::vector<float> rhsData(16 * Count);
+    const Mat4x4SoA<float> lhs{lhsData.data(), Count};
+    const Mat4x4SoA<float> rhs{rhsData.data(), Count};
+
+    for (size_t i = 0; i < Count; ++i) {
+        setMatrix(lhs, i, createMatrix(i));
+        setMatrix(rhs, i, createMatrix(i + 5));
+    }
+
+    // In place, over the left operand
+    multiply(lhs, rhs, lhs, Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        expectNear(getMatrix(lhs, i), createMatrix(i) * createMatrix(i + 5), 0.0001f);
+    }
+}
+
+TEST(Batch, LookAt) {
+    std::vector<float> eyeData(3 * Count);
+    std::vector<float> centerData(3 * Count);
+    std::vector<float> upData(3 * Count);
+    std::vector<float> resultData(16 * Count);
+
+    const Vec3SoA<float> eyes{eyeData.data(), Count};
+    const Vec3SoA<float> centers{centerData.data(), Count};
+    const Vec3SoA<float> ups{upData.data(), Count};
+    const Mat4x4SoA<float> result{resultData.data(), Count};
+
+    for (size_t i = 0; i < Count; ++i) {
+        setVector(eyes, i, {value(i, 0), value(i, 1), 5.0f + value(i, 2)});
+        setVector(centers, i, {value(i, 3), value(i, 4), value(i, 5)});
+        setVector(ups, i, {0.0f, 1.0f, 0.0f});
+    }
+
+    lookAt(eyes, centers, ups, result, Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        expectNear(getMatrix(result, i), Geometry::lookAt(getVector(eyes, i), getVector(centers, i), getVector(ups, i)), 0.0001f);
+    }
+}
+
+TEST(Batch, Perspective) {
+    std::vector<float> fovys(Count);
+    std::vector<float> aspects(Count);
+    std::vector<float> zNears(Count);
+    std::vector<float> zFars(Count);
+    std::vector<float> resultData(16 * Count);
+
+    const Mat4x4SoA<float> result{resultData.data(), Count};
+
+    for (size_t i = 0; i < Count; ++i) {
+        fovys[i] = Geometry::radians(30.0f + i);
+        aspects[i] = 1.0f + i * 0.1f;
+        zNears[i] = 0.1f * (i + 1);
+        zFars[i] = 100.0f + i;
+    }
+
+    perspective(fovys.data(), aspects.data(), zNears.data(), zFars.data(), result, Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        expectNear(getMatrix(result, i), Geometry::perspective(fovys[i], aspects[i], zNears[i], zFars[i]), 0.0001f);
+    }
+}
+
+TEST(Batch, Normalize) {
+    std::vector<float> data(4 * Count);
+    std::vector<float> resultData(4 * Count);
+
+    const QuatSoA<float> quaternions{data.data(), Count};
+    const QuatSoA<float> result{resultData.data(), Count};
+
+    for (size_t i = 0; i < Count; ++i) {
+        setQuaternion(quaternions, i, {1.0f + value(i, 0), value(i, 1), value(i, 2), value(i, 3)});
+    }
+
+    normalize(quaternions, result, Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        const Quatf correctResult = ::lug::Math::normalize(getQuaternion(quaternions, i));
+        const Quatf quaternion = getQuaternion(result, i);
+
+        for (size_t component = 0; component < 4; ++component) {
+            ASSERT_NEAR(quaternion[component], correctResult[component], 0.0001f) << "i = " << i << ", component = " << component;
+        }
+    }
+}
+
+} // Batch
+} // Math
+} // lug
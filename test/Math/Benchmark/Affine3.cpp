@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <lug/Math/Affine3.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::Math;
+
+// The transformations of the nodes and the cameras, with Affine3 against the 4x4 matrices
+
+namespace {
+
+constexpr size_t Count = 4096;
+constexpr size_t Rounds = 256;
+
+struct Trs {
+    Vec3f position;
+    Quatf rotation;
+    Vec3f scale;
+};
+
+std::vector<Trs> createTransformations() {
+    std::vector<Trs> transformations(Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        const float value = static_cast<float>(i % 17) * 0.25f;
+
+        transformations[i] = {
+            Vec3f{value, 1.f - value, 2.f * value},
+            Quatf(value, normalize(Vec3f{1.f, value, 0.5f})),
+            Vec3f{1.f + value, 1.f, 2.f - value * 0.1f}
+        };
+    }
+
+    return transformations;
+}
+
+template <typename Function>
+void run(const char* name, Function&& function) {
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t round = 0; round < Rounds; ++round) {
+            function();
+        }
+    });
+
+    lug::Benchmark::report(name, Count * Rounds, seconds);
+}
+
+}
+
+// Node::update
+TEST(BenchmarkAffine3, FromTRS) {
+    const std::vector<Trs> transformations = createTransformations();
+    std::vector<Mat4x4f> results(Count);
+
+    run("translate * rotation * scale, Mat4x4f", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            const Trs& trs = transformations[i];
+            results[i] = Geometry::translate(trs.position) * trs.rotation.transform() * Geometry::scale(trs.scale);
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Affine3f::fromTRS", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            const Trs& trs = transformations[i];
+            results[i] = Affine3f::fromTRS(trs.position, trs.rotation, trs.scale).toMatrix();
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+}
+
+// Camera::updateView
+TEST(BenchmarkAffine3, Inverse) {
+    const std::vector<Trs> transformations = createTransformations();
+    std::vector<Mat4x4f> matrices(Count);
+    std::vector<Affine3f> affines(Count);
+    std::vector<Mat4x4f> results(Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        const Trs& trs = transformations[i];
+        affines[i] = Affine3f::fromTRS(trs.position, trs.rotation, trs.scale);
+        matrices[i] = affines[i].toMatrix();
+    }
+
+    run("Mat4x4f inverse, generic", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = priv::inverse<float>(matrices[i]);
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Mat4x4f inverse, SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = matrices[i].inverse();
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Affine3f inverse", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = affines[i].inverse().toMatrix();
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+}
+
+TEST(BenchmarkAffine3, Composition) {
+    const std::vector<Trs> transformations = createTransformations();
+    std::vector<Mat4x4f> matrices(Count);
+    std::vector<Affine3f> affines(Count);
+    std::vector<Mat4x4f> matrixResults(Count);
+    std::vector<Affine3f> affineResults(Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        const Trs& trs = transformations[i];
+        affines[i] = Affine3f::fromTRS(trs.position, trs.rotation, trs.scale);
+        matrices[i] = affines[i].toMatrix();
+    }
+
+    run("Mat4x4f * Mat4x4f", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            matrixResults[i] = matrices[i] * matrices[Count - 1 - i];
+        }
+        lug::Benchmark::doNotOptimize(matrixResults);
+    });
+
+    run("Affine3f * Affine3f", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            affineResults[i] = affines[i] * affines[Count - 1 - i];
+        }
+        lug::Benchmark::doNotOptimize(affineResults);
+    });
+}
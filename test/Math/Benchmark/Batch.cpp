@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::Math;
+
+// The SoA kernels against a loop on the scalar versions with arrays of structures
+
+namespace {
+
+constexpr size_t Counts[] = {1000, 100000, 1000000};
+
+// About the same amount of work for each count
+size_t getRounds(size_t count) {
+    return std::max<size_t>(1, 4000000 / count);
+}
+
+template <typename Function>
+void run(const std::string& name, size_t count, Function&& function) {
+    const size_t rounds = getRounds(count);
+
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t round = 0; round < rounds; ++round) {
+            function();
+        }
+    });
+
+    lug::Benchmark::report((name + " x" + std::to_string(count)).c_str(), count * rounds, seconds);
+}
+
+}
+
+TEST(BenchmarkBatch, TransformPoints) {
+    const Mat4x4f matrix = Geometry::translate(Vec3f{1.f, 2.f, 3.f}) * Geometry::scale(Vec3f{2.f, 2.f, 2.f});
+
+    for (const size_t count : Counts) {
+        std::vector<Vec3f> points(count, Vec3f{1.f, 2.f, 3.f});
+        std::vector<Vec3f> results(count);
+
+        run("Mat4x4f * Vec3f, scalar", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = operator*<float>(matrix, points[i]);
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        run("Mat4x4f * Vec3f, SIMD one by one", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = matrix * points[i];
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        std::vector<float> pointData(3 * count, 1.f);
+        std::vector<float> resultData(3 * count);
+
+        run("Batch::transformPoints", count, [&]() {
+            Batch::transformPoints(matrix, Batch::Vec3SoA<float>{pointData.data(), count}, Batch::Vec3SoA<float>{resultData.data(), count}, count);
+            lug::Benchmark::doNotOptimize(resultData.data());
+        });
+    }
+}
+
+TEST(BenchmarkBatch, Multiply) {
+    const Mat4x4f matrix = Geometry::translate(Vec3f{1.f, 2.f, 3.f}) * Geometry::scale(Vec3f{2.f, 2.f, 2.f});
+
+    for (const size_t count : Counts) {
+        std::vector<Mat4x4f> matrices(count, matrix);
+        std::vector<Mat4x4f> results(count);
+
+        run("Mat4x4f * Mat4x4f, scalar", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = operator*<4, 4, 4, 4, float>(matrices[i], matrices[count - 1 - i]);
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        run("Mat4x4f * Mat4x4f, SIMD one by one", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = matrices[i] * matrices[count - 1 - i];
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        std::vector<float> lhsData(16 * count, 1.f);
+        std::vector<float> rhsData(16 * count, 2.f);
+        std::vector<float> resultData(16 * count);
+
+        run("Batch::multiply", count, [&]() {
+            Batch::multiply(
+                Batch::Mat4x4SoA<float>{lhsData.data(), count},
+                Batch::Mat4x4SoA<float>{rhsData.data(), count},
+                Batch::Mat4x4SoA<float>{resultData.data(), count},
+                count
+            );
+            lug::Benchmark::doNotOptimize(resultData.data());
+        });
+    }
+}
+
+TEST(BenchmarkBatch, Cameras) {
+    for (const size_t count : Counts) {
+        std::vector<Vec3f> eyes(count, Vec3f{1.f, 2.f, 5.f});
+        std::vector<Mat4x4f> results(count);
+
+        run("Geometry::lookAt, scalar", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = Geometry::lookAt(eyes[i], Vec3f{0.f, 0.f, 0.f}, Vec3f{0.f, 1.f, 0.f});
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        std::vector<float> eyeData(3 * count, 5.f);
+        std::vector<float> centerData(3 * count, 0.f);
+        std::vector<float> upData(3 * count, 1.f);
+        std::vector<float> resultData(16 * count);
+
+        run("Batch::lookAt", count, [&]() {
+            Batch::lookAt(
+                Batch::Vec3SoA<float>{eyeData.data(), count},
+                Batch::Vec3SoA<float>{centerData.data(), count},
+                Batch::Vec3SoA<float>{upData.data(), count},
+                Batch::Mat4x4SoA<float>{resultData.data(), count},
+                count
+            );
+            lug::Benchmark::doNotOptimize(resultData.data());
+        });
+
+        std::vector<float> fovys(count, 1.f);
+        std::vector<float> aspects(count, 1.5f);
+        std::vector<float> zNears(count, 0.1f);
+        std::vector<float> zFars(count, 100.f);
+
+        run("Geometry::perspective, scalar", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = Geometry::perspective(fovys[i], aspects[i], zNears[i], zFars[i]);
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        run("Batch::perspective", count, [&]() {
+            Batch::perspective(fovys.data(), aspects.data(), zNears.data(), zFars.data(), Batch::Mat4x4SoA<float>{resultData.data(), count}, count);
+            lug::Benchmark::doNotOptimize(resultData.data());
+        });
+    }
+}
+
+TEST(BenchmarkBatch, Normalize) {
+    for (const size_t count : Counts) {
+        std::vector<Quatf> quaternions(count, Quatf{1.f, 2.f, 3.f, 4.f});
+        std::vector<Quatf> results(count);
+
+        run("normalize(Quatf), scalar", count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = normalize(quaternions[i]);
+            }
+            lug::Benchmark::doNotOptimize(results.data());
+        });
+
+        std::vector<float> quaternionData(4 * count, 2.f);
+        std::vector<float> resultData(4 * count);
+
+        run("Batch::normalize", count, [&]() {
+            Batch::normalize(Batch::QuatSoA<float>{quaternionData.data(), count}, Batch::QuatSoA<float>{resultData.data(), count}, count);
+            lug::Benchmark::doNotOptimize(resultData.data());
+        });
+    }
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/ValArray.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::Math;
+
+// The expressions against the same chains with a temporary for each operation, as done before the expressions
+
+namespace {
+
+constexpr size_t Count = 4096;
+constexpr size_t Rounds = 256;
+
+constexpr size_t ArraySize = 1024;
+constexpr size_t ArrayRounds = 4096;
+
+std::vector<Mat4x4f> createMatrices(float offset) {
+    std::vector<Mat4x4f> matrices(Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        matrices[i] = Mat4x4f(static_cast<float>(i % 17) * 0.25f + offset);
+    }
+
+    return matrices;
+}
+
+template <typename Function>
+void run(const char* name, size_t count, size_t rounds, Function&& function) {
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t round = 0; round < rounds; ++round) {
+            function();
+        }
+    });
+
+    lug::Benchmark::report(name, count * rounds, seconds);
+}
+
+}
+
+TEST(BenchmarkExpression, Matrix4x4) {
+    const std::vector<Mat4x4f> a = createMatrices(1.f);
+    const std::vector<Mat4x4f> b = createMatrices(2.f);
+    const std::vector<Mat4x4f> c = createMatrices(3.f);
+    std::vector<Mat4x4f> results(Count);
+
+    run("Mat4x4f a * 2 + b - c / 4, temporaries", Count, Rounds, [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            const Mat4x4f scaled(a[i] * 2.f);
+            const Mat4x4f sum(scaled + b[i]);
+            const Mat4x4f divided(c[i] / 4.f);
+            results[i] = Mat4x4f(sum - divided);
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Mat4x4f a * 2 + b - c / 4, expression", Count, Rounds, [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = a[i] * 2.f + b[i] - c[i] / 4.f;
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+}
+
+TEST(BenchmarkExpression, ValArray) {
+    using Array = ValArray<ArraySize, float>;
+
+    const Array a(1.f);
+    const Array b(2.f);
+    const Array c(3.f);
+    Array result;
+
+    run("ValArray<1024> a * 2 + b - c / 4, temporaries", ArraySize, ArrayRounds, [&]() {
+        const Array scaled(a * 2.f);
+        const Array sum(scaled + b);
+        const Array divided(c / 4.f);
+        result = sum - divided;
+        lug::Benchmark::doNotOptimize(result);
+    });
+
+    run("ValArray<1024> a * 2 + b - c / 4, expression", ArraySize, ArrayRounds, [&]() {
+        result = a * 2.f + b - c / 4.f;
+        lug::Benchmark::doNotOptimize(result);
+    });
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Vector.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::Math;
+
+// The SIMD versions (see lug/Math/Simd.hpp) against the generic templates, called explicitly
+
+namespace {
+
+constexpr size_t Count = 4096;
+constexpr size_t Rounds = 256;
+
+std::vector<Mat4x4f> createMatrices() {
+    std::vector<Mat4x4f> matrices(Count);
+
+    for (size_t i = 0; i < Count; ++i) {
+        const float value = static_cast<float>(i % 17) * 0.25f;
+
+        // Invertible, as the transformations of the nodes
+        matrices[i] = Mat4x4f{
+            1.f + value, 0.2f, 0.3f, value,
+            0.1f, 2.f + value, 0.5f, 1.f,
+            0.3f, 0.4f, 3.f + value, -value,
+            0.f, 0.f, 0.f, 1.f
+        };
+    }
+
+    return matrices;
+}
+
+template <typename Function>
+void run(const char* name, Function&& function) {
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t round = 0; round < Rounds; ++round) {
+            function();
+        }
+    });
+
+    lug::Benchmark::report(name, Count * Rounds, seconds);
+}
+
+}
+
+TEST(BenchmarkMatrix4x4, Multiplication) {
+    const std::vector<Mat4x4f> matrices = createMatrices();
+    std::vector<Mat4x4f> results(Count);
+
+    run("Mat4x4f * Mat4x4f, generic", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = operator*<4, 4, 4, 4, float>(matrices[i], matrices[Count - 1 - i]);
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Mat4x4f * Mat4x4f, SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = matrices[i] * matrices[Count - 1 - i];
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+}
+
+TEST(BenchmarkMatrix4x4, Inverse) {
+    const std::vector<Mat4x4f> matrices = createMatrices();
+    std::vector<Mat4x4f> results(Count);
+
+    run("Mat4x4f inverse, generic", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = priv::inverse<float>(matrices[i]);
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Mat4x4f inverse, SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = matrices[i].inverse();
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+}
+
+TEST(BenchmarkMatrix4x4, Transpose) {
+    const std::vector<Mat4x4f> matrices = createMatrices();
+    std::vector<Mat4x4f> results(Count);
+
+    run("Mat4x4f transpose, generic", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = priv::transpose<4, 4, float>(matrices[i]);
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+
+    run("Mat4x4f transpose, SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            results[i] = matrices[i].transpose();
+        }
+        lug::Benchmark::doNotOptimize(results);
+    });
+}
+
+TEST(BenchmarkMatrix4x4, TransformPoint) {
+    const std::vector<Mat4x4f> matrices = createMatrices();
+    std::vector<Vec3f> points(Count, Vec3f{1.f, 2.f, 3.f});
+    std::vector<Vec4f> vectors(Count, Vec4f{1.f, 2.f, 3.f, 1.f});
+
+    run("Mat4x4f * Vec4f, generic", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            vectors[i] = operator*<4, float>(matrices[i], vectors[i]);
+        }
+        lug::Benchmark::doNotOptimize(vectors);
+    });
+
+    run("Mat4x4f * Vec4f, SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            vectors[i] = matrices[i] * vectors[i];
+        }
+        lug::Benchmark::doNotOptimize(vectors);
+    });
+
+    run("Mat4x4f * Vec3f, generic", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            points[i] = operator*<float>(matrices[i], points[i]);
+        }
+        lug::Benchmark::doNotOptimize(points);
+    });
+
+    run("Mat4x4f * Vec3f, SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i) {
+            points[i] = matrices[i] * points[i];
+        }
+        lug::Benchmark::doNotOptimize(points);
+    });
+}
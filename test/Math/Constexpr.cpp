@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <type_traits>
+#include <lug/Math/Constant.hpp>
+#include <lug/Math/Constexpr.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <lug/Math/Geometry/Trigonometry.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+constexpr bool near(T lhs, T rhs, T epsilon = T(1e-5)) {
+    return (lhs > rhs ? lhs - rhs : rhs - lhs) <= epsilon;
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T>
+constexpr bool near(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs, T epsilon = T(1e-5)) {
+    for (size_t i = 0; i < Rows * Columns; ++i) {
+        if (!near(lhs.getValues()[i], rhs.getValues()[i], epsilon)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// In C++14 the non-const accessors of std::array aren't constexpr, so the elements
+// of the temporaries are read through constants
+constexpr Mat3x3i matrixA{
+    1, 2, 3,
+    0, 1, 4,
+    5, 6, 0
+};
+
+}
+
+TEST(Constexpr, Matrix) {
+    // The initializer list is row major
+    static_assert(matrixA(0, 1) == 2, "");
+    static_assert(matrixA(1, 0) == 0, "");
+    static_assert(matrixA.getValues()[1] == 0, "");
+
+    constexpr Mat3x3i identity = Mat3x3i::identity();
+    constexpr Mat3x3i transpose = matrixA.transpose();
+
+    static_assert(identity(1, 1) == 1 && identity(1, 2) == 0, "");
+    static_assert(transpose(1, 0) == 2, "");
+    static_assert(matrixA.det() == 1, "");
+
+    static_assert(matrixA * Mat3x3i::identity() == matrixA, "");
+    static_assert(matrixA * matrixA == Mat3x3i{
+         16, 22, 11,
+         20, 25,  4,
+          5, 16, 39
+    }, "");
+    static_assert(matrixA + matrixA == matrixA * 2, "");
+    static_assert(-matrixA + matrixA == Mat3x3i(0), "");
+
+    constexpr Mat3x3f inverse = Mat3x3f{
+        1.f, 2.f, 3.f,
+        0.f, 1.f, 4.f,
+        5.f, 6.f, 0.f
+    }.inverse();
+
+    static_assert(near(inverse, Mat3x3f{
+        -24.f,  18.f,  5.f,
+         20.f, -15.f, -4.f,
+         -5.f,   4.f,  1.f
+    }), "");
+
+    // Same values at runtime
+    const Mat3x3f runtimeInverse = Mat3x3f{
+        1.f, 2.f, 3.f,
+        0.f, 1.f, 4.f,
+        5.f, 6.f, 0.f
+    }.inverse();
+
+    ASSERT_TRUE(near(inverse, runtimeInverse));
+}
+
+TEST(Constexpr, Mat4x4f) {
+    // The SIMD paths of Mat4x4f are skipped in constant expressions
+#if defined(LUG_MATH_CONSTANT_EVALUATION)
+    constexpr Mat4x4f matrix{
+        2.f, 0.f, 0.f, 1.f,
+        0.f, 4.f, 0.f, 2.f,
+        0.f, 0.f, 8.f, 3.f,
+        0.f, 0.f, 0.f, 1.f
+    };
+
+    static_assert(matrix * Mat4x4f::identity() == matrix, "");
+    constexpr Mat4x4f transpose = matrix.transpose();
+
+    static_assert(transpose(3, 0) == 1.f, "");
+    static_assert(near(matrix * matrix.inverse(), Mat4x4f::identity()), "");
+    static_assert(matrix * Vec4f{1.f, 1.f, 1.f, 1.f} == Vec4f{3.f, 6.f, 11.f, 1.f}, "");
+
+    ASSERT_EQ(matrix * matrix.inverse(), Mat4x4f::identity());
+#endif
+}
+
+TEST(Constexpr, Vector) {
+    constexpr Vec3i x{1, 0, 0};
+    constexpr Vec3i y{0, 1, 0};
+
+    static_assert(cross(x, y) == Vec3i{0, 0, 1}, "");
+    static_assert(dot(x, y) == 0, "");
+    constexpr Vec4i extended(x, 1);
+    constexpr Vec2i truncated(x);
+
+    static_assert(extended.w() == 1, "");
+    static_assert(truncated.x() == 1, "");
+    static_assert(Vec3i(x + y * 2).squaredLength() == 5, "");
+
+#if defined(LUG_MATH_CONSTANT_EVALUATION)
+    static_assert(Vec3f{3.f, 4.f, 0.f}.length() == 5.f, "");
+    static_assert(near(normalize(Vec3f{0.f, 2.f, 0.f}), Vec3f{0.f, 1.f, 0.f}), "");
+#endif
+}
+
+TEST(Constexpr, Trigonometry) {
+    static_assert(near(pi<double>(), 3.14159265358979323846), "");
+    static_assert(near(Geometry::radians(180.), pi<double>()), "");
+
+#if defined(LUG_MATH_CONSTANT_EVALUATION)
+    static_assert(near(Constexpr::sqrt(2.), 1.41421356237309504880, 1e-12), "");
+    static_assert(near(Geometry::sin(pi<double>() / 6.), 0.5, 1e-12), "");
+    static_assert(near(Geometry::cos(-pi<double>() / 3.), 0.5, 1e-12), "");
+    static_assert(near(Geometry::tan(pi<double>() / 4.), 1., 1e-12), "");
+
+    // The series agree with the std functions
+    for (double angle = -10.; angle < 10.; angle += 0.1) {
+        ASSERT_NEAR(Constexpr::sin(angle), std::sin(angle), 1e-12);
+        ASSERT_NEAR(Constexpr::cos(angle), std::cos(angle), 1e-12);
+    }
+#endif
+}
+
+TEST(Constexpr, Transform) {
+    constexpr Mat4x4i translation = Geometry::translate(Vec3i{1, 2, 3});
+    constexpr Mat4x4i scaling = Geometry::scale(Vec3i{1, 2, 3});
+
+    static_assert(translation(1, 3) == 2, "");
+    static_assert(scaling(2, 2) == 3, "");
+    static_assert(Geometry::translate(Vec3i{1, 2, 3}) * Vec4i{1, 1, 1, 1} == Vec4i{2, 3, 4, 1}, "");
+    static_assert(Geometry::ortho(-1., 1., -1., 1., 0., 1.) == Mat4x4d{
+        1., 0.,  0., 0.,
+        0., 1.,  0., 0.,
+        0., 0., -1., 0.,
+        0., 0.,  0., 1.
+    }, "");
+
+#if defined(LUG_MATH_CONSTANT_EVALUATION)
+    constexpr Mat4x4d projection = Geometry::perspective(Geometry::radians(90.), 16. / 9., 0.1, 100.);
+    static_assert(near(projection(1, 1), 1., 1e-12), "");
+
+    const Mat4x4d runtimeProjection = Geometry::perspective(Geometry::radians(90.), 16. / 9., 0.1, 100.);
+
+    for (size_t i = 0; i < 16; ++i) {
+        ASSERT_NEAR(projection.getValues()[i], runtimeProjection.getValues()[i], 1e-12);
+    }
+
+    constexpr Mat4x4d rotation = Geometry::rotate(pi<double>() / 2., Vec3d{0., 0., 2.});
+    static_assert(near(rotation(2, 2), 1., 1e-12) && near(rotation(0, 0), 0., 1e-12), "");
+
+    ASSERT_TRUE(near(rotation, Geometry::rotate(pi<double>() / 2., Vec3d{0., 0., 1.}), 1e-12));
+#endif
+}
+
+TEST(Constexpr, Quaternion) {
+    static_assert(Quatd::identity().transform() == Mat4x4d::identity(), "");
+    static_assert(conjugate(Quatd{1., 2., 3., 4.}) == Quatd{1., -2., -3., -4.}, "");
+    static_assert(dot(Quatd{1., 2., 3., 4.}, Quatd{1., 1., 1., 1.}) == 10., "");
+    static_assert((Quatd{0., 1., 0., 0.} * Quatd{0., 0., 1., 0.}) == Quatd{0., 0., 0., 1.}, "");
+
+#if defined(LUG_MATH_CONSTANT_EVALUATION)
+    constexpr Quatd rotation{pi<double>() / 2., Vec3d{0., 0., 1.}};
+    constexpr Mat4x4d matrix = rotation.transform();
+
+    static_assert(near(matrix(1, 0), 1., 1e-12) && near(matrix(0, 1), -1., 1e-12), "");
+    constexpr Quatd fromMatrix = Quatd::fromRotationMatrix(matrix);
+
+    static_assert(near(fromMatrix.w(), rotation.w(), 1e-12), "");
+    static_assert(near(rotation.length(), 1., 1e-12), "");
+
+    const Quatd runtimeRotation{pi<double>() / 2., Vec3d{0., 0., 1.}};
+
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_NEAR(rotation[i], runtimeRotation[i], 1e-12);
+    }
+#endif
+}
+
+} // Math
+} // lug
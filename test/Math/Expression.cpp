@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <type_traits>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/ValArray.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+// Counts the default constructions, i.e. the arrays created by an expression
+struct Counted {
+    static size_t constructions;
+
+    Counted() {
+        ++constructions;
+    }
+
+    Counted(float newValue) : value(newValue) {}
+
+    float value{0.f};
+};
+
+size_t Counted::constructions = 0;
+
+Counted operator+(const Counted& lhs, const Counted& rhs) {
+    return {lhs.value + rhs.value};
+}
+
+Counted operator-(const Counted& lhs, const Counted& rhs) {
+    return {lhs.value - rhs.value};
+}
+
+Counted operator*(const Counted& lhs, const Counted& rhs) {
+    return {lhs.value * rhs.value};
+}
+
+Counted operator/(const Counted& lhs, const Counted& rhs) {
+    return {lhs.value / rhs.value};
+}
+
+const Mat4x4f matrixA{
+    2.f, -6.f, 8.f,  3.f,
+    7.f,  8.f, 2.f,  4.f,
+    4.f,  3.f, 7.f, -8.f,
+    6.f, -4.f, 1.f,  7.f
+};
+
+const Mat4x4f matrixB{
+     1.f,  5.f, 4.f,  4.f,
+    -7.f,  3.f, 6.f,  3.f,
+     5.f,  2.f, 8.f,  0.f,
+     6.f, -1.f, 7.f, -4.f
+};
+
+}
+
+TEST(Expression, Laziness) {
+    // The operators build expressions, evaluated when assigned to a matrix
+    ASSERT_FALSE((std::is_same<decltype(matrixA + matrixB), Mat4x4f>::value));
+    ASSERT_FALSE((std::is_same<decltype(matrixA * 2.f - matrixB), Mat4x4f>::value));
+    ASSERT_FALSE((std::is_same<decltype(-matrixA), Mat4x4f>::value));
+
+    // The products are eager
+    ASSERT_TRUE((std::is_same<decltype(matrixA * matrixB), Mat4x4f>::value));
+
+    // The expressions don't change the layout of the matrices
+    ASSERT_EQ(sizeof(Mat4x4f), 16 * sizeof(float));
+    ASSERT_EQ(sizeof(Vec3f), 3 * sizeof(float));
+}
+
+TEST(Expression, NoTemporaries) {
+    const ValArray<8, Counted> a(Counted(2.f));
+    const ValArray<8, Counted> b(Counted(3.f));
+
+    Counted::constructions = 0;
+
+    const ValArray<8, Counted> result = a + b * Counted(2.f) - a / b + Counted(1.f);
+
+    // The elements of the result are built in place, no temporary array
+    ASSERT_EQ(Counted::constructions, 0u);
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        ASSERT_FLOAT_EQ(result[i].value, 2.f + 3.f * 2.f - 2.f / 3.f + 1.f);
+    }
+}
+
+TEST(Expression, Evaluation) {
+    // Compared to the same computation with the compound operators
+    Mat4x4f correctResult{matrixA};
+    correctResult *= 2.f;
+    correctResult -= matrixB;
+    correctResult += 1.f;
+    correctResult /= 4.f;
+
+    const Mat4x4f result = (matrixA * 2.f - matrixB + 1.f) / 4.f;
+
+    ASSERT_EQ(result, correctResult);
+    ASSERT_EQ((matrixA * 2.f - matrixB + 1.f) / 4.f, correctResult);
+
+    Mat4x4f negation{matrixA};
+    negation *= -1.f;
+
+    ASSERT_EQ(-matrixA, negation);
+    ASSERT_EQ(1.f - matrixA, -(matrixA - 1.f));
+    ASSERT_EQ(2.f * matrixA, matrixA + matrixA);
+    ASSERT_EQ((matrixA + matrixB)(1, 2), matrixA(1, 2) + matrixB(1, 2));
+}
+
+TEST(Expression, Aliasing) {
+    Mat4x4f result{matrixA};
+
+    // Each element only depends on the elements at the same position
+    result = result * 2.f + result;
+
+    ASSERT_EQ(result, matrixA * 3.f);
+}
+
+TEST(Expression, Methods) {
+    const Mat4x4f sum = matrixA + matrixB;
+
+    // Evaluated, then the methods of the matrix
+    ASSERT_EQ((matrixA + matrixB).inverse(), sum.inverse());
+    ASSERT_EQ((matrixA + matrixB).transpose(), sum.transpose());
+    ASSERT_EQ((matrixA + matrixB).det(), sum.det());
+
+    const Mat2x3f rectangle{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+    ASSERT_EQ((rectangle * 2.f).transpose(), Mat3x2f(rectangle.transpose() * 2.f));
+
+    ASSERT_EQ((-Mat2x2f{1.f, 2.f, 3.f, 4.f}).det(), -2.f);
+}
+
+TEST(Expression, Product) {
+    // The operands of a product are evaluated once
+    ASSERT_EQ((matrixA + matrixB) * (matrixA - matrixB), Mat4x4f(matrixA + matrixB) * Mat4x4f(matrixA - matrixB));
+    ASSERT_EQ((matrixA * 2.f) / Mat4x4f::identity(), matrixA * 2.f);
+}
+
+TEST(Expression, Vector) {
+    const Vec3f a{1.f, 2.f, 3.f};
+    const Vec3f b{4.f, -5.f, 6.f};
+
+    const Vec3f result = a * 2.f + b;
+
+    ASSERT_EQ(result, (Vec3f{6.f, -1.f, 12.f}));
+    ASSERT_FLOAT_EQ(Vec3f(a - b).length(), std::sqrt(9.f + 49.f + 9.f));
+
+    Vec3f vector{a};
+    vector = vector - b;
+
+    ASSERT_EQ(vector, (Vec3f{-3.f, 7.f, -3.f}));
+    ASSERT_FLOAT_EQ(dot(a, b), 12.f);
+}
+
+} // Math
+} // lug
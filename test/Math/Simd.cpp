@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Simd.hpp>
+#include <lug/Math/Vector.hpp>
+
+// The SIMD versions are compared to the generic templates, called explicitly
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+const Mat4x4f matrixA{
+    2.f, -6.f, 8.f,  3.f,
+    7.f,  8.f, 2.f,  4.f,
+    4.f,  3.f, 7.f, -8.f,
+    6.f, -4.f, 1.f,  7.f
+};
+
+const Mat4x4f matrixB{
+     1.f,  5.f, 4.f,  4.f,
+    -7.f,  3.f, 6.f,  3.f,
+     5.f,  2.f, 8.f,  0.f,
+     6.f, -1.f, 7.f, -4.f
+};
+
+void expectNear(const Mat4x4f& result, const Mat4x4f& correctResult, float epsilon) {
+    for (uint8_t row = 0; row < result.getRows(); ++row) {
+        for (uint8_t col = 0; col < result.getColumns(); ++col) {
+            ASSERT_NEAR(result(row, col), correctResult(row, col), epsilon)
+                << "row = " << static_cast<int>(row) << "\n"
+                << "col = " << static_cast<int>(col);
+        }
+    }
+}
+
+}
+
+TEST(Simd, Alignment) {
+    ASSERT_EQ(alignof(Mat4x4f), 16u);
+    ASSERT_EQ(alignof(Vec4f), 16u);
+
+    // The layouts don't change
+    ASSERT_EQ(sizeof(Mat4x4f), 16 * sizeof(float));
+    ASSERT_EQ(sizeof(Vec4f), 4 * sizeof(float));
+    ASSERT_EQ(sizeof(Vec3f), 3 * sizeof(float));
+}
+
+TEST(Simd, Multiplication) {
+    expectNear(matrixA * matrixB, operator*<4, 4, 4, 4, float>(matrixA, matrixB), 0.0001f);
+    expectNear(matrixB * matrixA, operator*<4, 4, 4, 4, float>(matrixB, matrixA), 0.0001f);
+
+    Mat4x4f matrix{matrixA};
+    matrix *= matrixB;
+
+    expectNear(matrix, operator*<4, 4, 4, 4, float>(matrixA, matrixB), 0.0001f);
+}
+
+TEST(Simd, Transpose) {
+    expectNear(matrixA.transpose(), priv::transpose<4, 4, float>(matrixA), 0.0f);
+
+    ASSERT_EQ(matrixA.transpose()(0, 1), matrixA(1, 0));
+    ASSERT_EQ(matrixA.transpose()(3, 2), matrixA(2, 3));
+}
+
+TEST(Simd, Inverse) {
+    expectNear(matrixA.inverse(), priv::inverse<float>(matrixA), 0.0001f);
+    expectNear(matrixB.inverse(), priv::inverse<float>(matrixB), 0.0001f);
+    expectNear(matrixA * matrixA.inverse(), Mat4x4f::identity(), 0.0001f);
+
+    // Affine transformation, as the view matrices
+    const Mat4x4f transform{
+        0.f, -2.f, 0.f, 3.f,
+        2.f,  0.f, 0.f, 4.f,
+        0.f,  0.f, 2.f, 5.f,
+        0.f,  0.f, 0.f, 1.f
+    };
+
+    expectNear(transform.inverse(), priv::inverse<float>(transform), 0.0001f);
+}
+
+TEST(Simd, Vectors) {
+    const Vec4f vector4{1.f, -2.f, 3.f, 0.5f};
+    const Vec3f vector3{1.f, -2.f, 3.f};
+
+    const Vec4f result4 = matrixA * vector4;
+    const Vec4f correctResult4 = operator*<4, float>(matrixA, vector4);
+
+    for (uint8_t row = 0; row < 4; ++row) {
+        ASSERT_NEAR(result4(row), correctResult4(row), 0.0001f) << "row = " << static_cast<int>(row);
+        ASSERT_NEAR((vector4 * matrixA)(row), correctResult4(row), 0.0001f) << "row = " << static_cast<int>(row);
+    }
+
+    // Transformation of a point, without division by w
+    const Vec3f result3 = matrixA * vector3;
+    const Vec4f correctResult3 = operator*<4, float>(matrixA, Vec4f{vector3, 1.f});
+
+    for (uint8_t row = 0; row < 3; ++row) {
+        ASSERT_NEAR(result3(row), correctResult3(row), 0.0001f) << "row = " << static_cast<int>(row);
+        ASSERT_NEAR((vector3 * matrixA)(row), correctResult3(row), 0.0001f) << "row = " << static_cast<int>(row);
+    }
+}
+
+TEST(Simd, Operations) {
+    const float values[4] = {1.f, 2.f, 3.f, 4.f};
+    float result[4];
+
+    Simd::store(result, Simd::shuffle<3, 2, 1, 0>(Simd::load(values), Simd::splat(5.f)));
+    ASSERT_EQ(result[0], 4.f);
+    ASSERT_EQ(result[1], 3.f);
+    ASSERT_EQ(result[2], 5.f);
+    ASSERT_EQ(result[3], 5.f);
+
+    ASSERT_EQ(Simd::sum(Simd::load(values)), 10.f);
+    ASSERT_EQ(Simd::dot4(Simd::load(values), Simd::load(values)), 30.f);
+    ASSERT_EQ(Simd::getX(Simd::broadcast<2>(Simd::load(values))), 3.f);
+
+    Simd::store(result, Simd::cross3(Simd::set(1.f, 0.f, 0.f, 0.f), Simd::set(0.f, 1.f, 0.f, 0.f)));
+    ASSERT_EQ(result[0], 0.f);
+    ASSERT_EQ(result[1], 0.f);
+    ASSERT_EQ(result[2], 1.f);
+    ASSERT_EQ(result[3], 0.f);
+}
+
+} // Math
+} // lug
@@ -0,0 +1,306 @@
+#include <lug/System/Logger/AsyncQueue.hpp>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+namespace {
+
+constexpr const char* loggerName = "MyAsyncLogger";
+constexpr const char* handlerName = "MyAsyncHandler";
+
+// Keeps the messages and the thread handling them, can be paused to fill the queue
+class RecordHandler : public Handler {
+public:
+    RecordHandler(const std::string& name) : Handler(name) {}
+
+    void handle(const priv::Message& msg) override {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return !paused; });
+
+        messages.push_back(msg.raw.str());
+        threads.push_back(std::this_thread::get_id());
+    }
+
+    void flush() override {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        ++flushCount;
+        threads.push_back(std::this_thread::get_id());
+    }
+
+    void pause() {
+        std::lock_guard<std::mutex> lock(mutex);
+        paused = true;
+    }
+
+    void resume() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            paused = false;
+        }
+
+        condition.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool paused{false};
+
+    std::vector<std::string> messages;
+    std::vector<std::thread::id> threads;
+    size_t flushCount{0};
+};
+
+// Logs each message again through another logger, from the thread handling it
+class ForwardHandler : public Handler {
+public:
+    ForwardHandler(const std::string& name, Logger* target) : Handler(name), target(target) {}
+
+    void handle(const priv::Message& msg) override {
+        for (int i = 0; i < 10; ++i) {
+            target->debug("{} {}", msg.raw.str(), i);
+        }
+    }
+
+    void flush() override {}
+
+    Logger* target;
+};
+
+}
+
+TEST(AsyncQueue, BackgroundThread) {
+    Logger* logger = makeLogger(loggerName);
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+
+    {
+        AsyncQueue queue(16);
+        logger->setAsyncQueue(&queue);
+
+        for (int i = 0; i < 100; ++i) {
+            logger->debug("Message {}", i);
+        }
+
+        logger->flush();
+        queue.wait();
+
+        ASSERT_EQ(queue.getCapacity(), 16u);
+        ASSERT_EQ(queue.getDroppedCount(), 0u);
+        ASSERT_EQ(handler->messages.size(), 100u);
+        ASSERT_EQ(handler->flushCount, 1u);
+
+        // In order, and never on the calling thread
+        for (size_t i = 0; i < handler->messages.size(); ++i) {
+            ASSERT_EQ(handler->messages[i], "Message " + std::to_string(i));
+        }
+
+        for (const std::thread::id& id : handler->threads) {
+            ASSERT_NE(id, std::this_thread::get_id());
+        }
+
+        logger->setAsyncQueue(nullptr);
+    }
+
+    // Synchronous again
+    logger->debug("Sync");
+    ASSERT_EQ(handler->messages.back(), "Sync");
+    ASSERT_EQ(handler->threads.back(), std::this_thread::get_id());
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncQueue, LongMessage) {
+    Logger* logger = makeLogger(loggerName);
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+
+    const std::string longText(AsyncQueue::InlineSize * 3 + 7, 'x');
+
+    {
+        AsyncQueue queue(4);
+        logger->setAsyncQueue(&queue);
+
+        logger->debug("{}", longText);
+        logger->debug(std::string(AsyncQueue::InlineSize, 'y'));
+
+        queue.wait();
+        logger->setAsyncQueue(nullptr);
+    }
+
+    ASSERT_EQ(handler->messages.size(), 2u);
+    ASSERT_EQ(handler->messages[0], longText);
+    ASSERT_EQ(handler->messages[1], std::string(AsyncQueue::InlineSize, 'y'));
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncQueue, OverflowDrop) {
+    Logger* logger = makeLogger(loggerName);
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+
+    {
+        AsyncQueue queue(4, OverflowPolicy::Drop);
+        logger->setAsyncQueue(&queue);
+
+        handler->pause();
+        for (int i = 0; i < 100; ++i) {
+            logger->debug("Message {}", i);
+        }
+        handler->resume();
+
+        queue.wait();
+
+        // At most the capacity, plus the one being handled
+        ASSERT_GE(queue.getDroppedCount(), 100u - 5u);
+        ASSERT_EQ(handler->messages.size() + queue.getDroppedCount(), 100u);
+
+        // The first ones are kept
+        ASSERT_EQ(handler->messages.front(), "Message 0");
+
+        logger->setAsyncQueue(nullptr);
+    }
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncQueue, OverflowOverwrite) {
+    Logger* logger = makeLogger(loggerName);
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+
+    {
+        AsyncQueue queue(4, OverflowPolicy::Overwrite);
+        logger->setAsyncQueue(&queue);
+
+        handler->pause();
+        for (int i = 0; i < 100; ++i) {
+            logger->debug("Message {}", i);
+        }
+        handler->resume();
+
+        queue.wait();
+
+        ASSERT_GE(queue.getDroppedCount(), 100u - 5u);
+        ASSERT_EQ(handler->messages.size() + queue.getDroppedCount(), 100u);
+
+        // The last ones are kept
+        ASSERT_EQ(handler->messages.back(), "Message 99");
+
+        logger->setAsyncQueue(nullptr);
+    }
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncQueue, OverflowBlock) {
+    constexpr size_t threadCount = 4;
+    constexpr size_t messageCount = 1000;
+
+    Logger* logger = makeLogger(loggerName);
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+
+    {
+        AsyncQueue queue(8, OverflowPolicy::Block);
+        logger->setAsyncQueue(&queue);
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&, i]() {
+                for (size_t j = 0; j < messageCount; ++j) {
+                    logger->debug("{} {}", i, j);
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        queue.wait();
+
+        ASSERT_EQ(queue.getDroppedCount(), 0u);
+        ASSERT_EQ(handler->messages.size(), threadCount * messageCount);
+
+        // The messages of each thread stay in order
+        std::vector<size_t> next(threadCount, 0);
+        for (const std::string& message : handler->messages) {
+            const size_t thread = std::stoul(message.substr(0, message.find(' ')));
+            ASSERT_EQ(std::stoul(message.substr(message.find(' ') + 1)), next[thread]++);
+        }
+
+        logger->setAsyncQueue(nullptr);
+    }
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncQueue, OverflowBlockFromHandler) {
+    Logger* logger = makeLogger(loggerName);
+    Logger* forwardLogger = makeLogger("MyForwardLogger");
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+    forwardLogger->addHandler(makeHandler<ForwardHandler>("MyForwardHandler", logger));
+
+    {
+        // The handler of `forwardLogger` fills the queue from the background thread
+        AsyncQueue queue(2, OverflowPolicy::Block);
+        logger->setAsyncQueue(&queue);
+        forwardLogger->setAsyncQueue(&queue);
+
+        for (int i = 0; i < 10; ++i) {
+            forwardLogger->debug("Message {}", i);
+        }
+
+        queue.wait();
+
+        ASSERT_EQ(queue.getDroppedCount(), 0u);
+
+        forwardLogger->setAsyncQueue(nullptr);
+        logger->setAsyncQueue(nullptr);
+    }
+
+    // Some of them are handled in place, but none is lost
+    ASSERT_EQ(handler->messages.size(), 100u);
+
+    for (const std::thread::id& id : handler->threads) {
+        ASSERT_NE(id, std::this_thread::get_id());
+    }
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncQueue, DestructorHandlesTheRest) {
+    Logger* logger = makeLogger(loggerName);
+    RecordHandler* handler = makeHandler<RecordHandler>(handlerName);
+    logger->addHandler(handler);
+
+    {
+        AsyncQueue queue(256);
+        logger->setAsyncQueue(&queue);
+
+        for (int i = 0; i < 200; ++i) {
+            logger->debug("Message {}", i);
+        }
+    }
+
+    logger->setAsyncQueue(nullptr);
+    ASSERT_EQ(handler->messages.size(), 200u);
+
+    LoggingFacility::clear();
+}
+
+}
+}
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <lug/System/Logger/AsyncQueue.hpp>
+#include <lug/System/Logger/FileHandler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Logger;
+
+namespace {
+
+constexpr size_t MessageCount = 1000000;
+
+// One message per microsecond
+constexpr std::chrono::nanoseconds Interval{1000};
+
+const std::string fileName = "BenchmarkAsyncQueue.log";
+
+// Measures each call of the logger, the messages are sent at a fixed rate (or as fast as possible when late)
+void run(const char* name, Logger& logger) {
+    std::vector<uint64_t> latencies(MessageCount);
+
+    const auto begin = std::chrono::steady_clock::now();
+    auto next = begin;
+
+    for (size_t i = 0; i < MessageCount; ++i) {
+        while (std::chrono::steady_clock::now() < next) {}
+        next += Interval;
+
+        const auto start = std::chrono::steady_clock::now();
+        logger.info("Frame {} rendered in {} ms", i, 16.6);
+        latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    lug::Benchmark::report(name, MessageCount, seconds);
+    lug::Benchmark::reportLatency(name, latencies);
+}
+
+}
+
+TEST(BenchmarkAsyncQueue, CallerLatency) {
+    Handler* handler = makeHandler<FileHandler>("BenchmarkAsyncQueue", fileName, true);
+    handler->setLevels(Level::Info);
+
+    Logger logger("BenchmarkAsyncQueue");
+    logger.addHandler(handler);
+
+    run("Synchronous, FileHandler", logger);
+
+    {
+        AsyncQueue queue(8192, OverflowPolicy::Block);
+        logger.setAsyncQueue(&queue);
+
+        run("Asynchronous (block), FileHandler", logger);
+
+        queue.wait();
+        logger.setAsyncQueue(nullptr);
+    }
+
+    {
+        AsyncQueue queue(8192, OverflowPolicy::Drop);
+        logger.setAsyncQueue(&queue);
+
+        run("Asynchronous (drop), FileHandler", logger);
+
+        queue.wait();
+        std::printf("[ BENCHMARK ] %llu messages dropped\n", static_cast<unsigned long long>(queue.getDroppedCount()));
+        logger.setAsyncQueue(nullptr);
+    }
+
+    LoggingFacility::clear();
+    std::remove(fileName.c_str());
+}
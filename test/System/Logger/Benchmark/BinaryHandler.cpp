@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <lug/System/Logger/BinaryDecoder.hpp>
+#include <lug/System/Logger/BinaryHandler.hpp>
+#include <lug/System/Logger/FileHandler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Logger;
+
+namespace {
+
+// Three runs per measure, they all fit in the default capacity of the binary file
+constexpr size_t CallCount = 200000;
+
+const std::string textFileName = "BenchmarkBinaryHandler.log";
+const std::string binaryFileName = "BenchmarkBinaryHandler.blog";
+
+// Counts the decoded messages
+class NullHandler : public Handler {
+public:
+    NullHandler(const std::string& name) : Handler(name) {}
+
+    void handle(const priv::Message& msg) override {
+        lug::Benchmark::doNotOptimize(msg.formatted.size());
+    }
+
+    void flush() override {}
+};
+
+}
+
+TEST(BenchmarkBinaryHandler, CallCost) {
+    double textSeconds;
+    double binarySeconds;
+
+    {
+        FileHandler handler("BenchmarkTextHandler", textFileName, true);
+        handler.setPattern("[%H:%M:%S] [%l] %v\n");
+
+        Logger logger("BenchmarkBinaryHandler");
+        logger.addHandler(&handler);
+
+        textSeconds = lug::Benchmark::measure([&]() {
+            for (size_t i = 0; i < CallCount; ++i) {
+                logger.info("Frame {} rendered in {} ms by {}", i, 16.6, "renderer");
+            }
+        });
+    }
+
+    {
+        BinaryHandler handler("BenchmarkBinaryHandler", binaryFileName);
+
+        Logger logger("BenchmarkBinaryHandler");
+        logger.addHandler(&handler);
+
+        binarySeconds = lug::Benchmark::measure([&]() {
+            for (size_t i = 0; i < CallCount; ++i) {
+                logger.info("Frame {} rendered in {} ms by {}", i, 16.6, "renderer");
+            }
+        });
+
+        EXPECT_EQ(handler.getDroppedCount(), 0u);
+    }
+
+    NullHandler decoded("BenchmarkDecodedHandler");
+    decoded.setPattern("[%H:%M:%S] [%l] %v\n");
+
+    BinaryDecoder decoder;
+    ASSERT_TRUE(decoder.open(binaryFileName));
+
+    size_t decodedCount = 0;
+    const double decodeSeconds = lug::Benchmark::measure([&]() {
+        decodedCount = decoder.decode(decoded);
+    }, 1);
+
+    lug::Benchmark::report("FileHandler (formatted on the caller)", CallCount, textSeconds);
+    lug::Benchmark::report("BinaryHandler (arguments copied)", CallCount, binarySeconds);
+    lug::Benchmark::report("BinaryDecoder (offline)", decodedCount, decodeSeconds);
+
+    remove(textFileName.c_str());
+    remove(binaryFileName.c_str());
+    remove((binaryFileName + priv::BinaryFormat::TableExtension).c_str());
+
+    LoggingFacility::clear();
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <lug/System/Logger/Formatter.hpp>
+#include <lug/System/Logger/Message.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Logger;
+
+namespace {
+
+constexpr size_t MessageCount = 1000000;
+
+}
+
+TEST(BenchmarkFormatter, DefaultPattern) {
+    Formatter formatter("[%H:%M:%S][%l] %v\n");
+
+    priv::Message msg("BenchmarkFormatter", Level::Info);
+    msg.raw.write("Frame {} rendered in {} ms", 42, 16.6);
+
+    // One message per microsecond, so the time changes every million messages
+    const auto start = std::chrono::system_clock::now();
+
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < MessageCount; ++i) {
+            msg.time = start + std::chrono::microseconds(i);
+            formatter.format(msg);
+
+            lug::Benchmark::doNotOptimize(msg.formatted.size());
+        }
+    });
+
+    lug::Benchmark::report("Default pattern \"[%H:%M:%S][%l] %v\\n\"", MessageCount, seconds);
+}
+
+TEST(BenchmarkFormatter, FullDatePattern) {
+    Formatter formatter("%Y-%m-%d %H:%M:%S [%l] %v\n");
+
+    priv::Message msg("BenchmarkFormatter", Level::Warning);
+    msg.raw.write("Frame {} rendered in {} ms", 42, 16.6);
+
+    const auto start = std::chrono::system_clock::now();
+
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < MessageCount; ++i) {
+            msg.time = start + std::chrono::microseconds(i);
+            formatter.format(msg);
+
+            lug::Benchmark::doNotOptimize(msg.formatted.size());
+        }
+    });
+
+    lug::Benchmark::report("Full date \"%Y-%m-%d %H:%M:%S [%l] %v\\n\"", MessageCount, seconds);
+}
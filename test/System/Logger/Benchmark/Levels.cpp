@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/Message.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Logger;
+
+namespace {
+
+constexpr size_t CallCount = 1000000;
+
+// Formats the messages and throws them away
+class NullHandler : public Handler {
+public:
+    NullHandler(const std::string& name) : Handler(name) {}
+
+    void handle(const priv::Message& msg) override {
+        lug::Benchmark::doNotOptimize(msg.formatted.size());
+    }
+
+    void flush() override {}
+};
+
+}
+
+TEST(BenchmarkLoggerLevels, CallCost) {
+    Handler* handler = makeHandler<NullHandler>("BenchmarkLoggerLevels");
+    handler->setLevels(Level::Warning);
+
+    Logger logger("BenchmarkLoggerLevels");
+    logger.addHandler(handler);
+
+    const double disabledSeconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < CallCount; ++i) {
+            logger.debug("Frame {} rendered in {} ms", i, 16.6);
+        }
+    });
+
+    // What a disabled call used to cost: the message was formatted before the handlers were asked
+    const double formatFirstSeconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < CallCount; ++i) {
+            priv::Message msg(logger.getName(), Level::Debug);
+            msg.raw.write("Frame {} rendered in {} ms", i, 16.6);
+
+            if (handler->shouldLog(msg.level)) {
+                logger.handle(msg);
+            }
+        }
+    });
+
+    handler->setPattern("%v\n");
+
+    const double enabledSeconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < CallCount; ++i) {
+            logger.warn("Frame {} rendered in {} ms", i, 16.6);
+        }
+    });
+
+    lug::Benchmark::report("Disabled level, checked before formatting", CallCount, disabledSeconds);
+    lug::Benchmark::report("Disabled level, formatted then checked", CallCount, formatFirstSeconds);
+    lug::Benchmark::report("Enabled level (pattern \"%v\")", CallCount, enabledSeconds);
+
+    LoggingFacility::clear();
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/LoggingFacility.hpp>
+#include <lug/System/Logger/Message.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Logger;
+
+namespace {
+
+constexpr size_t CallCount = 2000000;
+constexpr size_t LoggerCount = 64;
+constexpr size_t ThreadCount = 4;
+
+class NullHandler : public Handler {
+public:
+    NullHandler(const std::string& name) : Handler(name) {}
+
+    void handle(const priv::Message& msg) override {
+        lug::Benchmark::doNotOptimize(msg.raw.size());
+    }
+
+    void flush() override {}
+};
+
+}
+
+TEST(BenchmarkLoggingFacility, Lookup) {
+    for (size_t i = 0; i < LoggerCount; ++i) {
+        makeLogger("BenchmarkLogger" + std::to_string(i));
+    }
+
+    const std::string name = "BenchmarkLogger42";
+
+    // What a thread-safe lookup costs with a lock around the map
+    std::mutex mutex;
+    std::unordered_map<std::string, Logger*> lockedMap;
+    lockedMap[name] = LoggingFacility::getLogger(name);
+
+    const double lockedSeconds = lug::Benchmark::measureThreads(ThreadCount, [&](size_t) {
+        for (size_t i = 0; i < CallCount / ThreadCount; ++i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            lug::Benchmark::doNotOptimize(lockedMap[name]);
+        }
+    });
+
+    const double lookupSeconds = lug::Benchmark::measureThreads(ThreadCount, [&](size_t) {
+        for (size_t i = 0; i < CallCount / ThreadCount; ++i) {
+            lug::Benchmark::doNotOptimize(LoggingFacility::getLogger(name));
+        }
+    });
+
+    const double handleSeconds = lug::Benchmark::measureThreads(ThreadCount, [&](size_t) {
+        LoggerHandle handle(name);
+
+        for (size_t i = 0; i < CallCount / ThreadCount; ++i) {
+            lug::Benchmark::doNotOptimize(handle.get());
+        }
+    });
+
+    lug::Benchmark::report("Locked map lookup", CallCount, lockedSeconds);
+    lug::Benchmark::report("LoggingFacility::getLogger (snapshot)", CallCount, lookupSeconds);
+    lug::Benchmark::report("LoggerHandle::get (cached)", CallCount, handleSeconds);
+
+    LoggingFacility::clear();
+}
+
+TEST(BenchmarkLoggingFacility, Dispatch) {
+    constexpr size_t HandlerCount = 4;
+
+    Logger logger("BenchmarkLoggingFacility");
+    std::set<Handler*> handlerSet;
+
+    for (size_t i = 0; i < HandlerCount; ++i) {
+        Handler* handler = makeHandler<NullHandler>("BenchmarkHandler" + std::to_string(i));
+        logger.addHandler(handler);
+        handlerSet.insert(handler);
+    }
+
+    priv::Message msg(logger.getName(), Level::Info);
+    msg.raw << "message";
+
+    // The dispatch before the handlers were copied in a flat array
+    const double setSeconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < CallCount; ++i) {
+            for (auto& handler : handlerSet) {
+                if (handler->shouldLog(msg.level)) {
+                    handler->handle(msg);
+                }
+            }
+        }
+    });
+
+    const double arraySeconds = lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < CallCount; ++i) {
+            for (Handler* handler : logger.getHandlers()) {
+                if (handler->shouldLog(msg.level)) {
+                    handler->handle(msg);
+                }
+            }
+        }
+    });
+
+    lug::Benchmark::report("Dispatch to 4 handlers, std::set", CallCount, setSeconds);
+    lug::Benchmark::report("Dispatch to 4 handlers, flat array", CallCount, arraySeconds);
+
+    LoggingFacility::clear();
+}
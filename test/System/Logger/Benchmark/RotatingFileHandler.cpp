@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <lug/System/Logger/FileHandler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/RotatingFileHandler.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Logger;
+
+namespace {
+
+constexpr size_t CallCount = 300000;
+
+// The loggers are flushed once per frame
+constexpr size_t MessagesPerFrame = 100;
+
+const std::string fileName = "BenchmarkRotatingFileHandler.log";
+
+template <typename Function>
+double measureLogger(Handler& handler, Function&& function) {
+    handler.setPattern("[%H:%M:%S] [%l] %v\n");
+
+    Logger logger("BenchmarkRotatingFileHandler");
+    logger.addHandler(&handler);
+
+    return lug::Benchmark::measure([&]() {
+        for (size_t i = 0; i < CallCount; ++i) {
+            logger.info("Frame {} rendered in {} ms", i, 16.6);
+            function(logger, i);
+        }
+    });
+}
+
+void flushEachFrame(Logger& logger, size_t i) {
+    if (i % MessagesPerFrame == MessagesPerFrame - 1) {
+        logger.flush();
+    }
+}
+
+void removeFiles(size_t backupCount) {
+    remove(fileName.c_str());
+
+    for (size_t i = 1; i <= backupCount; ++i) {
+        remove((fileName + "." + std::to_string(i)).c_str());
+    }
+}
+
+}
+
+TEST(BenchmarkRotatingFileHandler, Throughput) {
+    double fileSeconds;
+    double rotatingSeconds;
+    double rotatingNoFlushSeconds;
+    double rotatingSmallSeconds;
+    double syncEachFlushSeconds;
+
+    {
+        FileHandler handler("BenchmarkFileHandler", fileName, true);
+        fileSeconds = measureLogger(handler, flushEachFrame);
+    }
+    removeFiles(0);
+
+    {
+        RotatingFileHandler::Options options;
+        options.syncPolicy = SyncPolicy::Interval;
+
+        RotatingFileHandler handler("BenchmarkRotatingFileHandler", fileName, options);
+        rotatingSeconds = measureLogger(handler, flushEachFrame);
+    }
+    removeFiles(5);
+
+    {
+        RotatingFileHandler handler("BenchmarkRotatingFileHandler", fileName);
+        rotatingNoFlushSeconds = measureLogger(handler, [](Logger&, size_t) {});
+    }
+    removeFiles(5);
+
+    {
+        // About 20 rotations per run
+        RotatingFileHandler::Options options;
+        options.maxFileSize = 512 * 1024;
+        options.backupCount = 3;
+
+        RotatingFileHandler handler("BenchmarkRotatingFileHandler", fileName, options);
+        rotatingSmallSeconds = measureLogger(handler, flushEachFrame);
+    }
+    removeFiles(3);
+
+    {
+        // What the batching of the syncs saves
+        RotatingFileHandler::Options options;
+        options.syncPolicy = SyncPolicy::Interval;
+        options.syncInterval = std::chrono::milliseconds(0);
+
+        RotatingFileHandler handler("BenchmarkRotatingFileHandler", fileName, options);
+        syncEachFlushSeconds = measureLogger(handler, flushEachFrame);
+    }
+    removeFiles(5);
+
+    lug::Benchmark::report("FileHandler, flush per frame", CallCount, fileSeconds);
+    lug::Benchmark::report("RotatingFileHandler, flush per frame", CallCount, rotatingSeconds);
+    lug::Benchmark::report("RotatingFileHandler, flush interval only", CallCount, rotatingNoFlushSeconds);
+    lug::Benchmark::report("RotatingFileHandler, rotating every 512 KB", CallCount, rotatingSmallSeconds);
+    lug::Benchmark::report("RotatingFileHandler, fsync per frame", CallCount, syncEachFlushSeconds);
+}
@@ -0,0 +1,252 @@
+#include <lug/System/Logger/BinaryDecoder.hpp>
+#include <lug/System/Logger/BinaryHandler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/OstreamHandler.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "MockHandler.hpp"
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+using namespace ::testing;
+
+constexpr const char* loggerName = "MyTestLogger";
+constexpr const char* binaryHandlerName = "MyBinaryHandler";
+constexpr const char* textHandlerName = "MyTextHandler";
+const std::string binaryFileName = "LugdunumTestFile.blog";
+
+namespace {
+
+struct Point {
+    int x;
+    int y;
+};
+
+std::ostream& operator<<(std::ostream& os, const Point& point) {
+    return os << "(" << point.x << ", " << point.y << ")";
+}
+
+// All the levels by default
+std::string decode(const std::string& filename, const std::string& pattern, uint8_t levels = 0xFF) {
+    std::stringstream ss;
+    OstreamHandler handler("Decoded", ss);
+    handler.setPattern(pattern);
+    handler.setLevels(static_cast<Level>(levels));
+
+    BinaryDecoder decoder;
+    EXPECT_TRUE(decoder.open(filename));
+    decoder.decode(handler);
+
+    return ss.str();
+}
+
+void removeFiles(const std::string& filename) {
+    remove(filename.c_str());
+    remove((filename + priv::BinaryFormat::TableExtension).c_str());
+}
+
+}
+
+TEST(BinaryHandler, RoundTrip) {
+    {
+        Logger logger(loggerName);
+        BinaryHandler handler(binaryHandlerName, binaryFileName);
+        logger.addHandler(&handler);
+
+        const std::string name = "world";
+        const char* cString = "c string";
+
+        logger.info("Hello {}!", name);
+        logger.info("{} {} {} {}", 42, -7, 42u, 'c');
+        logger.warn("{} {} {}", 1.5f, 2.25, true);
+        logger.error("{0:x} {0} {1:>5}|{{escaped}}", 255, cString);
+        logger.fatal("Point {}", Point{1, 2});
+        logger.info(std::string("no args"));
+
+        EXPECT_EQ(handler.getDroppedCount(), 0u);
+    }
+
+    EXPECT_EQ(
+        decode(binaryFileName, "[%l] %v\n"),
+        "[INFO   ] Hello world!\n"
+        "[INFO   ] 42 -7 42 c\n"
+        "[WARNING] 1.5 2.25 true\n"
+        "[ERROR  ] ff 255 c string|{escaped}\n"
+        "[FATAL  ] Point (1, 2)\n"
+        "[INFO   ] no args\n"
+    );
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, DecodesLevelsOfHandler) {
+    {
+        Logger logger(loggerName);
+        BinaryHandler handler(binaryHandlerName, binaryFileName);
+        logger.addHandler(&handler);
+
+        logger.debug("debug {}", 1);
+        logger.info("info {}", 2);
+        logger.error("error {}", 3);
+    }
+
+    EXPECT_EQ(decode(binaryFileName, "%v\n", static_cast<uint8_t>(Level::Info) | static_cast<uint8_t>(Level::Error)), "info 2\nerror 3\n");
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, DecodesLoggerNameAndTime) {
+    const auto before = std::chrono::system_clock::now();
+
+    {
+        Logger logger(loggerName);
+        BinaryHandler handler(binaryHandlerName, binaryFileName);
+        logger.addHandler(&handler);
+
+        logger.info("message");
+    }
+
+    MockHandler handler("Decoded");
+
+    EXPECT_CALL(handler, handle(AllOf(
+        Field(&priv::Message::loggerName, StrEq(loggerName)),
+        Field(&priv::Message::level, Level::Info),
+        Field(&priv::Message::time, AllOf(Ge(std::chrono::time_point_cast<std::chrono::system_clock::duration>(before)), Le(std::chrono::system_clock::now()))),
+        Field(&priv::Message::raw, Property(&fmt::MemoryWriter::c_str, StrEq("message")))
+    ))).Times(1);
+
+    BinaryDecoder decoder;
+    ASSERT_TRUE(decoder.open(binaryFileName));
+    EXPECT_EQ(decoder.decode(handler), 1u);
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, TextMessages) {
+    {
+        BinaryHandler handler(binaryHandlerName, binaryFileName);
+
+        priv::Message msg("Test", Level::Info);
+        msg.raw << "Hello {} world!";
+        handler.handle(msg);
+    }
+
+    EXPECT_EQ(decode(binaryFileName, "%v\n"), "Hello {} world!\n");
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, OnlyTextHandlersFormat) {
+    Logger* logger = makeLogger(loggerName);
+    BinaryHandler* binaryHandler = makeHandler<BinaryHandler>(binaryHandlerName, binaryFileName);
+    MockHandler* textHandler = makeHandler<MockHandler>(textHandlerName);
+
+    textHandler->setLevels(Level::Error);
+    logger->addHandler(binaryHandler);
+    logger->addHandler(textHandler);
+
+    EXPECT_CALL(*textHandler, handle(
+        Field(&priv::Message::raw, Property(&fmt::MemoryWriter::c_str, StrEq("error 2")))
+    )).Times(1);
+
+    logger->info("info {}", 1);
+    logger->error("error {}", 2);
+
+    EXPECT_GT(binaryHandler->getSize(), sizeof(priv::BinaryFormat::FileHeader));
+    LoggingFacility::clear();
+
+    EXPECT_EQ(decode(binaryFileName, "%v\n"), "info 1\nerror 2\n");
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, DropsWhenFull) {
+    {
+        Logger logger(loggerName);
+        BinaryHandler handler(binaryHandlerName, binaryFileName, 256);
+        logger.addHandler(&handler);
+
+        for (int i = 0; i < 100; ++i) {
+            logger.info("message {}", i);
+        }
+
+        EXPECT_LE(handler.getSize(), handler.getCapacity());
+        EXPECT_GT(handler.getDroppedCount(), 0u);
+    }
+
+    const std::string decoded = decode(binaryFileName, "%v\n");
+    EXPECT_EQ(decoded.compare(0, 20, "message 0\nmessage 1\n"), 0);
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, Threads) {
+    constexpr size_t threadCount = 4;
+    constexpr size_t messageCount = 1000;
+
+    {
+        BinaryHandler handler(binaryHandlerName, binaryFileName);
+
+        // One logger per thread, their names are registered concurrently
+        std::vector<std::unique_ptr<Logger>> loggers;
+        for (size_t i = 0; i < threadCount; ++i) {
+            loggers.push_back(std::make_unique<Logger>(loggerName + std::to_string(i)));
+            loggers.back()->addHandler(&handler);
+        }
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&, i]() {
+                for (size_t j = 0; j < messageCount; ++j) {
+                    if (j % 2) {
+                        loggers[i]->info("{} {}", i, j);
+                    } else {
+                        loggers[i]->info("{} {} even", i, j);
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(handler.getDroppedCount(), 0u);
+    }
+
+    // Every message is decoded once
+    std::istringstream decoded(decode(binaryFileName, "%v\n"));
+    std::set<std::string> lines;
+
+    for (std::string line; std::getline(decoded, line);) {
+        EXPECT_TRUE(lines.insert(line).second);
+    }
+
+    EXPECT_EQ(lines.size(), threadCount * messageCount);
+    EXPECT_EQ(lines.count("3 998 even"), 1u);
+    EXPECT_EQ(lines.count("2 999"), 1u);
+
+    removeFiles(binaryFileName);
+}
+
+TEST(BinaryHandler, InvalidFile) {
+    BinaryDecoder decoder;
+    EXPECT_FALSE(decoder.open("LugdunumMissingFile.blog"));
+
+    MockHandler handler("Decoded");
+    EXPECT_CALL(handler, handle(_)).Times(0);
+    EXPECT_EQ(decoder.decode(handler), 0u);
+}
+
+}
+}
+}
@@ -1,8 +1,15 @@
 #include <lug/System/Logger/Formatter.hpp>
 #include <lug/System/Logger/Common.hpp>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Logger.hpp>
 #include <lug/System/Logger/Message.hpp>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 namespace lug {
 namespace System {
@@ -10,6 +17,44 @@ namespace Logger {
 
 using namespace ::testing;
 
+namespace {
+
+std::string formatTime(std::chrono::system_clock::time_point time, const char* pattern) {
+    const std::time_t tt = std::chrono::system_clock::to_time_t(time);
+    std::tm tf;
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    localtime_s(&tf, &tt);
+#else
+    localtime_r(&tt, &tf);
+#endif
+
+    std::stringstream ss;
+    ss << std::put_time(&tf, pattern);
+
+    return ss.str();
+}
+
+// Keeps the formatted messages with their time
+class CapturingHandler : public Handler {
+public:
+    CapturingHandler() : Handler("CapturingHandler") {}
+
+    void handle(const priv::Message& msg) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        messages.emplace_back(msg.time, msg.formatted.str());
+    }
+
+    void flush() override {}
+
+    std::vector<std::pair<std::chrono::system_clock::time_point, std::string>> messages;
+
+private:
+    std::mutex _mutex;
+};
+
+}
+
 TEST(Formatter, Formats) {
     Formatter formatter("[%v]\n");
 
@@ -69,6 +114,76 @@ TEST(Formatter, FormatsTime) {
     ASSERT_STREQ(msg.formatted.c_str(), ss.str().c_str());
 }
 
+TEST(Formatter, FormatsMessageTime) {
+    Formatter formatter("[%Y-%m-%d %H:%M:%S][%l] %v\n");
+
+    const auto check = [&formatter](std::chrono::system_clock::time_point time) {
+        priv::Message msg("Test", Level::Warning, time);
+        msg.raw << "Hello world!";
+
+        formatter.format(msg);
+
+        const std::time_t tt = std::chrono::system_clock::to_time_t(time);
+        std::tm tf;
+
+    #if defined(LUG_SYSTEM_WINDOWS)
+        localtime_s(&tf, &tt);
+    #else
+        localtime_r(&tt, &tf);
+    #endif
+
+        std::stringstream ss;
+        ss << std::put_time(&tf, "[%Y-%m-%d %H:%M:%S][WARNING] Hello world!\n");
+
+        ASSERT_STREQ(msg.formatted.c_str(), ss.str().c_str());
+    };
+
+    // The time is cached per second
+    const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+
+    check(now);
+    check(now + std::chrono::milliseconds(10));
+    check(now + std::chrono::seconds(1));
+    check(now + std::chrono::hours(24 * 40));
+    check(now);
+}
+
+TEST(Formatter, Threads) {
+    CapturingHandler handler;
+    handler.setPattern("[%Y-%m-%d %H:%M:%S] %v\n");
+
+    Logger logger("FormatterThreads");
+    logger.addHandler(&handler);
+
+    constexpr size_t threadCount = 4;
+    constexpr size_t messageCount = 2000;
+
+    const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+
+    // Every thread changes of second at each message, in a different day than the others
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&logger, now, i]() {
+            for (size_t j = 0; j < messageCount; ++j) {
+                priv::Message msg("FormatterThreads", Level::Info, now + std::chrono::hours(24 * 37 * i) + std::chrono::seconds(j % 7));
+                msg.raw << "Hello world!";
+
+                logger.handle(msg);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(handler.messages.size(), threadCount * messageCount);
+
+    for (const auto& message : handler.messages) {
+        ASSERT_EQ(message.second, formatTime(message.first, "[%Y-%m-%d %H:%M:%S] Hello world!\n"));
+    }
+}
+
 }
 }
 }
@@ -152,18 +152,68 @@ TEST(Logger, LevelsFilter) {
 }
 
 
-TEST(Logger, Handlers) {
-    class MockLogger : public Logger {
-    public:
-        using Logger::Logger;
-        // MOCK_METHOD1(handle, void(priv::Message& msg));
+namespace LevelsUnion {
 
-        std::set<Handler*>& getHandlers() {
-            return _handlers;
-        }
-    };
+struct Counted {
+    friend std::ostream& operator<<(std::ostream& out, const Counted&) {
+        ++formatCount;
+        return out << "Counted";
+    }
+
+    static size_t formatCount;
+};
+
+size_t Counted::formatCount = 0;
+
+TEST(Logger, LevelsUnion) {
+    Logger* logger = makeLogger(loggerName);
+    MockHandler* handler = makeHandler<MockHandler>(handlerName);
+    MockHandler* handler2 = makeHandler<MockHandler>(handlerName2);
+    logger->addHandler(handler);
+    logger->addHandler(handler2);
+
+    handler->setLevels(Level::Warning);
+    handler2->setLevels(Level::Error);
 
-    std::unique_ptr<MockLogger> logger = std::make_unique<MockLogger>(loggerName);
+    ASSERT_FALSE(logger->shouldLog(Level::Debug));
+    ASSERT_TRUE(logger->shouldLog(Level::Warning));
+    ASSERT_TRUE(logger->shouldLog(Level::Error));
+
+    // Nothing is formatted when no handler takes the level
+    Counted::formatCount = 0;
+    EXPECT_CALL(*handler, handle(_)).Times(0);
+    EXPECT_CALL(*handler2, handle(_)).Times(0);
+    logger->debug("{}", Counted());
+    ASSERT_EQ(Counted::formatCount, 0u);
+
+    // The change of the levels of a handler is seen by the logger
+    handler2->setLevels(Level::Debug);
+    ASSERT_TRUE(logger->shouldLog(Level::Debug));
+
+    EXPECT_CALL(*handler2, handle(Field(&priv::Message::level, Level::Debug))).Times(1);
+    logger->debug("{}", Counted());
+    ASSERT_EQ(Counted::formatCount, 1u);
+
+    LoggingFacility::clear();
+}
+
+TEST(Logger, LevelsCompiled) {
+    // LUG_LOG_LEVEL is not defined for the tests, every level is compiled
+    ASSERT_TRUE(isLevelCompiled(Level::Debug));
+    ASSERT_TRUE(isLevelCompiled(Level::Info));
+    ASSERT_TRUE(isLevelCompiled(Level::Warning));
+    ASSERT_TRUE(isLevelCompiled(Level::Error));
+    ASSERT_TRUE(isLevelCompiled(Level::Fatal));
+    ASSERT_TRUE(isLevelCompiled(Level::Assert));
+
+    static_assert(LUG_LOG_LEVEL_DEBUG < LUG_LOG_LEVEL_INFO && LUG_LOG_LEVEL_ERROR < LUG_LOG_LEVEL_ASSERT, "The levels are ordered");
+}
+
+} // namespace LevelsUnion
+
+
+TEST(Logger, Handlers) {
+    std::unique_ptr<Logger> logger = std::make_unique<Logger>(loggerName);
 
     ASSERT_EQ(logger->getHandlers().size(), size_t(0));
 
@@ -0,0 +1,142 @@
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/LoggingFacility.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MockHandler.hpp"
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+using namespace ::testing;
+
+constexpr const char* loggerName = "MyTestLogger";
+constexpr const char* handlerName = "MyTestHandler";
+
+TEST(LoggingFacility, MissingNames) {
+    ASSERT_EQ(LoggingFacility::getLogger(loggerName), nullptr);
+    ASSERT_EQ(LoggingFacility::getHandler(handlerName), nullptr);
+
+    Logger* logger = makeLogger(loggerName);
+    ASSERT_EQ(LoggingFacility::getLogger(loggerName), logger);
+
+    // Adding a missing handler does nothing
+    logger->addHandler(handlerName);
+    ASSERT_TRUE(logger->getHandlers().empty());
+
+    LoggingFacility::clear();
+
+    ASSERT_EQ(LoggingFacility::getLogger(loggerName), nullptr);
+}
+
+TEST(LoggingFacility, CachedHandle) {
+    LoggerHandle loggerHandle(loggerName);
+    HandlerHandle handlerHandle(handlerName);
+
+    ASSERT_EQ(loggerHandle.get(), nullptr);
+    ASSERT_EQ(handlerHandle.get(), nullptr);
+
+    Logger* logger = makeLogger(loggerName);
+    ASSERT_EQ(loggerHandle.get(), logger);
+    ASSERT_EQ(handlerHandle.get(), nullptr);
+
+    const uint32_t generation = LoggingFacility::getGeneration();
+    ASSERT_EQ(loggerHandle->getName(), loggerName);
+    ASSERT_EQ(LoggingFacility::getGeneration(), generation);
+
+    MockHandler* handler = makeHandler<MockHandler>(handlerName);
+    ASSERT_EQ(handlerHandle.get(), handler);
+
+    // Replaced
+    Logger* logger2 = makeLogger(loggerName);
+    ASSERT_EQ(loggerHandle.get(), logger2);
+
+    LoggingFacility::clear();
+
+    ASSERT_EQ(loggerHandle.get(), nullptr);
+    ASSERT_EQ(handlerHandle.get(), nullptr);
+}
+
+TEST(LoggingFacility, ConcurrentLookups) {
+    constexpr size_t LoggerCount = 200;
+    constexpr size_t ReaderCount = 3;
+
+    std::atomic<bool> done{false};
+    std::atomic<size_t> found{0};
+    std::vector<std::thread> readers;
+
+    for (size_t i = 0; i < ReaderCount; ++i) {
+        readers.emplace_back([&]() {
+            LoggerHandle first("Logger0");
+
+            while (!done.load()) {
+                if (first.get()) {
+                    ASSERT_EQ(first->getName(), "Logger0");
+                }
+
+                for (size_t j = 0; j < LoggerCount; j += 17) {
+                    const std::string name = "Logger" + std::to_string(j);
+                    Logger* logger = LoggingFacility::getLogger(name);
+
+                    if (logger) {
+                        ASSERT_EQ(logger->getName(), name);
+                        ++found;
+                    }
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < LoggerCount; ++i) {
+        makeLogger("Logger" + std::to_string(i));
+    }
+
+    done = true;
+
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    for (size_t i = 0; i < LoggerCount; ++i) {
+        ASSERT_NE(LoggingFacility::getLogger("Logger" + std::to_string(i)), nullptr);
+    }
+
+    LoggingFacility::clear();
+}
+
+TEST(LoggingFacility, AddHandlerWhileLogging) {
+    Logger logger(loggerName);
+    MockHandler handler(handlerName);
+    MockHandler handler2("MyTestHandler2");
+
+    EXPECT_CALL(handler, handle(_)).Times(AtLeast(1));
+    EXPECT_CALL(handler2, handle(_)).Times(AtLeast(1));
+
+    logger.addHandler(&handler);
+
+    std::atomic<bool> added{false};
+    std::thread writer([&]() {
+        // Logs until the second handler is seen, then once more for it
+        while (!added.load()) {
+            logger.info("message");
+        }
+
+        logger.info("message");
+    });
+
+    logger.addHandler(&handler2);
+    added = true;
+
+    writer.join();
+
+    ASSERT_THAT(logger.getHandlers(), ElementsAre(&handler, &handler2));
+}
+
+}
+}
+}
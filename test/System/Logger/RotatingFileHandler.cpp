@@ -0,0 +1,190 @@
+#include <lug/System/Logger/RotatingFileHandler.hpp>
+#include <lug/System/Logger/Message.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+constexpr const char* handlerName = "MyTestHandler";
+const std::string fileName = "LugdunumTestRotatingFile.txt";
+
+namespace {
+
+std::string readFile(const std::string& filename) {
+    std::ifstream ifs(filename, std::ifstream::in | std::ifstream::binary);
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+bool fileExists(const std::string& filename) {
+    return std::ifstream(filename).good();
+}
+
+void write(RotatingFileHandler& handler, const std::string& text, std::chrono::system_clock::time_point time = std::chrono::system_clock::now()) {
+    priv::Message msg("Test", Level::Info, time);
+    msg.raw << text;
+    handler.format(msg);
+    handler.handle(msg);
+}
+
+void removeFiles(const RotatingFileHandler& handler) {
+    for (size_t i = 0; i <= handler.getOptions().backupCount + 1; ++i) {
+        remove(handler.getBackupName(i).c_str());
+    }
+}
+
+}
+
+TEST(RotatingFileHandler, Buffered) {
+    RotatingFileHandler::Options options;
+    options.flushInterval = std::chrono::hours(1);
+
+    RotatingFileHandler handler(handlerName, fileName, options);
+    handler.setPattern("%v\n");
+
+    write(handler, "Hello");
+    write(handler, "world!");
+
+    EXPECT_EQ(readFile(fileName), "");
+    EXPECT_EQ(handler.getFileSize(), 13u);
+
+    handler.flush();
+    EXPECT_EQ(readFile(fileName), "Hello\nworld!\n");
+
+    removeFiles(handler);
+}
+
+TEST(RotatingFileHandler, WritesFullBuffer) {
+    RotatingFileHandler::Options options;
+    options.bufferSize = 6;
+    options.flushInterval = std::chrono::hours(1);
+
+    RotatingFileHandler handler(handlerName, fileName, options);
+    handler.setPattern("%v\n");
+
+    write(handler, "abc");
+    write(handler, "def");
+    EXPECT_EQ(readFile(fileName), "abc\n");
+
+    // Bigger than the buffer, written directly
+    write(handler, "0123456789");
+    EXPECT_EQ(readFile(fileName), "abc\ndef\n0123456789\n");
+
+    removeFiles(handler);
+}
+
+TEST(RotatingFileHandler, FlushInterval) {
+    RotatingFileHandler::Options options;
+    options.flushInterval = std::chrono::seconds(1);
+
+    RotatingFileHandler handler(handlerName, fileName, options);
+    handler.setPattern("%v\n");
+
+    const auto now = std::chrono::system_clock::now();
+
+    write(handler, "first", now);
+    EXPECT_EQ(readFile(fileName), "");
+
+    write(handler, "second", now + std::chrono::seconds(2));
+    EXPECT_EQ(readFile(fileName), "first\nsecond\n");
+
+    removeFiles(handler);
+}
+
+TEST(RotatingFileHandler, RotatesOnSize) {
+    RotatingFileHandler::Options options;
+    options.maxFileSize = 10;
+    options.backupCount = 2;
+
+    {
+        RotatingFileHandler handler(handlerName, fileName, options);
+        handler.setPattern("%v\n");
+
+        write(handler, "one");
+        write(handler, "two");
+        write(handler, "three");
+        write(handler, "four");
+        write(handler, "five");
+    }
+
+    EXPECT_EQ(readFile(fileName), "four\nfive\n");
+    EXPECT_EQ(readFile(fileName + ".1"), "three\n");
+    EXPECT_EQ(readFile(fileName + ".2"), "one\ntwo\n");
+    EXPECT_FALSE(fileExists(fileName + ".3"));
+
+    RotatingFileHandler handler(handlerName, fileName, options);
+    removeFiles(handler);
+}
+
+TEST(RotatingFileHandler, RotatesOnAge) {
+    RotatingFileHandler::Options options;
+    options.maxFileAge = std::chrono::hours(1);
+    options.backupCount = 1;
+
+    {
+        RotatingFileHandler handler(handlerName, fileName, options);
+        handler.setPattern("%v\n");
+
+        const auto now = std::chrono::system_clock::now();
+
+        write(handler, "old", now);
+        write(handler, "new", now + std::chrono::minutes(90));
+        write(handler, "newer", now + std::chrono::minutes(120));
+    }
+
+    EXPECT_EQ(readFile(fileName), "new\nnewer\n");
+    EXPECT_EQ(readFile(fileName + ".1"), "old\n");
+
+    RotatingFileHandler handler(handlerName, fileName, options);
+    removeFiles(handler);
+}
+
+TEST(RotatingFileHandler, NoBackup) {
+    RotatingFileHandler::Options options;
+    options.maxFileSize = 8;
+    options.backupCount = 0;
+    options.syncPolicy = SyncPolicy::Never;
+
+    {
+        RotatingFileHandler handler(handlerName, fileName, options);
+        handler.setPattern("%v\n");
+
+        write(handler, "first");
+        write(handler, "second");
+    }
+
+    EXPECT_EQ(readFile(fileName), "second\n");
+    EXPECT_FALSE(fileExists(fileName + ".1"));
+
+    remove(fileName.c_str());
+}
+
+TEST(RotatingFileHandler, AppendsToExistingFile) {
+    {
+        std::ofstream ofs(fileName);
+        ofs << "existing\n";
+    }
+
+    RotatingFileHandler::Options options;
+    options.syncPolicy = SyncPolicy::Interval;
+    options.syncInterval = std::chrono::milliseconds(0);
+
+    {
+        RotatingFileHandler handler(handlerName, fileName, options);
+        handler.setPattern("%v\n");
+
+        EXPECT_EQ(handler.getFileSize(), 9u);
+        write(handler, "appended");
+    }
+
+    EXPECT_EQ(readFile(fileName), "existing\nappended\n");
+
+    remove(fileName.c_str());
+}
+
+}
+}
+}
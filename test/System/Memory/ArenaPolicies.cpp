@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <lug/System/Memory.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+// Serves the allocations from a static buffer and counts the calls to `getSize`
+class CountingAllocator {
+public:
+    CountingAllocator() = default;
+
+    void* allocate(size_t size, size_t, size_t) {
+        void* const ptr = _buffer + _used;
+        _used += (size + 15) / 16 * 16;
+        return ptr;
+    }
+
+    void free(void*) {}
+    void reset() {}
+
+    size_t getSize(void*) const {
+        ++getSizeCount;
+        return 32;
+    }
+
+    mutable size_t getSizeCount{0};
+
+private:
+    alignas(16) char _buffer[4096];
+    size_t _used{0};
+};
+
+template <class BoundsCheckingPolicy, class MemoryMarkingPolicy>
+using CountingArena = Arena<
+    CountingAllocator,
+    Policies::SingleThreadPolicy,
+    BoundsCheckingPolicy,
+    MemoryMarkingPolicy
+>;
+
+template <class ArenaType>
+size_t countGetSize() {
+    ArenaType arena;
+
+    void* const ptr = arena.allocate(24, 8, 0, __FILE__, __LINE__);
+    arena.free(ptr);
+
+    void* ptrs[4];
+    arena.allocateBatch(4, 24, 8, 0, ptrs, __FILE__, __LINE__);
+    arena.freeBatch(ptrs, 4);
+
+    return arena.allocator().getSizeCount;
+}
+
+}
+
+TEST(MemoryArenaPolicies, SizeOnlyRequestedWhenNeeded) {
+    ASSERT_EQ((countGetSize<CountingArena<Policies::NoBoundsChecking, Policies::NoMemoryMarking>>()), 0u);
+
+    // One call on allocation and one on deallocation
+    ASSERT_EQ((countGetSize<CountingArena<Policies::SimpleBoundsChecking, Policies::NoMemoryMarking>>()), 10u);
+    ASSERT_EQ((countGetSize<CountingArena<Policies::NoBoundsChecking, Policies::SimpleMemoryMarking>>()), 10u);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <thread>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/AtomicFreeList.hpp>
+#include <lug/System/Memory/Allocator/Pool.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+struct Node {
+    Node* parent;
+    size_t values[6];
+};
+
+using SharedPool = Allocator::Pool<Node, alignof(Node), 0, AtomicFreeList>;
+
+using SharedArena = Arena<
+    SharedPool,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+}
+
+TEST(MemoryAtomicFreeList, Grow) {
+    alignas(16) char buffer[1024];
+
+    AtomicFreeList freeList(64);
+    ASSERT_TRUE(freeList.grow(&buffer[0], &buffer[1023], 16, 0));
+
+    std::set<void*> pointers;
+    while (void* ptr = freeList.allocate()) {
+        ASSERT_TRUE(pointers.insert(ptr).second);
+    }
+
+    ASSERT_EQ(pointers.size(), 1024u / 64u);
+
+    for (void* ptr : pointers) {
+        freeList.free(ptr);
+    }
+
+    freeList.reset();
+    ASSERT_EQ(freeList.allocate(), nullptr);
+}
+
+TEST(MemoryAtomicFreeList, Stress) {
+    constexpr size_t threadCount = 8;
+    constexpr size_t elementCount = 4096;
+    constexpr size_t iterations = 20000;
+
+    std::vector<char> buffer(elementCount * 32);
+
+    AtomicFreeList freeList(32);
+    ASSERT_TRUE(freeList.grow(buffer.data(), &buffer.back(), 8, 0));
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&freeList, i]() {
+            void* held[8];
+
+            for (size_t j = 0; j < iterations; ++j) {
+                const size_t count = (i + j) % 8 + 1;
+
+                for (size_t k = 0; k < count; ++k) {
+                    held[k] = freeList.allocate();
+
+                    // After the first pointer, which a late `allocate` of another thread may still read
+                    static_cast<size_t*>(held[k])[1] = i;
+                }
+
+                for (size_t k = 0; k < count; ++k) {
+                    freeList.free(held[k]);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // No element must have been lost nor duplicated
+    std::set<void*> pointers;
+    while (void* ptr = freeList.allocate()) {
+        ASSERT_TRUE(pointers.insert(ptr).second);
+    }
+
+    ASSERT_EQ(pointers.size(), elementCount);
+}
+
+TEST(MemoryAtomicFreeList, SharedPool) {
+    constexpr size_t threadCount = 8;
+    constexpr size_t nodeCount = 512;
+
+    // Small pages to stress the growth of the chunk from several threads at once
+    Area::Heap<1024, threadCount * nodeCount * sizeof(Node) / 1024 + threadCount> area;
+    SharedArena arena(&area);
+
+    std::vector<std::vector<Node*>> nodes(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&arena, &nodes, i]() {
+            for (size_t j = 0; j < nodeCount; ++j) {
+                Node* const node = LUG_NEW(Node, arena);
+
+                if (node) {
+                    node->values[0] = i;
+                    nodes[i].push_back(node);
+                }
+
+                // Give some nodes back to the pool to mix the free list
+                if (j % 3 == 0 && !nodes[i].empty()) {
+                    LUG_DELETE(nodes[i].back(), arena);
+                    nodes[i].pop_back();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<Node*> unique;
+    for (size_t i = 0; i < threadCount; ++i) {
+        for (Node* node : nodes[i]) {
+            ASSERT_EQ(node->values[0], i);
+            ASSERT_TRUE(unique.insert(node).second);
+        }
+    }
+
+    ASSERT_GT(unique.size(), 0u);
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Allocator/SizeClass.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <lug/System/Memory/FreeList.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+template <class Allocator, class BoundsCheckingPolicy = Policies::NoBoundsChecking>
+using TrackedArena = Arena<
+    Allocator,
+    Policies::SingleThreadPolicy,
+    BoundsCheckingPolicy,
+    Policies::NoMemoryMarking,
+    Policies::SimpleMemoryTracking
+>;
+
+struct Counted {
+    static size_t liveCount;
+
+    Counted(uint32_t value) : value(value) {
+        ++liveCount;
+    }
+
+    ~Counted() {
+        --liveCount;
+    }
+
+    uint32_t value;
+};
+
+size_t Counted::liveCount = 0;
+
+// Throws when the `throwAt`th object is constructed
+struct Throwing : Counted {
+    static size_t constructedCount;
+    static size_t throwAt;
+
+    Throwing(uint32_t value) : Counted(value) {
+        if (++constructedCount == throwAt) {
+            throw std::runtime_error("Throwing");
+        }
+    }
+};
+
+size_t Throwing::constructedCount = 0;
+size_t Throwing::throwAt = 0;
+
+}
+
+TEST(MemoryBatch, FreeList) {
+    alignas(16) char buffer[16 * 32];
+
+    FreeList freeList(32);
+    ASSERT_TRUE(freeList.grow(buffer, buffer + sizeof(buffer) - 1, 16, 0));
+
+    void* ptrs[20];
+    ASSERT_EQ(freeList.allocateBatch(10, ptrs), 10u);
+    ASSERT_EQ(freeList.allocateBatch(10, ptrs + 10), 6u);
+    ASSERT_EQ(freeList.allocate(), nullptr);
+
+    ASSERT_EQ(std::set<void*>(ptrs, ptrs + 16).size(), 16u);
+
+    // The blocks come back in the same order
+    freeList.freeBatch(ptrs, 16);
+
+    void* again[16];
+    ASSERT_EQ(freeList.allocateBatch(16, again), 16u);
+    ASSERT_TRUE(std::equal(ptrs, ptrs + 16, again));
+}
+
+TEST(MemoryBatch, Chunk) {
+    Area::Heap<4096, 4> area;
+    TrackedArena<Allocator::Chunk<64>> arena(&area);
+
+    // More blocks than a page holds
+    std::vector<void*> ptrs(200);
+    ASSERT_EQ(arena.allocateBatch(ptrs.size(), 64, 64, 0, ptrs.data(), __FILE__, __LINE__), ptrs.size());
+    ASSERT_EQ(std::set<void*>(ptrs.begin(), ptrs.end()).size(), ptrs.size());
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), ptrs.size());
+
+    for (void* ptr : ptrs) {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+    }
+
+    // The rest of the area
+    std::vector<void*> rest(100);
+    const size_t restCount = arena.allocateBatch(rest.size(), 64, 64, 0, rest.data(), __FILE__, __LINE__);
+    ASSERT_GT(restCount, 0u);
+    ASSERT_LT(restCount, rest.size());
+    ASSERT_EQ(arena.allocate(64, 64, 0, __FILE__, __LINE__), nullptr);
+
+    arena.freeBatch(ptrs.data(), ptrs.size());
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), restCount);
+
+    std::vector<void*> again(ptrs.size());
+    ASSERT_EQ(arena.allocateBatch(again.size(), 64, 64, 0, again.data(), __FILE__, __LINE__), again.size());
+    ASSERT_EQ(std::set<void*>(again.begin(), again.end()), std::set<void*>(ptrs.begin(), ptrs.end()));
+
+    arena.freeBatch(again.data(), again.size());
+    arena.freeBatch(rest.data(), restCount);
+}
+
+TEST(MemoryBatch, Linear) {
+    Area::Heap<4096, 4> area;
+    TrackedArena<Allocator::Linear, Policies::SimpleBoundsChecking> arena(&area);
+
+    for (size_t alignment : {1, 8, 16, 64}) {
+        arena.reset();
+
+        std::vector<void*> ptrs(100);
+        ASSERT_EQ(arena.allocateBatch(ptrs.size(), 100, alignment, 0, ptrs.data(), __FILE__, __LINE__), ptrs.size());
+
+        for (size_t i = 0; i < ptrs.size(); ++i) {
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(ptrs[i]) % alignment, 0u);
+            std::memset(ptrs[i], static_cast<int>(i), 100);
+        }
+
+        // The blocks don't overlap and the guards are intact
+        for (size_t i = 0; i < ptrs.size(); ++i) {
+            for (size_t j = 0; j < 100; ++j) {
+                ASSERT_EQ(static_cast<unsigned char*>(ptrs[i])[j], i);
+            }
+        }
+
+        arena.freeBatch(ptrs.data(), ptrs.size());
+    }
+
+    // Until the area is exhausted
+    arena.reset();
+
+    std::vector<void*> ptrs(200);
+    const size_t allocated = arena.allocateBatch(ptrs.size(), 500, 8, 0, ptrs.data(), __FILE__, __LINE__);
+    ASSERT_GT(allocated, 0u);
+    ASSERT_LT(allocated, ptrs.size());
+    ASSERT_EQ(arena.allocate(500, 8, 0, __FILE__, __LINE__), nullptr);
+}
+
+TEST(MemoryBatch, WithoutAllocatorBatch) {
+    Area::Heap<1024 * 1024, 1> area;
+    TrackedArena<Allocator::SizeClass<>> arena(&area);
+
+    std::vector<void*> ptrs(100, nullptr);
+    ASSERT_EQ(arena.allocateBatch(ptrs.size(), 48, 16, 0, ptrs.data(), __FILE__, __LINE__), ptrs.size());
+    ASSERT_EQ(std::set<void*>(ptrs.begin(), ptrs.end()).size(), ptrs.size());
+
+    arena.freeBatch(ptrs.data(), ptrs.size());
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), 0u);
+}
+
+TEST(MemoryBatch, NewDelete) {
+    Area::Heap<4096, 16> area;
+    TrackedArena<Allocator::Chunk<16>> arena(&area);
+
+    std::vector<Counted*> objects(1000);
+    ASSERT_EQ(LUG_NEW_BATCH(Counted, objects.size(), objects.data(), arena, 42u), objects.size());
+    ASSERT_EQ(Counted::liveCount, objects.size());
+
+    for (Counted* object : objects) {
+        ASSERT_EQ(object->value, 42u);
+    }
+
+    // Each object can also be deleted alone
+    LUG_DELETE(objects.back(), arena);
+    objects.back() = nullptr;
+
+    LUG_DELETE_BATCH(objects.data(), objects.size(), arena);
+    ASSERT_EQ(Counted::liveCount, 0u);
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), 0u);
+}
+
+TEST(MemoryBatch, NewThrow) {
+    Area::Heap<4096, 64> area;
+    TrackedArena<Allocator::Chunk<16>> arena(&area);
+
+    // In the middle of the second group
+    Throwing::constructedCount = 0;
+    Throwing::throwAt = 300;
+
+    std::vector<Throwing*> objects(600);
+    ASSERT_THROW(LUG_NEW_BATCH(Throwing, objects.size(), objects.data(), arena, 42u), std::runtime_error);
+
+    // The objects already constructed are destroyed and every block is freed
+    ASSERT_EQ(Counted::liveCount, 0u);
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), 0u);
+}
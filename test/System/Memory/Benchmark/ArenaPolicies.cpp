@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Basic.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t BlockSize = 64;
+constexpr size_t LiveBlocks = 1000;
+constexpr size_t Rounds = 1000;
+
+// Same as `NoBoundsChecking` but not recognized by the arena, which then requests the size of every allocation
+// as it did before the no-op policies were detected
+class OpaqueNoBoundsChecking : public Policies::NoBoundsChecking {};
+
+template <class Allocator, class BoundsCheckingPolicy>
+using ArenaType = Arena<
+    Allocator,
+    Policies::SingleThreadPolicy,
+    BoundsCheckingPolicy,
+    Policies::NoMemoryMarking
+>;
+
+template <class ArenaType>
+void run(const std::string& name, ArenaType& arena) {
+    void* blocks[LiveBlocks];
+
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t round = 0; round < Rounds; ++round) {
+            for (size_t i = 0; i < LiveBlocks; ++i) {
+                blocks[i] = arena.allocate(BlockSize, 16, 0, __FILE__, __LINE__);
+            }
+
+            lug::Benchmark::doNotOptimize(blocks[0]);
+
+            for (size_t i = 0; i < LiveBlocks; ++i) {
+                arena.free(blocks[i]);
+            }
+        }
+    });
+
+    lug::Benchmark::report(name.c_str(), Rounds * LiveBlocks * 2, seconds);
+}
+
+template <class BoundsCheckingPolicy>
+void runAll(const char* name) {
+    {
+        ArenaType<Allocator::Basic, BoundsCheckingPolicy> arena;
+        run(std::string("Basic, ") + name, arena);
+    }
+
+    {
+        Area::VirtualHeap<> area;
+        ArenaType<Allocator::Linear, BoundsCheckingPolicy> arena(&area);
+
+        // The linear allocator never reuses the memory, reset it between the rounds
+        void* blocks[LiveBlocks];
+        const double seconds = lug::Benchmark::measure([&]() {
+            for (size_t round = 0; round < Rounds; ++round) {
+                for (size_t i = 0; i < LiveBlocks; ++i) {
+                    blocks[i] = arena.allocate(BlockSize, 16, 0, __FILE__, __LINE__);
+                }
+
+                lug::Benchmark::doNotOptimize(blocks[0]);
+
+                for (size_t i = 0; i < LiveBlocks; ++i) {
+                    arena.free(blocks[i]);
+                }
+
+                arena.reset();
+            }
+        });
+
+        lug::Benchmark::report((std::string("Linear, ") + name).c_str(), Rounds * LiveBlocks * 2, seconds);
+    }
+
+    {
+        Area::VirtualHeap<> area;
+        ArenaType<Allocator::Chunk<BlockSize, 16>, BoundsCheckingPolicy> arena(&area);
+        run(std::string("Chunk, ") + name, arena);
+    }
+}
+
+}
+
+TEST(BenchmarkArenaPolicies, NoOpPolicies) {
+    runAll<OpaqueNoBoundsChecking>("size requested");
+    runAll<Policies::NoBoundsChecking>("no-op policies detected");
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <lug/System/Memory/AtomicFreeList.hpp>
+#include <lug/System/Memory/FreeList.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t ElementSize = 64;
+constexpr size_t ElementCount = 16 * 1024;
+constexpr size_t Iterations = 100000;
+
+class LockedFreeList {
+public:
+    explicit LockedFreeList(size_t size) : _freeList(size) {}
+
+    bool grow(void* start, void* end, size_t alignment, size_t offset) {
+        return _freeList.grow(start, end, alignment, offset);
+    }
+
+    void* allocate() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _freeList.allocate();
+    }
+
+    void free(void* ptr) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _freeList.free(ptr);
+    }
+
+private:
+    std::mutex _mutex;
+    FreeList _freeList;
+};
+
+// Every thread pops a few elements and pushes them back, maximizing the contention on the head
+template <class FreeListType>
+void run(const char* name, size_t threadCount) {
+    std::vector<char> buffer(ElementSize * ElementCount);
+
+    FreeListType freeList(ElementSize);
+    freeList.grow(buffer.data(), &buffer.back(), alignof(void*), 0);
+
+    const double seconds = lug::Benchmark::measureThreads(threadCount, [&freeList](size_t) {
+        void* held[4];
+
+        for (size_t i = 0; i < Iterations; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                held[j] = freeList.allocate();
+            }
+
+            for (size_t j = 0; j < 4; ++j) {
+                freeList.free(held[j]);
+            }
+        }
+    });
+
+    const std::string label = std::string(name) + " (" + std::to_string(threadCount) + " threads)";
+    lug::Benchmark::report(label.c_str(), threadCount * Iterations * 8, seconds);
+}
+
+}
+
+TEST(BenchmarkAtomicFreeList, Contention) {
+    for (size_t threadCount : {1, 2, 4, 8, 16}) {
+        run<LockedFreeList>("FreeList + std::mutex", threadCount);
+        run<AtomicFreeList>("AtomicFreeList", threadCount);
+    }
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t ObjectCount = 100000;
+
+// About the size of a scene node
+struct Object {
+    Object(uint32_t id) : id(id) {}
+
+    uint32_t id;
+    float transform[12];
+    void* parent{nullptr};
+};
+
+using ChunkArena = Arena<
+    Allocator::Chunk<sizeof(Object), alignof(Object)>,
+    Policies::MultiThreadPolicy<std::mutex>,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+using LinearArena = Arena<
+    Allocator::Linear,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+template <class ArenaType>
+void run(const char* name) {
+    std::vector<Object*> objects(ObjectCount);
+
+    {
+        Area::VirtualHeap<> area;
+        ArenaType arena(&area);
+
+        const double seconds = lug::Benchmark::measure([&]() {
+            for (size_t i = 0; i < ObjectCount; ++i) {
+                objects[i] = LUG_NEW(Object, arena, static_cast<uint32_t>(i));
+            }
+
+            lug::Benchmark::doNotOptimize(objects.back());
+
+            for (size_t i = 0; i < ObjectCount; ++i) {
+                LUG_DELETE(objects[i], arena);
+            }
+
+            arena.reset();
+        });
+
+        lug::Benchmark::report((std::string(name) + ", LUG_NEW / LUG_DELETE").c_str(), ObjectCount * 2, seconds);
+    }
+
+    {
+        Area::VirtualHeap<> area;
+        ArenaType arena(&area);
+
+        const double seconds = lug::Benchmark::measure([&]() {
+            LUG_NEW_BATCH(Object, ObjectCount, objects.data(), arena, 0u);
+            lug::Benchmark::doNotOptimize(objects.back());
+            LUG_DELETE_BATCH(objects.data(), ObjectCount, arena);
+
+            arena.reset();
+        });
+
+        lug::Benchmark::report((std::string(name) + ", LUG_NEW_BATCH / LUG_DELETE_BATCH").c_str(), ObjectCount * 2, seconds);
+    }
+}
+
+}
+
+TEST(BenchmarkBatch, Construction) {
+    run<ChunkArena>("Chunk + mutex");
+    run<LinearArena>("Linear");
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Bump.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t RecordCount = 1000000;
+
+// A per-frame sort key
+struct Record {
+    uint64_t key;
+};
+
+template <class Allocator>
+using ArenaType = Arena<
+    Allocator,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+template <class Allocator>
+void run(const char* name) {
+    Area::VirtualHeap<> area;
+    ArenaType<Allocator> arena(&area);
+
+    std::vector<Record*> records(RecordCount);
+    lug::Benchmark::CacheMissCounter cacheMisses;
+
+    // Fill the frame
+    uint64_t allocationMisses = 0;
+    const double allocationSeconds = lug::Benchmark::measure([&]() {
+        arena.reset();
+
+        cacheMisses.start();
+        for (size_t i = 0; i < RecordCount; ++i) {
+            records[i] = new (arena.allocate(sizeof(Record), alignof(Record), 0, __FILE__, __LINE__)) Record{i * 0x9E3779B97F4A7C15ull};
+        }
+        allocationMisses = cacheMisses.stop();
+    });
+
+    // Read it back, as the sort does
+    uint64_t readMisses = 0;
+    uint64_t sum = 0;
+    const double readSeconds = lug::Benchmark::measure([&]() {
+        cacheMisses.start();
+        for (const Record* record : records) {
+            sum += record->key;
+        }
+        readMisses = cacheMisses.stop();
+    });
+
+    lug::Benchmark::doNotOptimize(sum);
+
+    // The pages of the virtual heap are contiguous
+    const size_t footprint = reinterpret_cast<char*>(records.back() + 1) - reinterpret_cast<char*>(records.front());
+
+    lug::Benchmark::report((std::string(name) + ", allocate and write").c_str(), RecordCount, allocationSeconds);
+    lug::Benchmark::report((std::string(name) + ", read").c_str(), RecordCount, readSeconds);
+
+    std::printf("[ BENCHMARK ] %-56s %8zu KB, %zu cache lines", name, footprint / 1024, footprint / 64);
+    if (cacheMisses.isAvailable()) {
+        std::printf(", %llu + %llu cache misses", static_cast<unsigned long long>(allocationMisses), static_cast<unsigned long long>(readMisses));
+    }
+    std::printf("\n");
+}
+
+}
+
+TEST(BenchmarkBump, SmallAllocations) {
+    run<Allocator::Linear>("Linear (size header)");
+    run<Allocator::Bump>("Bump (headerless)");
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <lug/System/Memory/Area/HugePageHeap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t PageSize = 2 * 1024 * 1024;
+constexpr size_t PageCount = 512; // 1 GB
+constexpr size_t Accesses = 16 * 1024 * 1024;
+
+const char* getName(Area::VirtualMemory::HugePages hugePages) {
+    switch (hugePages) {
+        case Area::VirtualMemory::HugePages::None: return "regular pages";
+        case Area::VirtualMemory::HugePages::Transparent: return "transparent huge pages";
+        case Area::VirtualMemory::HugePages::Explicit: return "explicit huge pages";
+    }
+
+    return "";
+}
+
+// Random reads over the whole area, TLB bound
+template <Area::VirtualMemory::HugePages HugePages>
+void run() {
+    Area::HugePageHeap<PageSize, PageCount, HugePages> area;
+
+    Area::Page* page = area.requestNextPage();
+    ASSERT_NE(page, nullptr);
+
+    uint64_t* const data = static_cast<uint64_t*>(page->start);
+    constexpr size_t count = PageSize * PageCount / sizeof(uint64_t);
+
+    // Fault everything in before measuring
+    std::memset(data, 1, PageSize * PageCount);
+
+    const double seconds = lug::Benchmark::measure([data]() {
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        uint64_t sum = 0;
+
+        for (size_t i = 0; i < Accesses; ++i) {
+            // xorshift64
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            sum += data[state % count];
+        }
+
+        lug::Benchmark::doNotOptimize(sum);
+    });
+
+    const std::string name = std::string("1 GB random reads, ") + getName(HugePages) + " (got " + getName(area.getHugePages()) + ")";
+    lug::Benchmark::report(name.c_str(), Accesses, seconds);
+}
+
+}
+
+TEST(BenchmarkHugePageHeap, RandomAccess) {
+    run<Area::VirtualMemory::HugePages::None>();
+    run<Area::VirtualMemory::HugePages::Transparent>();
+    run<Area::VirtualMemory::HugePages::Explicit>();
+}
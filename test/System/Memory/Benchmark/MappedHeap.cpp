@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/MappedHeap.hpp>
+#include <lug/System/Memory/OffsetPtr.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+using MappedArena = Arena<
+    Allocator::Linear,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+constexpr uint32_t NodeCount = 100000;
+constexpr size_t Capacity = 64 * 1024 * 1024;
+
+const std::string fileName = "BenchmarkMappedHeap.snapshot";
+
+struct Node {
+    uint32_t id;
+    float transform[16];
+    offset_ptr<char> name;
+    offset_ptr<Node> parent;
+    offset_ptr<Node> next;
+};
+
+struct Scene {
+    uint32_t nodeCount{0};
+    offset_ptr<Node> first;
+};
+
+// Stands for the loading of the scene from its source
+Scene* buildScene(MappedArena& arena) {
+    Scene* const scene = LUG_NEW(Scene, arena);
+    Node* last = nullptr;
+
+    for (uint32_t i = 0; i < NodeCount; ++i) {
+        Node* const node = LUG_NEW(Node, arena);
+        const std::string name = "node" + std::to_string(i);
+
+        node->id = i;
+        for (uint32_t j = 0; j < 16; ++j) {
+            node->transform[j] = (j % 5 == 0) ? 1.0f : 0.0f;
+        }
+
+        node->name = LUG_NEW_ARRAY_SIZE(char, name.size() + 1, arena);
+        std::memcpy(node->name.get(), name.c_str(), name.size() + 1);
+
+        node->parent = last && i % 8 ? last : nullptr;
+
+        if (last) {
+            last->next = node;
+        } else {
+            scene->first = node;
+        }
+
+        last = node;
+        ++scene->nodeCount;
+    }
+
+    return scene;
+}
+
+// Touches every node, as the first frame does
+uint64_t visitScene(const Scene* scene) {
+    uint64_t sum = 0;
+
+    for (const Node* node = scene->first.get(); node; node = node->next.get()) {
+        sum += node->id + static_cast<uint64_t>(node->transform[0]) + node->name[0] + (node->parent ? 1 : 0);
+    }
+
+    return sum;
+}
+
+}
+
+TEST(BenchmarkMappedHeap, Startup) {
+    size_t snapshotSize = 0;
+
+    {
+        Area::MappedHeap area(Capacity);
+        MappedArena arena(&area);
+
+        area.setRoot(buildScene(arena));
+        ASSERT_TRUE(area.save(fileName, arena.allocator().getMark().current));
+    }
+
+    uint64_t sum = 0;
+
+    const double rebuildSeconds = lug::Benchmark::measure([&]() {
+        Area::MappedHeap area(Capacity);
+        MappedArena arena(&area);
+
+        sum += visitScene(buildScene(arena));
+    });
+
+    const double loadSeconds = lug::Benchmark::measure([&]() {
+        Area::MappedHeap area(Capacity);
+        ASSERT_TRUE(area.load(fileName));
+
+        snapshotSize = area.getSnapshotSize();
+        sum += visitScene(area.getRoot<Scene>());
+    });
+
+    lug::Benchmark::doNotOptimize(sum);
+
+    std::printf("[ BENCHMARK ] %u nodes, snapshot of %zu KB\n", NodeCount, snapshotSize / 1024);
+    lug::Benchmark::report("Rebuild the scene", NodeCount, rebuildSeconds);
+    lug::Benchmark::report("Map the snapshot", NodeCount, loadSeconds);
+
+    std::remove(fileName.c_str());
+}
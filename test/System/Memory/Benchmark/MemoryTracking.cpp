@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t BlockSize = 64;
+constexpr size_t LiveBlocks = 1000;
+constexpr size_t Rounds = 2000;
+
+using AreaType = Area::Heap<64 * 1024, 1>;
+
+template <class MemoryTrackingPolicy>
+using ChunkArena = Arena<
+    Allocator::Chunk<BlockSize>,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking,
+    MemoryTrackingPolicy
+>;
+
+// Calls the allocator directly, as a reference for the cost of the arena itself
+struct RawChunk {
+    explicit RawChunk(Area::IArea* area) : chunk{area} {}
+
+    void* allocate(size_t size, size_t alignment, size_t offset, const char*, size_t) {
+        return chunk.allocate(size, alignment, offset);
+    }
+
+    void free(void* ptr) {
+        chunk.free(ptr);
+    }
+
+    Allocator::Chunk<BlockSize> chunk;
+};
+
+template <class ArenaType>
+void run(const char* name) {
+    AreaType area;
+    ArenaType arena(&area);
+    void* blocks[LiveBlocks];
+
+    const double seconds = lug::Benchmark::measure([&]() {
+        for (size_t round = 0; round < Rounds; ++round) {
+            for (size_t i = 0; i < LiveBlocks; ++i) {
+                blocks[i] = arena.allocate(BlockSize, BlockSize, 0, __FILE__, __LINE__);
+            }
+
+            lug::Benchmark::doNotOptimize(blocks[0]);
+
+            for (size_t i = 0; i < LiveBlocks; ++i) {
+                arena.free(blocks[i]);
+            }
+        }
+    });
+
+    lug::Benchmark::report(name, Rounds * LiveBlocks * 2, seconds);
+}
+
+}
+
+TEST(BenchmarkMemoryTracking, Overhead) {
+    run<RawChunk>("Chunk without arena");
+    run<ChunkArena<Policies::NoMemoryTracking>>("Arena<Chunk> + NoMemoryTracking");
+    run<ChunkArena<Policies::SimpleMemoryTracking>>("Arena<Chunk> + SimpleMemoryTracking");
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/SizeClass.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t NodeCount = 20000;
+constexpr size_t Rounds = 10;
+
+struct Malloc {
+    void* allocate(size_t size) {
+        return std::malloc(size);
+    }
+
+    void free(void* ptr) {
+        std::free(ptr);
+    }
+};
+
+struct SizeClassArena {
+    using Arena = lug::System::Memory::Arena<
+        Allocator::SizeClass<>,
+        Policies::SingleThreadPolicy,
+        Policies::NoBoundsChecking,
+        Policies::NoMemoryMarking
+    >;
+
+    void* allocate(size_t size) {
+        return arena.allocate(size, 16, 0, __FILE__, __LINE__);
+    }
+
+    void free(void* ptr) {
+        arena.free(ptr);
+    }
+
+    Area::VirtualHeap<1024 * 1024> area;
+    Arena arena{&area};
+};
+
+// Builds a scene graph the way the loaders do (a node, its name, a growing array of children,
+// a few components and, for some nodes, the vertex and index buffers of a mesh), then destroys it
+// Returns the number of allocations and frees
+template <class Allocator>
+size_t buildScene(Allocator& allocator, std::vector<void*>& allocations) {
+    allocations.clear();
+    size_t operations = 0;
+
+    for (size_t i = 0; i < NodeCount; ++i) {
+        allocations.push_back(allocator.allocate(192));
+        allocations.push_back(allocator.allocate(16 + (i * 7) % 48));
+
+        // Children array growing by doubling
+        void* children = nullptr;
+        for (size_t capacity = 1; capacity <= 1u << (i % 6); capacity *= 2) {
+            void* const grown = allocator.allocate(capacity * sizeof(void*));
+            if (children) {
+                std::memcpy(grown, children, capacity / 2 * sizeof(void*));
+                allocator.free(children);
+                operations += 2;
+            }
+            children = grown;
+        }
+        allocations.push_back(children);
+
+        for (size_t j = 0; j < 3; ++j) {
+            allocations.push_back(allocator.allocate(48 + 16 * ((i + j) % 4)));
+        }
+
+        if (i % 8 == 0) {
+            allocations.push_back(allocator.allocate(1024 + (i * 61) % (15 * 1024)));
+            allocations.push_back(allocator.allocate(512 + (i * 29) % 4096));
+        }
+
+        lug::Benchmark::doNotOptimize(allocations.back());
+    }
+
+    operations += allocations.size() * 2;
+
+    // Not in allocation order, the nodes are destroyed from the root
+    for (size_t i = 0; i < allocations.size(); i += 2) {
+        allocator.free(allocations[i]);
+    }
+
+    for (size_t i = 1; i < allocations.size(); i += 2) {
+        allocator.free(allocations[i]);
+    }
+
+    return operations;
+}
+
+template <class Allocator>
+void run(const char* name, Allocator& allocator) {
+    std::vector<void*> allocations;
+    allocations.reserve(NodeCount * 8);
+
+    size_t operations = 0;
+    const double seconds = lug::Benchmark::measure([&]() {
+        operations = 0;
+        for (size_t round = 0; round < Rounds; ++round) {
+            operations += buildScene(allocator, allocations);
+        }
+    });
+
+    lug::Benchmark::report(name, operations, seconds);
+}
+
+}
+
+TEST(BenchmarkSizeClass, SceneConstruction) {
+    {
+        Malloc allocator;
+        run("Scene construction, malloc", allocator);
+    }
+
+    {
+        SizeClassArena allocator;
+        run("Scene construction, Arena<SizeClass>", allocator);
+    }
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <lug/System/Memory/IntrusivePtr.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t Iterations = 1000000;
+constexpr size_t BlockSize = 64;
+
+using ChunkArena = Arena<
+    Allocator::Chunk<BlockSize>,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+struct Object : public IntrusiveRefCount {
+    Object(size_t value) : value{value} {}
+
+    size_t value;
+};
+
+// What `make_unique` returned before, a std::function deleter capturing the arena
+template <typename T, class Arena, typename ...Args>
+std::unique_ptr<T, std::function<void (T*)>> makeUniqueFunction(Arena& arena, Args&&... args) {
+    auto deleter = [&arena](T* ptr) {
+        LUG_DELETE(ptr, arena);
+    };
+
+    return std::unique_ptr<T, std::function<void (T*)>>(LUG_NEW(T, arena, std::forward<Args>(args)...), deleter);
+}
+
+template <typename Function>
+void run(const char* name, size_t pointerSize, Function&& function) {
+    const double seconds = lug::Benchmark::measure([&function]() {
+        for (size_t i = 0; i < Iterations; ++i) {
+            function(i);
+        }
+    });
+
+    lug::Benchmark::report(name, Iterations, seconds);
+    std::printf("[ BENCHMARK ] %-56s %14zu bytes\n", name, pointerSize);
+}
+
+}
+
+TEST(BenchmarkSmartPointer, MakeDestroy) {
+    Area::Heap<4096, 4> area;
+    ChunkArena arena(&area);
+
+    run("unique_ptr (std::function deleter)", sizeof(std::unique_ptr<Object, std::function<void (Object*)>>), [&arena](size_t i) {
+        auto ptr = makeUniqueFunction<Object>(arena, i);
+        lug::Benchmark::doNotOptimize(ptr->value);
+    });
+
+    run("unique_ptr (ArenaDeleter)", sizeof(unique_ptr<Object, ChunkArena>), [&arena](size_t i) {
+        auto ptr = make_unique<Object>(arena, i);
+        lug::Benchmark::doNotOptimize(ptr->value);
+    });
+
+    run("shared_ptr (make_shared)", sizeof(shared_ptr<Object>), [&arena](size_t i) {
+        auto ptr = make_shared<Object>(arena, i);
+        lug::Benchmark::doNotOptimize(ptr->value);
+    });
+
+    run("intrusive_ptr (make_intrusive)", sizeof(intrusive_ptr<Object, ChunkArena>), [&arena](size_t i) {
+        auto ptr = make_intrusive<Object>(arena, i);
+        lug::Benchmark::doNotOptimize(ptr->value);
+    });
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include <lug/System/Memory/FrameArena.hpp>
+#include <lug/Graphics/Scene/Allocator.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+// Counts the allocations of the std containers, the global operator new is left alone
+// so the other benchmarks of the binary aren't slowed down
+size_t allocationCount = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        ++allocationCount;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* ptr, size_t count) {
+        std::allocator<T>().deallocate(ptr, count);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) {
+    return false;
+}
+
+constexpr size_t Frames = 10000;
+constexpr size_t MeshCount = 2000;
+constexpr size_t LightCount = 16;
+
+struct StdFrame {
+    template <typename T>
+    std::vector<T, CountingAllocator<T>> queueVector() {
+        return std::vector<T, CountingAllocator<T>>();
+    }
+
+    template <typename T>
+    std::vector<T, CountingAllocator<T>> scratchVector() {
+        return std::vector<T, CountingAllocator<T>>();
+    }
+
+    void end() {}
+
+    size_t getAllocationCount() const {
+        return allocationCount;
+    }
+};
+
+// Same layout as the renderer: the render queue has its own single frame arena,
+// the temporaries use the triple buffered frame arena of the renderer
+struct ArenaFrame {
+    template <typename T>
+    FrameArena::Vector<T> queueVector() {
+        return FrameArena::Vector<T>(queueArena.getAllocator<T>());
+    }
+
+    template <typename T>
+    FrameArena::Vector<T> scratchVector() {
+        return FrameArena::Vector<T>(frameArena.getAllocator<T>());
+    }
+
+    void end() {
+        queueArena.nextFrame();
+        frameArena.nextFrame();
+    }
+
+    // Pages and large blocks requested by the arenas to the system
+    size_t getAllocationCount() const {
+        return queueArena.getSystemAllocationCount() + frameArena.getSystemAllocationCount();
+    }
+
+    FrameArena queueArena{1};
+    FrameArena frameArena{3};
+};
+
+// Mimics the containers built every frame by the renderer:
+// the render queue filled from the scene, then a few small vectors per light for the draw commands
+template <class Frame>
+void frame(Frame& frame) {
+    // The render queue reserves as many objects as during the previous frame
+    auto meshs = frame.template queueVector<void*>();
+    meshs.reserve(MeshCount);
+    for (size_t i = 0; i < MeshCount; ++i) {
+        meshs.push_back(reinterpret_cast<void*>(i + 1));
+    }
+
+    auto lights = frame.template queueVector<void*>();
+    for (size_t i = 0; i < LightCount; ++i) {
+        lights.push_back(reinterpret_cast<void*>(i + 1));
+    }
+
+    for (size_t i = 0; i < LightCount; ++i) {
+        auto descriptorSets = frame.template scratchVector<void*>();
+        descriptorSets.push_back(lights[i]);
+
+        auto dynamicOffsets = frame.template scratchVector<uint32_t>();
+        dynamicOffsets.push_back(static_cast<uint32_t>(i));
+
+        lug::Benchmark::doNotOptimize(descriptorSets.data());
+        lug::Benchmark::doNotOptimize(dynamicOffsets.data());
+    }
+
+    lug::Benchmark::doNotOptimize(meshs.data());
+}
+
+// The nodes of a scene with their movable objects, destroyed and rebuilt every frame like a streamed level
+struct StdScene {
+    using Objects = std::vector<void*, CountingAllocator<void*>>;
+
+    Objects objects() {
+        return Objects();
+    }
+
+    void end() {}
+
+    size_t getAllocationCount() const {
+        return allocationCount;
+    }
+};
+
+struct ArenaScene {
+    using Objects = lug::Graphics::Scene::Vector<void*>;
+
+    Objects objects() {
+        return Objects(lug::Graphics::Scene::Allocator<void*>(arena));
+    }
+
+    void end() {}
+
+    // Pages committed by the area of the scene
+    size_t getAllocationCount() const {
+        return area.getPageCount();
+    }
+
+    lug::Graphics::Scene::Area area{lug::Graphics::Scene::AreaReservedSize};
+    lug::Graphics::Scene::Arena arena{&area};
+};
+
+constexpr size_t NodeCount = 256;
+
+template <class Scene>
+void sceneFrame(Scene& scene) {
+    std::vector<typename Scene::Objects> nodes;
+    nodes.reserve(NodeCount);
+
+    for (size_t i = 0; i < NodeCount; ++i) {
+        nodes.push_back(scene.objects());
+
+        for (size_t j = 0; j < (i * 7) % 24 + 1; ++j) {
+            nodes.back().push_back(&nodes);
+        }
+    }
+
+    lug::Benchmark::doNotOptimize(nodes.data());
+}
+
+template <class State>
+void run(const char* name, void (*function)(State&)) {
+    State state;
+
+    const auto runFrame = [&state, function]() {
+        function(state);
+        state.end();
+    };
+
+    // Warm up, so the arenas have all their pages
+    for (size_t i = 0; i < 10; ++i) {
+        runFrame();
+    }
+
+    const size_t allocationCountBefore = state.getAllocationCount();
+    runFrame();
+    const size_t allocations = state.getAllocationCount() - allocationCountBefore;
+
+    const double seconds = lug::Benchmark::measure([&runFrame]() {
+        for (size_t i = 0; i < Frames; ++i) {
+            runFrame();
+        }
+    }, 5);
+
+    lug::Benchmark::report(name, Frames, seconds);
+
+    std::printf(
+        "[ BENCHMARK ] %-56s %14zu allocs/frame %7.3f us/frame\n",
+        name,
+        allocations,
+        seconds * 1000000.0 / Frames
+    );
+}
+
+}
+
+TEST(BenchmarkStlAllocator, Frame) {
+    run<StdFrame>("std::allocator", frame);
+    run<ArenaFrame>("FrameArena", frame);
+}
+
+TEST(BenchmarkStlAllocator, SceneNodes) {
+    run<StdScene>("Scene nodes std::allocator", sceneFrame);
+    run<ArenaScene>("Scene nodes Scene::Arena", sceneFrame);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/ThreadCache.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t BlockSize = 64;
+constexpr size_t MaxThreadCount = 16;
+constexpr size_t LiveBlocks = 64;
+constexpr size_t Rounds = 2000;
+
+using MutexArena = Arena<
+    Allocator::Chunk<BlockSize>,
+    Policies::MultiThreadPolicy<std::mutex>,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+using CachedArena = Arena<
+    Allocator::ThreadCache<Allocator::Chunk<BlockSize>, std::mutex>,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+// Each thread repeatedly allocates a set of blocks, touches them, and frees them
+template <class ArenaType>
+void run(const char* name, ArenaType& arena, size_t threadCount) {
+    const double seconds = lug::Benchmark::measureThreads(threadCount, [&arena](size_t) {
+        void* blocks[LiveBlocks];
+
+        for (size_t round = 0; round < Rounds; ++round) {
+            for (size_t i = 0; i < LiveBlocks; ++i) {
+                blocks[i] = arena.allocate(BlockSize, BlockSize, 0, __FILE__, __LINE__);
+                *static_cast<size_t*>(blocks[i]) = i;
+            }
+
+            for (size_t i = 0; i < LiveBlocks; ++i) {
+                arena.free(blocks[i]);
+            }
+        }
+    });
+
+    const std::string label = std::string(name) + " (" + std::to_string(threadCount) + " threads)";
+    lug::Benchmark::report(label.c_str(), threadCount * Rounds * LiveBlocks * 2, seconds);
+}
+
+}
+
+TEST(BenchmarkThreadCache, Scaling) {
+    // Enough blocks for every thread plus what the magazines may retain
+    using AreaType = Area::Heap<4096, 2 * MaxThreadCount * LiveBlocks * BlockSize / 4096>;
+
+    for (size_t threadCount : {1, 2, 4, 8, 16}) {
+        {
+            AreaType area;
+            MutexArena arena(&area);
+            run("Chunk + MultiThreadPolicy<std::mutex>", arena, threadCount);
+        }
+
+        {
+            AreaType area;
+            CachedArena arena(&area);
+            run("ThreadCache<Chunk> + SingleThreadPolicy", arena, threadCount);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Allocator/Stack.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+#include <Benchmark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t BlockSize = 32;
+constexpr size_t Iterations = 50000;
+
+template <class Allocator, class ThreadPolicy>
+using ArenaType = Arena<
+    Allocator,
+    ThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+// Chunk: every thread allocates a few blocks and frees them
+template <class ThreadPolicy>
+void runChunk(const char* name, size_t threadCount) {
+    Area::VirtualHeap<> area;
+    ArenaType<Allocator::Chunk<BlockSize>, ThreadPolicy> arena(&area);
+
+    const double seconds = lug::Benchmark::measureThreads(threadCount, [&arena](size_t) {
+        void* blocks[4];
+
+        for (size_t i = 0; i < Iterations / 4; ++i) {
+            for (void*& block : blocks) {
+                block = arena.allocate(BlockSize, BlockSize, 0, __FILE__, __LINE__);
+            }
+
+            for (void* block : blocks) {
+                arena.free(block);
+            }
+        }
+    });
+
+    const std::string label = std::string("Chunk + ") + name + " (" + std::to_string(threadCount) + " threads)";
+    lug::Benchmark::report(label.c_str(), threadCount * Iterations * 2, seconds);
+}
+
+// Linear and Stack: the threads only allocate, the memory is released by the reset
+// (the frees of a stack allocator can't interleave between threads)
+template <class Allocator, class ThreadPolicy>
+void runBump(const char* allocatorName, const char* name, size_t threadCount) {
+    Area::VirtualHeap<> area;
+    ArenaType<Allocator, ThreadPolicy> arena(&area);
+
+    const double seconds = lug::Benchmark::measureThreads(threadCount, [&arena](size_t) {
+        for (size_t i = 0; i < Iterations; ++i) {
+            lug::Benchmark::doNotOptimize(arena.allocate(BlockSize, 8, 0, __FILE__, __LINE__));
+        }
+    });
+
+    arena.reset();
+
+    const std::string label = std::string(allocatorName) + " + " + name + " (" + std::to_string(threadCount) + " threads)";
+    lug::Benchmark::report(label.c_str(), threadCount * Iterations, seconds);
+}
+
+template <class ThreadPolicy>
+void run(const char* name, size_t threadCount) {
+    runChunk<ThreadPolicy>(name, threadCount);
+    runBump<Allocator::Linear, ThreadPolicy>("Linear", name, threadCount);
+    runBump<Allocator::Stack, ThreadPolicy>("Stack", name, threadCount);
+}
+
+}
+
+TEST(BenchmarkThreadPolicy, Scaling) {
+    for (size_t threadCount : {1, 2, 4, 8}) {
+        run<Policies::MultiThreadPolicy<std::mutex>>("std::mutex", threadCount);
+        run<Policies::SpinLockPolicy>("SpinLockPolicy", threadCount);
+        run<Policies::AdaptiveLockPolicy<>>("AdaptiveLockPolicy", threadCount);
+    }
+}
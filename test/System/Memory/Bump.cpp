@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Bump.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <lug/System/Memory/ScopedMark.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+using BumpArena = Arena<
+    Allocator::Bump,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+}
+
+TEST(MemoryBump, Packing) {
+    Area::Heap<4096, 1> area;
+    BumpArena arena(&area);
+
+    // No header between the blocks
+    char* const first = static_cast<char*>(arena.allocate(8, 8, 0, __FILE__, __LINE__));
+    char* const second = static_cast<char*>(arena.allocate(8, 8, 0, __FILE__, __LINE__));
+    ASSERT_EQ(second, first + 8);
+
+    char* const third = static_cast<char*>(arena.allocate(3, 1, 0, __FILE__, __LINE__));
+    ASSERT_EQ(third, second + 8);
+
+    // Only the padding required by the alignment
+    char* const fourth = static_cast<char*>(arena.allocate(16, 16, 0, __FILE__, __LINE__));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fourth) % 16, 0u);
+    ASSERT_LT(fourth, third + 3 + 16);
+
+    // `ptr + offset` is aligned
+    char* const fifth = static_cast<char*>(arena.allocate(40, 32, 8, __FILE__, __LINE__));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fifth + 8) % 32, 0u);
+    ASSERT_GE(fifth, fourth + 16);
+}
+
+TEST(MemoryBump, Pages) {
+    Area::Heap<4096, 2> area;
+    BumpArena arena(&area);
+
+    size_t count = 0;
+    while (arena.allocate(64, 8, 0, __FILE__, __LINE__)) {
+        ++count;
+    }
+
+    ASSERT_EQ(count, 2u * 4096u / 64u);
+
+    // Too big for a page
+    arena.reset();
+    ASSERT_EQ(arena.allocate(5000, 8, 0, __FILE__, __LINE__), nullptr);
+
+    // The pages are reused after a reset
+    arena.reset();
+    count = 0;
+    while (arena.allocate(64, 8, 0, __FILE__, __LINE__)) {
+        ++count;
+    }
+
+    ASSERT_EQ(count, 2u * 4096u / 64u);
+}
+
+TEST(MemoryBump, ScopedMark) {
+    Area::Heap<4096, 4> area;
+    BumpArena arena(&area);
+
+    void* const before = arena.allocate(16, 16, 0, __FILE__, __LINE__);
+    void* inScope = nullptr;
+
+    {
+        ScopedMark<Allocator::Bump> mark(arena.allocator());
+
+        inScope = arena.allocate(16, 16, 0, __FILE__, __LINE__);
+        ASSERT_NE(inScope, before);
+
+        {
+            ScopedMark<Allocator::Bump> nestedMark(arena.allocator());
+
+            // Across pages
+            for (size_t i = 0; i < 200; ++i) {
+                ASSERT_NE(arena.allocate(32, 16, 0, __FILE__, __LINE__), nullptr);
+            }
+        }
+
+        ASSERT_EQ(arena.allocate(16, 16, 0, __FILE__, __LINE__), static_cast<char*>(inScope) + 16);
+    }
+
+    ASSERT_EQ(arena.allocate(16, 16, 0, __FILE__, __LINE__), inScope);
+}
+
+TEST(MemoryBump, ScopedMarkLinear) {
+    Area::Heap<4096, 1> area;
+    Allocator::Linear linear(&area);
+
+    void* inScope = nullptr;
+
+    {
+        ScopedMark<Allocator::Linear> mark(linear);
+        inScope = linear.allocate(64, 8, 0);
+    }
+
+    ASSERT_EQ(linear.allocate(64, 8, 0), inScope);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <lug/System/Memory/FrameArena.hpp>
+
+using namespace lug::System::Memory;
+
+TEST(MemoryFrameArena, Vector) {
+    FrameArena frameArena(2);
+
+    FrameArena::Vector<uint32_t> values(frameArena.getAllocator<uint32_t>());
+    for (uint32_t i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+
+    ASSERT_EQ(values.get_allocator().getArena(), &frameArena);
+    ASSERT_GE(frameArena.getUsedSize(), 1000 * sizeof(uint32_t));
+}
+
+TEST(MemoryFrameArena, NextFrame) {
+    FrameArena frameArena(2);
+
+    void* const first = frameArena.allocate(64, 16, 0, __FILE__, __LINE__);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(first) % 16, 0u);
+
+    // Second frame, the memory of the first frame must stay untouched
+    frameArena.nextFrame();
+    ASSERT_EQ(frameArena.getUsedSize(), 0u);
+
+    void* const second = frameArena.allocate(64, 16, 0, __FILE__, __LINE__);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(second, first);
+
+    // Back to the first frame, its memory is reused
+    frameArena.nextFrame();
+    ASSERT_EQ(frameArena.allocate(64, 16, 0, __FILE__, __LINE__), first);
+}
+
+TEST(MemoryFrameArena, HighWaterMark) {
+    FrameArena frameArena(3);
+
+    frameArena.allocate(100, 8, 0, __FILE__, __LINE__);
+    frameArena.nextFrame();
+
+    frameArena.allocate(300, 8, 0, __FILE__, __LINE__);
+    frameArena.nextFrame();
+
+    frameArena.allocate(200, 8, 0, __FILE__, __LINE__);
+    ASSERT_EQ(frameArena.getHighWaterMark(), 300u);
+
+    frameArena.resetHighWaterMark();
+    ASSERT_EQ(frameArena.getHighWaterMark(), 200u);
+}
+
+TEST(MemoryFrameArena, SystemAllocationCount) {
+    FrameArena frameArena(1);
+
+    // The arena of the frame takes its first page when constructed
+    const size_t pageCount = frameArena.getSystemAllocationCount();
+    ASSERT_GT(pageCount, 0u);
+
+    // Nothing until the page is full
+    frameArena.allocate(64, 8, 0, __FILE__, __LINE__);
+    frameArena.allocate(64, 8, 0, __FILE__, __LINE__);
+    ASSERT_EQ(frameArena.getSystemAllocationCount(), pageCount);
+
+    // The page is reused by the next frame
+    frameArena.nextFrame();
+    frameArena.allocate(64, 8, 0, __FILE__, __LINE__);
+    ASSERT_EQ(frameArena.getSystemAllocationCount(), pageCount);
+
+    // A block bigger than a page
+    frameArena.allocate(FrameArena::PageSize * 2, 8, 0, __FILE__, __LINE__);
+    ASSERT_EQ(frameArena.getSystemAllocationCount(), pageCount + 1);
+}
+
+TEST(MemoryFrameArena, ManyPages) {
+    FrameArena frameArena(1);
+
+    // More than one page per frame, and several frames in a row on the same pages
+    for (size_t frame = 0; frame < 4; ++frame) {
+        for (size_t i = 0; i < 4 * FrameArena::PageSize / 1024; ++i) {
+            ASSERT_NE(frameArena.allocate(1000, 8, 0, __FILE__, __LINE__), nullptr);
+        }
+
+        frameArena.nextFrame();
+    }
+}
+
+TEST(MemoryFrameArena, LargeAllocations) {
+    FrameArena frameArena(2);
+
+    // More than a page in a single vector
+    for (size_t frame = 0; frame < 4; ++frame) {
+        FrameArena::Vector<uint32_t> values(frameArena.getAllocator<uint32_t>());
+        for (uint32_t i = 0; i < 100000; ++i) {
+            values.push_back(i);
+        }
+
+        ASSERT_GT(values.size() * sizeof(uint32_t), FrameArena::PageSize);
+        for (uint32_t i = 0; i < 100000; ++i) {
+            ASSERT_EQ(values[i], i);
+        }
+
+        ASSERT_GE(frameArena.getUsedSize(), 100000 * sizeof(uint32_t));
+        frameArena.nextFrame();
+    }
+
+    // `ptr + offset` is aligned as with the pages
+    char* const ptr = static_cast<char*>(frameArena.allocate(2 * FrameArena::PageSize, 256, 8, __FILE__, __LINE__));
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr + 8) % 256, 0u);
+
+    // The small allocations still come from the pages
+    ASSERT_NE(frameArena.allocate(64, 16, 0, __FILE__, __LINE__), nullptr);
+}
+
+TEST(MemoryFrameArena, AllocatorSemantics) {
+    FrameArena frameArenaA(1);
+    FrameArena frameArenaB(1);
+
+    FrameArena::Allocator<int> allocatorA(frameArenaA);
+    FrameArena::Allocator<float> allocatorA2(frameArenaA);
+    FrameArena::Allocator<int> allocatorB(frameArenaB);
+
+    ASSERT_TRUE(allocatorA == allocatorA2);
+    ASSERT_TRUE(allocatorA != allocatorB);
+
+    // The arena follows the container on move assignment
+    FrameArena::Vector<int> a({1, 2, 3}, allocatorA);
+    FrameArena::Vector<int> b(allocatorB);
+
+    b = std::move(a);
+    ASSERT_EQ(b.get_allocator().getArena(), &frameArenaA);
+    ASSERT_EQ(b.size(), 3u);
+}
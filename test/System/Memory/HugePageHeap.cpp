@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/HugePageHeap.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t PageSize = 2 * 1024 * 1024;
+
+template <class AreaType>
+void testArea(Area::VirtualMemory::HugePages requested) {
+    AreaType area;
+
+    // Never better than requested, the fallback can only go down
+    ASSERT_LE(static_cast<uint8_t>(area.getHugePages()), static_cast<uint8_t>(requested));
+
+    Area::Page* first = area.requestNextPage();
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first->prev, nullptr);
+    std::memset(first->start, 0xAB, PageSize);
+
+    Area::Page* second = area.requestNextPage();
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(second->prev, first);
+    ASSERT_EQ(second->start, static_cast<char*>(first->end) + 1);
+    std::memset(second->start, 0xCD, PageSize);
+
+    ASSERT_EQ(area.requestNextPage(), nullptr);
+}
+
+}
+
+TEST(MemoryHugePageHeap, HugePageSize) {
+    const size_t hugePageSize = Area::VirtualMemory::getHugePageSize();
+
+    // Unknown, or a power of two bigger than the normal pages
+    if (hugePageSize) {
+        ASSERT_EQ(hugePageSize & (hugePageSize - 1), 0u);
+        ASSERT_GT(hugePageSize, Area::VirtualMemory::getPageSize());
+    }
+}
+
+TEST(MemoryHugePageHeap, Fallback) {
+    using Area::VirtualMemory::HugePages;
+
+    testArea<Area::HugePageHeap<PageSize, 2, HugePages::None>>(HugePages::None);
+    testArea<Area::HugePageHeap<PageSize, 2, HugePages::Transparent>>(HugePages::Transparent);
+    testArea<Area::HugePageHeap<PageSize, 2, HugePages::Explicit>>(HugePages::Explicit);
+
+    // An invalid node is ignored
+    testArea<Area::HugePageHeap<PageSize, 2, HugePages::Transparent, 0>>(HugePages::Transparent);
+    testArea<Area::HugePageHeap<PageSize, 2, HugePages::Transparent, 63>>(HugePages::Transparent);
+}
+
+TEST(MemoryHugePageHeap, Linear) {
+    Area::HugePageHeap<PageSize, 4> area;
+
+    Arena<
+        Allocator::Linear,
+        Policies::SingleThreadPolicy,
+        Policies::NoBoundsChecking,
+        Policies::NoMemoryMarking
+    > arena(&area);
+
+    for (size_t i = 0; i < 7; ++i) {
+        void* block = arena.allocate(PageSize / 4, 64, 0, __FILE__, __LINE__);
+        ASSERT_NE(block, nullptr);
+        std::memset(block, static_cast<int>(i), PageSize / 4);
+    }
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/MappedHeap.hpp>
+#include <lug/System/Memory/OffsetPtr.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+using MappedArena = Arena<
+    Allocator::Linear,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+const std::string fileName = "MappedHeap.snapshot";
+
+struct Node {
+    uint32_t id;
+    offset_ptr<char> name;
+    offset_ptr<Node> next;
+};
+
+struct Scene {
+    uint32_t nodeCount{0};
+    offset_ptr<Node> first;
+};
+
+Scene* buildScene(MappedArena& arena, uint32_t nodeCount) {
+    Scene* const scene = LUG_NEW(Scene, arena);
+    Node* last = nullptr;
+
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        Node* const node = LUG_NEW(Node, arena);
+        const std::string name = "node" + std::to_string(i);
+
+        node->id = i;
+        node->name = LUG_NEW_ARRAY_SIZE(char, name.size() + 1, arena);
+        std::memcpy(node->name.get(), name.c_str(), name.size() + 1);
+
+        if (last) {
+            last->next = node;
+        } else {
+            scene->first = node;
+        }
+
+        last = node;
+        ++scene->nodeCount;
+    }
+
+    return scene;
+}
+
+void checkScene(const Scene* scene, uint32_t nodeCount) {
+    ASSERT_NE(scene, nullptr);
+    ASSERT_EQ(scene->nodeCount, nodeCount);
+
+    uint32_t i = 0;
+    for (const Node* node = scene->first.get(); node; node = node->next.get(), ++i) {
+        ASSERT_EQ(node->id, i);
+        ASSERT_STREQ(node->name.get(), ("node" + std::to_string(i)).c_str());
+    }
+
+    ASSERT_EQ(i, nodeCount);
+}
+
+}
+
+TEST(MemoryMappedHeap, OffsetPtr) {
+    struct Pair {
+        int value;
+        offset_ptr<int> ptr;
+    };
+
+    Pair pair{42, nullptr};
+    ASSERT_FALSE(pair.ptr);
+    ASSERT_EQ(pair.ptr, nullptr);
+
+    pair.ptr = &pair.value;
+    ASSERT_TRUE(pair.ptr);
+    ASSERT_EQ(*pair.ptr, 42);
+
+    // The copy points to the same object, from its own location
+    Pair copy = pair;
+    ASSERT_EQ(copy.ptr.get(), &pair.value);
+
+    // The raw bytes point to the same relative location
+    Pair moved;
+    std::memcpy(static_cast<void*>(&moved), &pair, sizeof(Pair));
+    ASSERT_EQ(moved.ptr.get(), &moved.value);
+
+    copy.ptr = nullptr;
+    ASSERT_EQ(copy.ptr.get(), nullptr);
+}
+
+TEST(MemoryMappedHeap, RoundTrip) {
+    {
+        Area::MappedHeap area(1024 * 1024);
+        MappedArena arena(&area);
+
+        Scene* const scene = buildScene(arena, 1000);
+        area.setRoot(scene);
+
+        ASSERT_TRUE(area.save(fileName, arena.allocator().getMark().current));
+    }
+
+    {
+        // Another area is alive, the snapshot can't be mapped at the same address
+        Area::MappedHeap other(1024 * 1024);
+
+        Area::MappedHeap area(64 * 1024);
+        ASSERT_TRUE(area.load(fileName));
+        ASSERT_GE(area.getCapacity(), 1024u * 1024u);
+        ASSERT_GT(area.getSnapshotSize(), Area::MappedHeap::HeaderSize);
+
+        Scene* const scene = area.getRoot<Scene>();
+        ASSERT_TRUE(area.contains(scene));
+        checkScene(scene, 1000);
+
+        // The arena continues after the snapshot
+        MappedArena arena(&area);
+        char* const ptr = static_cast<char*>(arena.allocate(128, 8, 0, __FILE__, __LINE__));
+        ASSERT_TRUE(area.contains(ptr));
+        std::memset(ptr, 0xFF, 128);
+        checkScene(scene, 1000);
+
+        // And keeps it when reset
+        arena.reset();
+        ASSERT_EQ(arena.allocate(128, 8, 0, __FILE__, __LINE__), ptr);
+
+        // The snapshot is copy-on-write
+        scene->nodeCount = 0;
+    }
+
+    {
+        Area::MappedHeap area(64 * 1024);
+        ASSERT_TRUE(area.load(fileName));
+        checkScene(area.getRoot<Scene>(), 1000);
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(MemoryMappedHeap, SnapshotOfSnapshot) {
+    {
+        Area::MappedHeap area(1024 * 1024);
+        MappedArena arena(&area);
+
+        area.setRoot(buildScene(arena, 10));
+        ASSERT_TRUE(area.save(fileName, arena.allocator().getMark().current));
+    }
+
+    {
+        Area::MappedHeap area(64 * 1024);
+        ASSERT_TRUE(area.load(fileName));
+
+        // Extend the loaded scene and save it again
+        MappedArena arena(&area);
+        Scene* const scene = buildScene(arena, 20);
+        area.setRoot(scene);
+        ASSERT_TRUE(area.save(fileName, arena.allocator().getMark().current));
+    }
+
+    {
+        Area::MappedHeap area(64 * 1024);
+        ASSERT_TRUE(area.load(fileName));
+        checkScene(area.getRoot<Scene>(), 20);
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(MemoryMappedHeap, InvalidSnapshot) {
+    Area::MappedHeap area(64 * 1024);
+
+    ASSERT_FALSE(area.load("MappedHeap.missing"));
+
+    // Not a snapshot
+    std::FILE* file = std::fopen(fileName.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    const char garbage[128] = "This is not a snapshot";
+    std::fwrite(garbage, 1, sizeof(garbage), file);
+    std::fclose(file);
+
+    ASSERT_FALSE(area.load(fileName));
+
+    // The area is still usable
+    ASSERT_EQ(area.getSnapshotSize(), 0u);
+    ASSERT_EQ(area.getRoot<Scene>(), nullptr);
+
+    MappedArena arena(&area);
+    ASSERT_NE(arena.allocate(128, 8, 0, __FILE__, __LINE__), nullptr);
+
+    std::remove(fileName.c_str());
+}
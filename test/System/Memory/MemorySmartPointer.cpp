@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Basic.hpp>
+#include <lug/System/Memory/IntrusivePtr.hpp>
+#include <System/Memory/Utils.hpp>
+
+using namespace ::testing;
+using namespace lug::System::Memory;
+
+namespace {
+
+using BasicArena = Arena<
+    Allocator::Basic,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+BasicArena staticArena;
+
+class Counted : public IntrusiveRefCount {
+public:
+    Counted(int value, int* destroyed) : value{value}, _destroyed{destroyed} {}
+
+    ~Counted() {
+        ++(*_destroyed);
+    }
+
+    int value;
+
+private:
+    int* _destroyed;
+};
+
+}
+
+TEST(MemorySmartPointer, Size) {
+    ASSERT_EQ(sizeof(unique_ptr<int, BasicArena>), 2 * sizeof(void*));
+    ASSERT_EQ(sizeof(unique_ptr<int[], BasicArena>), 2 * sizeof(void*));
+    ASSERT_EQ(sizeof(static_unique_ptr<int, BasicArena, staticArena>), sizeof(void*));
+    ASSERT_EQ(sizeof(intrusive_ptr<Counted, BasicArena>), 2 * sizeof(void*));
+}
+
+TEST(MemorySmartPointer, UniqueOne) {
+    MockArena arena;
+    alignas(alignof(MockObject)) char buffer[4096];
+
+    EXPECT_CALL(arena, allocate(sizeof(MockObject), alignof(MockObject), 0, _, _))
+        .WillOnce(Return(&(buffer)));
+
+    EXPECT_CALL(arena, free(&(buffer)))
+        .Times(1);
+
+    {
+        unique_ptr<MockObject, MockArena> ptr = make_unique<MockObject>(arena);
+
+        ASSERT_EQ(static_cast<void*>(ptr.get()), static_cast<void*>(&buffer));
+        ASSERT_EQ(ptr.get_deleter().getArena(), &arena);
+
+        EXPECT_CALL(*ptr, destructor())
+            .Times(1);
+    }
+}
+
+TEST(MemorySmartPointer, UniqueArray) {
+    BasicArena arena;
+
+    unique_ptr<int[], BasicArena> dynamicArray = make_unique<int[]>(arena, 10);
+    ASSERT_NE(dynamicArray, nullptr);
+
+    for (int i = 0; i < 10; ++i) {
+        dynamicArray[i] = i;
+    }
+
+    ASSERT_EQ(dynamicArray[9], 9);
+
+    int destroyed = 0;
+
+    {
+        unique_ptr<Counted[], BasicArena> staticArray = make_unique<Counted[4]>(arena, 42, &destroyed);
+        ASSERT_NE(staticArray, nullptr);
+        ASSERT_EQ(staticArray[3].value, 42);
+    }
+
+    ASSERT_EQ(destroyed, 4);
+}
+
+TEST(MemorySmartPointer, UniqueStatic) {
+    int destroyed = 0;
+
+    {
+        auto ptr = make_static_unique<Counted, BasicArena, staticArena>(42, &destroyed);
+        ASSERT_EQ(ptr->value, 42);
+    }
+
+    ASSERT_EQ(destroyed, 1);
+}
+
+TEST(MemorySmartPointer, Shared) {
+    MockArena arena;
+    char buffer[4096];
+
+    // The control block and the object in one allocation
+    EXPECT_CALL(arena, allocate(_, _, 0, _, _))
+        .WillOnce(Return(&(buffer)));
+
+    EXPECT_CALL(arena, free(&(buffer)))
+        .Times(1);
+
+    {
+        shared_ptr<int> ptr = make_shared<int>(arena, 42);
+        shared_ptr<int> copy = ptr;
+
+        ASSERT_EQ(*copy, 42);
+        ASSERT_EQ(ptr.use_count(), 2);
+    }
+}
+
+TEST(MemorySmartPointer, Intrusive) {
+    BasicArena arena;
+    int destroyed = 0;
+
+    {
+        intrusive_ptr<Counted, BasicArena> ptr = make_intrusive<Counted>(arena, 42, &destroyed);
+        ASSERT_EQ(ptr->getRefCount(), 1u);
+        ASSERT_EQ(ptr.getArena(), &arena);
+
+        {
+            intrusive_ptr<Counted, BasicArena> copy = ptr;
+            ASSERT_EQ(ptr->getRefCount(), 2u);
+            ASSERT_TRUE(copy == ptr);
+
+            // A new reference from the raw pointer shares the same counter
+            intrusive_ptr<Counted, BasicArena> fromRaw(ptr.get(), arena);
+            ASSERT_EQ(ptr->getRefCount(), 3u);
+        }
+
+        ASSERT_EQ(ptr->getRefCount(), 1u);
+
+        intrusive_ptr<Counted, BasicArena> moved = std::move(ptr);
+        ASSERT_FALSE(ptr);
+        ASSERT_EQ(moved->getRefCount(), 1u);
+
+        moved = moved;
+        ASSERT_EQ(moved->getRefCount(), 1u);
+        ASSERT_EQ(destroyed, 0);
+
+        moved.reset();
+        ASSERT_EQ(destroyed, 1);
+    }
+
+    ASSERT_EQ(destroyed, 1);
+}
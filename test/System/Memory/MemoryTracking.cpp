@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+using TrackedArena = Arena<
+    Allocator::Linear,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking,
+    Policies::SimpleMemoryTracking
+>;
+
+using UntrackedArena = Arena<
+    Allocator::Linear,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+// Counts the leak reports of the trackers, added once to the internal logger for the whole test program
+class WarningCounter : public lug::System::Logger::Handler {
+public:
+    WarningCounter() : Handler("MemoryTrackingWarnings") {}
+
+    void handle(const lug::System::Logger::priv::Message& msg) override {
+        if (msg.level == lug::System::Logger::Level::Warning) {
+            ++count;
+        }
+    }
+
+    void flush() override {}
+
+    static WarningCounter& get() {
+        static WarningCounter counter;
+        static bool added = (LUG_LOG.addHandler(&counter), true);
+        (void)added;
+
+        return counter;
+    }
+
+    size_t count{0};
+};
+
+}
+
+TEST(MemoryTracking, DefaultPolicy) {
+    ASSERT_TRUE((std::is_same<UntrackedArena, Arena<
+        Allocator::Linear,
+        Policies::SingleThreadPolicy,
+        Policies::NoBoundsChecking,
+        Policies::NoMemoryMarking,
+        Policies::NoMemoryTracking
+    >>::value));
+
+    ASSERT_TRUE(std::is_empty<Policies::NoMemoryTracking>::value);
+}
+
+TEST(MemoryTracking, Counters) {
+    Area::Heap<4096, 4> area;
+    TrackedArena arena(&area);
+
+    void* const a = arena.allocate(100, 8, 0, "a.cpp", 1);
+    void* const b = arena.allocate(200, 16, 0, "b.cpp", 2);
+    void* const c = arena.allocate(50, 8, 0, "a.cpp", 1);
+
+    const Policies::SimpleMemoryTracking& tracker = arena.memoryTracker();
+
+    ASSERT_EQ(tracker.getLiveCount(), 3u);
+    ASSERT_EQ(tracker.getLiveBytes(), 350u);
+    ASSERT_EQ(tracker.getPeakBytes(), 350u);
+
+    arena.free(b);
+    arena.free(a);
+
+    ASSERT_EQ(tracker.getLiveCount(), 1u);
+    ASSERT_EQ(tracker.getLiveBytes(), 50u);
+    ASSERT_EQ(tracker.getPeakBytes(), 350u);
+
+    // One site per file and line
+    ASSERT_EQ(tracker.getSites().size(), 2u);
+
+    for (const Policies::SimpleMemoryTracking::Site& site : tracker.getSites()) {
+        if (site.line == 1) {
+            ASSERT_STREQ(site.file, "a.cpp");
+            ASSERT_EQ(site.allocationCount, 2u);
+            ASSERT_EQ(site.liveCount, 1u);
+            ASSERT_EQ(site.liveBytes, 50u);
+        } else {
+            ASSERT_STREQ(site.file, "b.cpp");
+            ASSERT_EQ(site.allocationCount, 1u);
+            ASSERT_EQ(site.liveCount, 0u);
+        }
+    }
+
+    // The remaining allocation is the leak
+    size_t leakCount = 0;
+    tracker.forEachAllocation([&](void* ptr, size_t size, size_t alignment, const Policies::SimpleMemoryTracking::Site& site) {
+        ASSERT_EQ(ptr, c);
+        ASSERT_EQ(size, 50u);
+        ASSERT_EQ(alignment, 8u);
+        ASSERT_EQ(site.line, 1u);
+        ++leakCount;
+    });
+
+    ASSERT_EQ(leakCount, 1u);
+
+    arena.free(c);
+}
+
+TEST(MemoryTracking, ManyAllocations) {
+    Area::Heap<64 * 1024, 16> area;
+    TrackedArena arena(&area);
+
+    // Enough allocations to grow the table several times, freed in an order that shifts the clusters
+    std::vector<void*> pointers;
+    for (size_t i = 0; i < 10000; ++i) {
+        pointers.push_back(arena.allocate(8 + i % 64, 8, 0, __FILE__, __LINE__ + i % 3));
+        ASSERT_NE(pointers.back(), nullptr);
+    }
+
+    const Policies::SimpleMemoryTracking& tracker = arena.memoryTracker();
+    ASSERT_EQ(tracker.getLiveCount(), 10000u);
+    ASSERT_EQ(tracker.getSites().size(), 3u);
+
+    for (size_t i = 0; i < pointers.size(); i += 3) {
+        arena.free(pointers[i]);
+    }
+
+    size_t liveCount = 0;
+    tracker.forEachAllocation([&](void*, size_t, size_t, const Policies::SimpleMemoryTracking::Site&) {
+        ++liveCount;
+    });
+
+    ASSERT_EQ(liveCount, tracker.getLiveCount());
+    ASSERT_EQ(tracker.getLiveCount(), 10000u - 3334u);
+
+    for (size_t i = 0; i < pointers.size(); ++i) {
+        if (i % 3) {
+            arena.free(pointers[i]);
+        }
+    }
+
+    ASSERT_EQ(tracker.getLiveCount(), 0u);
+    ASSERT_EQ(tracker.getLiveBytes(), 0u);
+}
+
+TEST(MemoryTracking, Reset) {
+    Area::Heap<4096, 1> area;
+    TrackedArena arena(&area);
+
+    arena.allocate(100, 8, 0, __FILE__, __LINE__);
+    arena.allocate(100, 8, 0, __FILE__, __LINE__);
+
+    // Everything is released by the reset, nothing leaks
+    arena.reset();
+
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), 0u);
+    ASSERT_EQ(arena.memoryTracker().getLiveBytes(), 0u);
+    ASSERT_EQ(arena.memoryTracker().getPeakBytes(), 200u);
+}
+
+TEST(MemoryTracking, NewDelete) {
+    Area::Heap<4096, 1> area;
+    TrackedArena arena(&area);
+
+    struct Object {
+        uint64_t values[4];
+    };
+
+    Object* const object = LUG_NEW(Object, arena);
+    uint32_t* const array = LUG_NEW_ARRAY_SIZE(uint32_t, 16, arena);
+
+    // The sites are the lines of the macros
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), 2u);
+    ASSERT_EQ(arena.memoryTracker().getSites()[0].file, __FILE__);
+
+    LUG_DELETE(object, arena);
+    LUG_DELETE_ARRAY(array, arena);
+
+    ASSERT_EQ(arena.memoryTracker().getLiveCount(), 0u);
+}
+
+TEST(MemoryTracking, Move) {
+    WarningCounter& warnings = WarningCounter::get();
+
+    Policies::SimpleMemoryTracking tracker;
+    tracker.trackAllocation(&warnings, 100, 8, __FILE__, __LINE__);
+    tracker.trackAllocation(&tracker, 200, 8, __FILE__, __LINE__);
+
+    {
+        const size_t count = warnings.count;
+
+        // The moved-from tracker is empty, its destructor doesn't report the allocations
+        Policies::SimpleMemoryTracking moved(std::move(tracker));
+        ASSERT_EQ(moved.getLiveCount(), 2u);
+        ASSERT_EQ(moved.getLiveBytes(), 300u);
+        ASSERT_EQ(tracker.getLiveCount(), 0u);
+        ASSERT_EQ(tracker.getLiveBytes(), 0u);
+        ASSERT_TRUE(tracker.getSites().empty());
+
+        tracker = std::move(moved);
+        ASSERT_EQ(tracker.getLiveCount(), 2u);
+        ASSERT_EQ(moved.getLiveCount(), 0u);
+
+        // Still usable after the move
+        uint32_t value = 0;
+        moved.trackAllocation(&value, 4, 4, __FILE__, __LINE__);
+        moved.trackDeallocation(&value);
+        ASSERT_EQ(moved.getLiveCount(), 0u);
+
+        ASSERT_EQ(warnings.count, count);
+    }
+
+    tracker.trackDeallocation(&warnings);
+    tracker.trackDeallocation(&tracker);
+    ASSERT_EQ(tracker.getLiveCount(), 0u);
+}
+
+TEST(MemoryTracking, MoveArena) {
+    WarningCounter& warnings = WarningCounter::get();
+    const size_t count = warnings.count;
+
+    Area::Heap<4096, 1> area;
+
+    {
+        TrackedArena arena(&area);
+        void* const ptr = arena.allocate(100, 8, 0, __FILE__, __LINE__);
+
+        TrackedArena moved(std::move(arena));
+        ASSERT_EQ(moved.memoryTracker().getLiveCount(), 1u);
+        moved.free(ptr);
+    }
+
+    // Neither the moved-from arena nor the other one has a leak to report
+    ASSERT_EQ(warnings.count, count);
+}
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/SizeClass.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+using SizeClass = Allocator::SizeClass<>;
+using AreaType = Area::Heap<1024 * 1024, 16>;
+
+using SizeClassArena = Arena<
+    SizeClass,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+using CheckedSizeClassArena = Arena<
+    SizeClass,
+    Policies::SingleThreadPolicy,
+    Policies::SimpleBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+}
+
+TEST(MemorySizeClass, ClassIndex) {
+    ASSERT_EQ(SizeClass::getClassIndex(0, 1), 0u);
+    ASSERT_EQ(SizeClass::getClassIndex(16, 16), 0u);
+    ASSERT_EQ(SizeClass::getClassIndex(17, 8), 1u);
+    ASSERT_EQ(SizeClass::getClassIndex(33, 8), 2u);
+    ASSERT_EQ(SizeClass::getClassIndex(48, 16), 2u);
+    ASSERT_EQ(SizeClass::getClassIndex(49, 8), 3u);
+    ASSERT_EQ(SizeClass::getClassIndex(3072, 8), 14u);
+    ASSERT_EQ(SizeClass::getClassIndex(4096, 8), 15u);
+    ASSERT_EQ(SizeClass::getClassIndex(4097, 8), SizeClass::ClassCount);
+
+    // The class of 48 bytes only guarantees an alignment of 16
+    ASSERT_EQ(SizeClass::getClassIndex(40, 32), 3u);
+    ASSERT_EQ(SizeClass::getClassIndex(16, 256), 7u);
+    ASSERT_EQ(SizeClass::getClassIndex(16, 8192), SizeClass::ClassCount);
+
+    // Every size is served by the smallest class big enough
+    for (size_t size = 1; size <= SizeClass::MaxClassSize; ++size) {
+        const size_t index = SizeClass::getClassIndex(size, 1);
+
+        ASSERT_LT(index, SizeClass::ClassCount);
+        ASSERT_GE(SizeClass::getClassSize(index), size);
+        ASSERT_TRUE(index == 0 || SizeClass::getClassSize(index - 1) < size);
+    }
+}
+
+TEST(MemorySizeClass, AllocateFree) {
+    AreaType area;
+    SizeClassArena arena(&area);
+
+    struct Allocation {
+        char* ptr;
+        size_t size;
+    };
+
+    std::vector<Allocation> allocations;
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t size = (i % 10 == 0) ? 5000 + i : 1 + (i * 37) % SizeClass::MaxClassSize;
+        const size_t alignment = size_t(1) << (i % 8);
+
+        char* const ptr = static_cast<char*>(arena.allocate(size, alignment, 0, __FILE__, __LINE__));
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+        ASSERT_GE(arena.allocator().getSize(ptr), size);
+
+        std::memset(ptr, static_cast<int>(i & 0xFF), size);
+        allocations.push_back({ptr, size});
+    }
+
+    // No allocation overlaps another one
+    for (size_t i = 0; i < allocations.size(); ++i) {
+        for (size_t j = 0; j < allocations[i].size; ++j) {
+            ASSERT_EQ(static_cast<unsigned char>(allocations[i].ptr[j]), i & 0xFF);
+        }
+    }
+
+    for (const Allocation& allocation : allocations) {
+        arena.free(allocation.ptr);
+    }
+}
+
+TEST(MemorySizeClass, Reuse) {
+    AreaType area;
+    SizeClassArena arena(&area);
+
+    // Small blocks go back to the pool of their class
+    std::set<void*> pointers;
+    for (size_t i = 0; i < 100; ++i) {
+        pointers.insert(arena.allocate(100, 8, 0, __FILE__, __LINE__));
+    }
+
+    for (void* ptr : pointers) {
+        arena.free(ptr);
+    }
+
+    for (size_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(pointers.count(arena.allocate(120, 8, 0, __FILE__, __LINE__)), 1u);
+    }
+
+    // Big blocks go back to the free runs
+    void* const big = arena.allocate(100 * 1024, 64, 0, __FILE__, __LINE__);
+    ASSERT_NE(big, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(big) % 64, 0u);
+    ASSERT_GE(arena.allocator().getSize(big), 100u * 1024u);
+
+    arena.free(big);
+    ASSERT_EQ(arena.allocate(90 * 1024, 64, 0, __FILE__, __LINE__), big);
+}
+
+TEST(MemorySizeClass, Reset) {
+    AreaType area;
+    SizeClassArena arena(&area);
+
+    void* const small = arena.allocate(64, 64, 0, __FILE__, __LINE__);
+    void* const big = arena.allocate(200 * 1024, 16, 0, __FILE__, __LINE__);
+
+    arena.reset();
+
+    // The same memory is handed out again, without requesting new pages
+    ASSERT_EQ(arena.allocate(64, 64, 0, __FILE__, __LINE__), small);
+    ASSERT_EQ(arena.allocate(200 * 1024, 16, 0, __FILE__, __LINE__), big);
+}
+
+TEST(MemorySizeClass, LazyClasses) {
+    Area::VirtualHeap<1024 * 1024> area(64 * 1024 * 1024);
+    SizeClassArena arena(&area);
+
+    // No slab before the first allocation
+    ASSERT_EQ(area.getPageCount(), 0u);
+
+    void* const ptr = arena.allocate(100, 8, 0, __FILE__, __LINE__);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(area.getPageCount(), 1u);
+
+    arena.free(ptr);
+}
+
+TEST(MemorySizeClass, SplitAndMerge) {
+    constexpr size_t SlabSize = 64 * 1024;
+
+    Area::VirtualHeap<1024 * 1024> area(64 * 1024 * 1024);
+    SizeClassArena arena(&area);
+
+    // A run of several slabs, freed
+    char* const big = static_cast<char*>(arena.allocate(5 * SlabSize, 16, 0, __FILE__, __LINE__));
+    ASSERT_NE(big, nullptr);
+    arena.free(big);
+
+    const size_t pageCount = area.getPageCount();
+
+    // The small runs are cut from the freed one, one slab each
+    char* const first = static_cast<char*>(arena.allocate(5000, 16, 0, __FILE__, __LINE__));
+    char* const second = static_cast<char*>(arena.allocate(5000, 16, 0, __FILE__, __LINE__));
+
+    ASSERT_EQ(first, big);
+    ASSERT_EQ(second, big + SlabSize);
+    ASSERT_LT(arena.allocator().getSize(first), SlabSize);
+
+    // Merged again once freed, in any order
+    arena.free(second);
+    arena.free(first);
+
+    ASSERT_EQ(arena.allocate(5 * SlabSize, 16, 0, __FILE__, __LINE__), big);
+    ASSERT_EQ(area.getPageCount(), pageCount);
+}
+
+TEST(MemorySizeClass, PageRest) {
+    constexpr size_t SlabSize = 64 * 1024;
+
+    Area::VirtualHeap<1024 * 1024> area(64 * 1024 * 1024);
+    SizeClassArena arena(&area);
+
+    // The second run doesn't fit in the rest of the first page
+    ASSERT_NE(arena.allocate(10 * SlabSize, 16, 0, __FILE__, __LINE__), nullptr);
+    ASSERT_NE(arena.allocate(10 * SlabSize, 16, 0, __FILE__, __LINE__), nullptr);
+    ASSERT_EQ(area.getPageCount(), 2u);
+
+    // The rest of the first page is used instead of a new page
+    ASSERT_NE(arena.allocate(3 * SlabSize, 16, 0, __FILE__, __LINE__), nullptr);
+    ASSERT_EQ(area.getPageCount(), 2u);
+}
+
+TEST(MemorySizeClass, OutOfMemory) {
+    AreaType area;
+    SizeClassArena arena(&area);
+
+    // Too big for a page of the area
+    ASSERT_EQ(arena.allocate(2 * 1024 * 1024, 8, 0, __FILE__, __LINE__), nullptr);
+
+    // The class has its slab before the area runs out
+    ASSERT_NE(arena.allocate(16, 8, 0, __FILE__, __LINE__), nullptr);
+
+    // The area is exhausted at some point
+    size_t count = 0;
+    while (arena.allocate(32 * 1024, 8, 0, __FILE__, __LINE__)) {
+        ++count;
+    }
+
+    ASSERT_GT(count, 0u);
+    ASSERT_NE(arena.allocate(16, 8, 0, __FILE__, __LINE__), nullptr);
+}
+
+TEST(MemorySizeClass, BoundsChecking) {
+    AreaType area;
+    CheckedSizeClassArena arena(&area);
+
+    // The bounds checker shifts the allocations by an offset
+    for (size_t size : {8, 40, 100, 4000, 10000}) {
+        char* const ptr = static_cast<char*>(arena.allocate(size, 16, 0, __FILE__, __LINE__));
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 16, 0u);
+
+        std::memset(ptr, 0, size);
+        arena.free(ptr);
+    }
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Basic.hpp>
+#include <lug/Graphics/Scene/Allocator.hpp>
+#include <System/Memory/Utils.hpp>
+
+using namespace ::testing;
+using namespace lug::System::Memory;
+
+namespace {
+
+using BasicArena = Arena<
+    Allocator::Basic,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+}
+
+TEST(MemoryStlAllocator, Traits) {
+    using Traits = std::allocator_traits<StlAllocator<int, BasicArena>>;
+
+    ASSERT_TRUE((std::is_same<Traits::rebind_alloc<double>, StlAllocator<double, BasicArena>>::value));
+    ASSERT_TRUE(Traits::propagate_on_container_copy_assignment::value);
+    ASSERT_TRUE(Traits::propagate_on_container_move_assignment::value);
+    ASSERT_TRUE(Traits::propagate_on_container_swap::value);
+    ASSERT_FALSE(Traits::is_always_equal::value);
+}
+
+TEST(MemoryStlAllocator, AllocateAndFree) {
+    MockArena arena;
+    alignas(alignof(uint64_t)) char buffer[4096];
+
+    EXPECT_CALL(arena, allocate(10 * sizeof(uint64_t), alignof(uint64_t), 0, _, _))
+        .WillOnce(Return(&(buffer)));
+
+    EXPECT_CALL(arena, free(&(buffer)))
+        .Times(1);
+
+    StlAllocator<uint64_t, MockArena> allocator(arena);
+
+    uint64_t* ptr = allocator.allocate(10);
+    ASSERT_EQ(static_cast<void*>(ptr), static_cast<void*>(&buffer));
+
+    allocator.deallocate(ptr, 10);
+}
+
+TEST(MemoryStlAllocator, AllocateNull) {
+    NullArena arena;
+    StlAllocator<int, NullArena> allocator(arena);
+
+    ASSERT_THROW(allocator.allocate(1), std::bad_alloc);
+}
+
+TEST(MemoryStlAllocator, Containers) {
+    BasicArena arena;
+
+    {
+        std::vector<int, StlAllocator<int, BasicArena>> vector(StlAllocator<int, BasicArena>{arena});
+
+        for (int i = 0; i < 1000; ++i) {
+            vector.push_back(i);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(vector[i], i);
+        }
+    }
+
+    {
+        using String = std::basic_string<char, std::char_traits<char>, StlAllocator<char, BasicArena>>;
+
+        String string("A string long enough to not fit in the small buffer", StlAllocator<char, BasicArena>{arena});
+        string += " and grows";
+
+        ASSERT_EQ(string, "A string long enough to not fit in the small buffer and grows");
+    }
+
+    {
+        using Allocator = StlAllocator<std::pair<const int, int>, BasicArena>;
+
+        std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Allocator> map(0, std::hash<int>(), std::equal_to<int>(), Allocator{arena});
+
+        for (int i = 0; i < 1000; ++i) {
+            map[i] = i * 2;
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(map[i], i * 2);
+        }
+    }
+}
+
+TEST(MemoryStlAllocator, Equality) {
+    BasicArena arenaA;
+    BasicArena arenaB;
+
+    const StlAllocator<int, BasicArena> allocatorA(arenaA);
+    const StlAllocator<float, BasicArena> allocatorA2(arenaA);
+    const StlAllocator<int, BasicArena> allocatorB(arenaB);
+
+    ASSERT_TRUE(allocatorA == allocatorA2);
+    ASSERT_TRUE(allocatorA != allocatorB);
+
+    // Rebound copies share the arena
+    const StlAllocator<double, BasicArena> rebound(allocatorA);
+    ASSERT_EQ(rebound.getArena(), &arenaA);
+    ASSERT_TRUE(rebound == allocatorA);
+}
+
+// The containers of the scene nodes, with nodes created and destroyed in a loop as in an editor
+TEST(MemoryStlAllocator, SceneNodes) {
+    using MovableObjects = lug::Graphics::Scene::Vector<void*>;
+    using SceneAllocator = lug::Graphics::Scene::Allocator<void*>;
+
+    lug::Graphics::Scene::Area area(lug::Graphics::Scene::AreaReservedSize);
+    lug::Graphics::Scene::Arena arena(&area);
+
+    // Nothing is taken before the first node
+    ASSERT_EQ(area.getPageCount(), 0u);
+
+    size_t pageCount = 0;
+    for (size_t round = 0; round < 50; ++round) {
+        std::vector<MovableObjects> nodes;
+
+        for (size_t i = 0; i < 32; ++i) {
+            nodes.emplace_back(SceneAllocator(arena));
+
+            for (size_t j = 0; j < (i * 97) % 3000; ++j) {
+                nodes.back().push_back(&nodes);
+            }
+        }
+
+        if (round == 0) {
+            pageCount = area.getPageCount();
+        }
+    }
+
+    // The memory of the destroyed nodes is reused
+    ASSERT_GT(pageCount, 0u);
+    ASSERT_EQ(area.getPageCount(), pageCount);
+
+    // A single node with many more objects than a 64KB page
+    MovableObjects node{SceneAllocator(arena)};
+    for (size_t i = 0; i < 100000; ++i) {
+        node.push_back(&node);
+    }
+
+    ASSERT_EQ(node.size(), 100000u);
+}
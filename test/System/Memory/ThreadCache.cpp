@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/ThreadCache.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+using CachedArena = Arena<
+    Allocator::ThreadCache<Allocator::Chunk<32, 16>, std::mutex, 8>,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+}
+
+TEST(MemoryThreadCache, AllocateFree) {
+    Area::Heap<4096, 4> area;
+    CachedArena arena(&area);
+
+    std::set<void*> pointers;
+    for (size_t i = 0; i < 100; ++i) {
+        void* const ptr = arena.allocate(32, 16, 0, __FILE__, __LINE__);
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 16, 0u);
+        ASSERT_TRUE(pointers.insert(ptr).second);
+    }
+
+    for (void* ptr : pointers) {
+        arena.free(ptr);
+    }
+
+    // The freed blocks must be reused, whether they are in the magazine or back in the chunk
+    for (size_t i = 0; i < 100; ++i) {
+        void* const ptr = arena.allocate(32, 16, 0, __FILE__, __LINE__);
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(pointers.count(ptr), 1u);
+    }
+}
+
+TEST(MemoryThreadCache, OutOfMemory) {
+    Area::Heap<4096, 1> area;
+    CachedArena arena(&area);
+
+    size_t count = 0;
+    while (arena.allocate(32, 16, 0, __FILE__, __LINE__)) {
+        ++count;
+    }
+
+    ASSERT_EQ(count, 4096u / 32u);
+}
+
+TEST(MemoryThreadCache, Reset) {
+    Area::Heap<4096, 1> area;
+    CachedArena arena(&area);
+
+    for (size_t i = 0; i < 4096 / 32; ++i) {
+        ASSERT_NE(arena.allocate(32, 16, 0, __FILE__, __LINE__), nullptr);
+    }
+
+    arena.reset();
+
+    for (size_t i = 0; i < 4096 / 32; ++i) {
+        ASSERT_NE(arena.allocate(32, 16, 0, __FILE__, __LINE__), nullptr);
+    }
+}
+
+TEST(MemoryThreadCache, MultipleThreads) {
+    constexpr size_t threadCount = 4;
+    constexpr size_t allocationCount = 256;
+
+    // Leave some room for the blocks cached in the magazines of the other threads
+    Area::Heap<4096, 2 * threadCount * allocationCount * 32 / 4096> area;
+    CachedArena arena(&area);
+
+    std::vector<std::vector<void*>> pointers(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&arena, &pointers, i]() {
+            // Churn the magazine and the shared chunk, then keep a set of blocks alive
+            for (size_t j = 0; j < 16; ++j) {
+                std::vector<void*> tmp;
+                for (size_t k = 0; k < allocationCount / 2; ++k) {
+                    tmp.push_back(arena.allocate(32, 16, 0, __FILE__, __LINE__));
+                }
+
+                for (void* ptr : tmp) {
+                    arena.free(ptr);
+                }
+            }
+
+            for (size_t k = 0; k < allocationCount; ++k) {
+                pointers[i].push_back(arena.allocate(32, 16, 0, __FILE__, __LINE__));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<void*> unique;
+    for (const auto& threadPointers : pointers) {
+        for (void* ptr : threadPointers) {
+            ASSERT_NE(ptr, nullptr);
+            ASSERT_TRUE(unique.insert(ptr).second);
+        }
+    }
+}
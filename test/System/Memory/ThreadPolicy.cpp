@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t ThreadCount = 4;
+
+// Non-atomic increments, only correct if the policy excludes the other threads
+template <class ThreadPolicy>
+void testMutualExclusion() {
+    ThreadPolicy policy;
+    size_t counter = 0;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < ThreadCount; ++i) {
+        threads.emplace_back([&policy, &counter]() {
+            for (size_t j = 0; j < 20000; ++j) {
+                policy.enter();
+                counter = counter + 1;
+                policy.leave();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(counter, ThreadCount * 20000);
+}
+
+template <class ThreadPolicy>
+void testArena() {
+    using ArenaType = Arena<
+        Allocator::Chunk<32, 16>,
+        ThreadPolicy,
+        Policies::NoBoundsChecking,
+        Policies::NoMemoryMarking
+    >;
+
+    Area::Heap<4096, 64> area;
+    ArenaType arena(&area);
+
+    std::vector<std::vector<void*>> pointers(ThreadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < ThreadCount; ++i) {
+        threads.emplace_back([&arena, &pointers, i]() {
+            for (size_t j = 0; j < 1000; ++j) {
+                void* const ptr = arena.allocate(32, 16, 0, __FILE__, __LINE__);
+                pointers[i].push_back(ptr);
+
+                // Give some blocks back to be reused by the other threads
+                if (j % 4 == 3) {
+                    arena.free(pointers[i][j - 1]);
+                    pointers[i][j - 1] = nullptr;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // No block is given to two threads
+    std::set<void*> unique;
+    size_t count = 0;
+
+    for (const auto& threadPointers : pointers) {
+        for (void* ptr : threadPointers) {
+            if (ptr) {
+                ASSERT_TRUE(unique.insert(ptr).second);
+                ++count;
+            }
+        }
+    }
+
+    ASSERT_EQ(count, ThreadCount * 750);
+}
+
+}
+
+TEST(MemoryThreadPolicy, SpinLock) {
+    testMutualExclusion<Policies::SpinLockPolicy>();
+    testArena<Policies::SpinLockPolicy>();
+}
+
+TEST(MemoryThreadPolicy, AdaptiveLock) {
+    testMutualExclusion<Policies::AdaptiveLockPolicy<>>();
+    testArena<Policies::AdaptiveLockPolicy<>>();
+
+    // Never spinning, always blocking on the mutex
+    testMutualExclusion<Policies::AdaptiveLockPolicy<0>>();
+}
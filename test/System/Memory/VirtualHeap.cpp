@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/VirtualHeap.hpp>
+
+#if defined(LUG_SYSTEM_LINUX) || defined(LUG_SYSTEM_ANDROID)
+    #include <sys/mman.h>
+#endif
+
+using namespace lug::System::Memory;
+
+namespace {
+
+constexpr size_t PageSize = 64 * 1024;
+
+using LinearArena = Arena<
+    Allocator::Linear,
+    Policies::SingleThreadPolicy,
+    Policies::NoBoundsChecking,
+    Policies::NoMemoryMarking
+>;
+
+#if defined(LUG_SYSTEM_LINUX) || defined(LUG_SYSTEM_ANDROID)
+// Number of system pages of the range backed by physical memory
+size_t getResidentPageCount(void* ptr, size_t size) {
+    const size_t systemPageSize = Area::VirtualMemory::getPageSize();
+    std::vector<unsigned char> residency((size + systemPageSize - 1) / systemPageSize);
+
+    if (mincore(ptr, size, residency.data()) != 0) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (unsigned char page : residency) {
+        count += page & 1;
+    }
+
+    return count;
+}
+#endif
+
+}
+
+TEST(MemoryVirtualHeap, Pages) {
+    Area::VirtualHeap<PageSize> area(16 * PageSize);
+    ASSERT_EQ(area.getReservedSize(), 16 * PageSize);
+
+    Area::Page* first = area.requestNextPage();
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first->prev, nullptr);
+    ASSERT_EQ(static_cast<char*>(first->end) - static_cast<char*>(first->start) + 1, static_cast<ptrdiff_t>(PageSize));
+
+    // The pages are contiguous in the reserved range, up to the reserved size
+    Area::Page* previous = first;
+    for (size_t i = 1; i < 16; ++i) {
+        Area::Page* page = area.requestNextPage();
+
+        ASSERT_NE(page, nullptr);
+        ASSERT_EQ(page->prev, previous);
+        ASSERT_EQ(page->start, static_cast<char*>(previous->end) + 1);
+
+        std::memset(page->start, 0xAB, PageSize);
+        previous = page;
+    }
+
+    ASSERT_EQ(area.requestNextPage(), nullptr);
+    ASSERT_EQ(area.getPageCount(), 16u);
+}
+
+TEST(MemoryVirtualHeap, LinearGrowth) {
+    // Far more pages than the default reservation commits
+    Area::VirtualHeap<PageSize> area;
+    LinearArena arena(&area);
+
+    std::vector<uint64_t*> blocks;
+    for (size_t i = 0; i < 256; ++i) {
+        uint64_t* block = static_cast<uint64_t*>(arena.allocate(PageSize / 2, alignof(uint64_t), 0, __FILE__, __LINE__));
+        ASSERT_NE(block, nullptr);
+
+        *block = i;
+        blocks.push_back(block);
+    }
+
+    // Nothing moved
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        ASSERT_EQ(*blocks[i], i);
+    }
+
+    ASSERT_GE(area.getPageCount(), 128u);
+}
+
+TEST(MemoryVirtualHeap, Decommit) {
+    Area::VirtualHeap<PageSize> area(64 * PageSize);
+
+    Area::Page* first = area.requestNextPage();
+    ASSERT_NE(first, nullptr);
+    std::memset(first->start, 0xCD, PageSize);
+
+    // Load spike, touches every page
+    for (size_t i = 1; i < 32; ++i) {
+        Area::Page* page = area.requestNextPage();
+        ASSERT_NE(page, nullptr);
+        std::memset(page->start, 0xCD, PageSize);
+    }
+
+#if defined(LUG_SYSTEM_LINUX) || defined(LUG_SYSTEM_ANDROID)
+    const size_t systemPagesPerPage = PageSize / Area::VirtualMemory::getPageSize();
+    ASSERT_EQ(getResidentPageCount(first->start, 32 * PageSize), 32 * systemPagesPerPage);
+#endif
+
+    area.decommit(1);
+
+#if defined(LUG_SYSTEM_LINUX) || defined(LUG_SYSTEM_ANDROID)
+    ASSERT_EQ(getResidentPageCount(first->start, 32 * PageSize), systemPagesPerPage);
+#endif
+
+    // The first page kept its content, the others are still usable
+    ASSERT_EQ(static_cast<unsigned char*>(first->start)[PageSize - 1], 0xCD);
+    std::memset(static_cast<char*>(first->end) + 1, 0xEF, PageSize);
+}
+
+TEST(MemoryVirtualHeap, DecommitOnReset) {
+    Area::VirtualHeap<PageSize> area(64 * PageSize, true);
+    LinearArena arena(&area);
+
+    for (size_t frame = 0; frame < 3; ++frame) {
+        for (size_t i = 0; i < 32; ++i) {
+            void* block = arena.allocate(PageSize / 2, 16, 0, __FILE__, __LINE__);
+            ASSERT_NE(block, nullptr);
+            std::memset(block, 0xCD, PageSize / 2);
+        }
+
+        // The same pages are reused after each reset, no new page is committed
+        ASSERT_LE(area.getPageCount(), 32u);
+
+        arena.reset();
+    }
+}
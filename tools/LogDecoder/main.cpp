@@ -0,0 +1,29 @@
+#include <iostream>
+#include <string>
+#include <lug/System/Logger/BinaryDecoder.hpp>
+#include <lug/System/Logger/OstreamHandler.hpp>
+
+// Writes the messages of a file of `BinaryHandler` to the standard output
+// Usage: lug-logdecoder <file> [pattern]
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " <file> [pattern]" << std::endl;
+        std::cerr << "The table of the format strings must be next to the file (<file>.table)" << std::endl;
+        return 1;
+    }
+
+    lug::System::Logger::BinaryDecoder decoder;
+
+    if (!decoder.open(argv[1])) {
+        std::cerr << "Can't read " << argv[1] << " or its table" << std::endl;
+        return 1;
+    }
+
+    lug::System::Logger::StdoutHandler handler("LogDecoder");
+    handler.setPattern(argc == 3 ? std::string(argv[2]) + "\n" : "[%Y-%m-%d %H:%M:%S] [%l] %v\n");
+
+    decoder.decode(handler);
+    handler.flush();
+
+    return 0;
+}